@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "CollisionSystem.h"
+#include "TiledMap.h"
+
+namespace {
+
+const char* const MAP_PATH = "assets/maps/test_map.tmx";
+
+// Roughly one tick of player movement
+constexpr float STEP = 4.0f;
+constexpr size_t MOVE_COUNT = 4096;
+
+struct Move {
+  float oldX, oldY;
+  float newX, newY;
+};
+
+// Loaded once for every collision benchmark; null if the map is missing
+const TiledMap* testMap() {
+  static TiledMap map;
+  static bool loaded = map.load(MAP_PATH);
+  return loaded ? &map : nullptr;
+}
+
+// Short steps from random points across the world, the same every run
+std::vector<Move> makeMoves(const TiledMap& map) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<float> x(0.0f, map.getWorldWidth());
+  std::uniform_real_distribution<float> y(0.0f, map.getWorldHeight());
+  std::uniform_real_distribution<float> step(-STEP, STEP);
+
+  std::vector<Move> moves(MOVE_COUNT);
+  for (Move& move : moves) {
+    move.oldX = x(rng);
+    move.oldY = y(rng);
+    move.newX = move.oldX + step(rng);
+    move.newY = move.oldY + step(rng);
+  }
+  return moves;
+}
+
+void BM_CheckMovement(benchmark::State& state) {
+  const TiledMap* map = testMap();
+  if (!map) {
+    state.SkipWithError("Failed to load assets/maps/test_map.tmx");
+    return;
+  }
+  CollisionSystem collision(map->getCollisionShapes());
+  std::vector<Move> moves = makeMoves(*map);
+
+  size_t i = 0;
+  for (auto _ : state) {
+    const Move& move = moves[i++ % moves.size()];
+    float newX = move.newX;
+    float newY = move.newY;
+    bool allowed = collision.checkMovement(move.oldX, move.oldY, newX, newY);
+    benchmark::DoNotOptimize(allowed);
+    benchmark::DoNotOptimize(newX);
+    benchmark::DoNotOptimize(newY);
+  }
+  state.counters["shapes"] =
+      static_cast<double>(map->getCollisionShapes().size());
+}
+BENCHMARK(BM_CheckMovement);
+
+void BM_IsPositionValid(benchmark::State& state) {
+  const TiledMap* map = testMap();
+  if (!map) {
+    state.SkipWithError("Failed to load assets/maps/test_map.tmx");
+    return;
+  }
+  CollisionSystem collision(map->getCollisionShapes());
+  std::vector<Move> moves = makeMoves(*map);
+
+  size_t i = 0;
+  for (auto _ : state) {
+    const Move& move = moves[i++ % moves.size()];
+    bool valid = collision.isPositionValid(move.oldX, move.oldY);
+    benchmark::DoNotOptimize(valid);
+  }
+}
+BENCHMARK(BM_IsPositionValid);
+
+}  // namespace
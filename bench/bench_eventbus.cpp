@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "EventBus.h"
+
+namespace {
+
+// Publish to N plain subscribers, each doing trivial work
+void BM_Publish(benchmark::State& state) {
+  EventBus bus;
+  uint64_t frames = 0;
+  std::vector<Subscription> subscriptions;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    subscriptions.push_back(bus.subscribeScoped<UpdateEvent>(
+        [&frames](const UpdateEvent& e) { frames += e.frameNumber; }));
+  }
+
+  UpdateEvent event{16.67f, 1};
+  for (auto _ : state) {
+    bus.publish(event);
+    benchmark::DoNotOptimize(frames);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Publish)->RangeMultiplier(4)->Range(1, 64);
+
+// Queue N events for a phase and flush them to one batch subscriber, the
+// way ServerGameState delivers enemy deaths
+void BM_EnqueueFlush(benchmark::State& state) {
+  EventBus bus;
+  size_t delivered = 0;
+  Subscription subscription = bus.subscribeBatchScoped<EnemyDiedEvent>(
+      [&delivered](EventSpan<EnemyDiedEvent> deaths) {
+        delivered += deaths.size();
+      });
+
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      bus.enqueue(EnemyDiedEvent{static_cast<uint32_t>(i), 1, 0.0f, 0.0f},
+                  EventPhase::AfterSimulation);
+    }
+    bus.flush(EventPhase::AfterSimulation);
+    benchmark::DoNotOptimize(delivered);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EnqueueFlush)->RangeMultiplier(4)->Range(1, 256);
+
+}  // namespace
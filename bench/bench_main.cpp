@@ -0,0 +1,21 @@
+#include <benchmark/benchmark.h>
+
+#include "Logger.h"
+
+// gambit_bench: microbenchmarks for the server's hot paths
+// Run from the repository root (the collision benchmarks load
+// assets/maps/test_map.tmx). For numbers to diff between releases:
+//   gambit_bench --benchmark_out=bench.json --benchmark_out_format=json
+int main(int argc, char** argv) {
+  Logger::init();
+  // Spawn/apply/expire lines would otherwise dominate the timings
+  Logger::configure("error");
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,257 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "NetworkProtocol.h"
+
+namespace {
+
+// Sizes of the variable-length packets, roughly a busy match
+constexpr uint32_t PLAYER_COUNT = 4;
+constexpr uint32_t ENEMY_COUNT = 64;
+constexpr uint8_t EFFECT_COUNT = 4;
+
+template <typename Packet>
+void BM_Serialize(benchmark::State& state, Packet packet) {
+  size_t size = 0;
+  for (auto _ : state) {
+    std::vector<uint8_t> bytes = serialize(packet);
+    size = bytes.size();
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+template <typename Packet>
+void BM_Deserialize(benchmark::State& state, Packet packet,
+                    Packet (*deserialize)(const uint8_t*, size_t)) {
+  std::vector<uint8_t> bytes = serialize(packet);
+  for (auto _ : state) {
+    Packet decoded = deserialize(bytes.data(), bytes.size());
+    benchmark::DoNotOptimize(decoded);
+  }
+  state.SetBytesProcessed(
+      static_cast<int64_t>(state.iterations() * bytes.size()));
+}
+
+ClientInputPacket clientInput() {
+  ClientInputPacket packet;
+  packet.inputSequence = 1234;
+  packet.moveLeft = true;
+  packet.moveRight = false;
+  packet.moveUp = true;
+  packet.moveDown = false;
+  return packet;
+}
+
+StateUpdatePacket stateUpdate() {
+  StateUpdatePacket packet;
+  packet.serverTick = 600;
+  for (uint32_t i = 0; i < PLAYER_COUNT; ++i) {
+    float f = static_cast<float>(i);
+    packet.players.push_back(
+        {i + 1, 100.0f * f, 50.0f * f, 1.0f, -1.0f, 80.0f, 255, 128, 0, 42});
+  }
+  return packet;
+}
+
+PlayerJoinedPacket playerJoined() {
+  PlayerJoinedPacket packet;
+  packet.playerId = 7;
+  packet.r = 255;
+  packet.g = 0;
+  packet.b = 128;
+  return packet;
+}
+
+PlayerLeftPacket playerLeft() {
+  PlayerLeftPacket packet;
+  packet.playerId = 7;
+  return packet;
+}
+
+PlayerDiedPacket playerDied() {
+  PlayerDiedPacket packet;
+  packet.playerId = 7;
+  return packet;
+}
+
+PlayerRespawnedPacket playerRespawned() {
+  PlayerRespawnedPacket packet;
+  packet.playerId = 7;
+  packet.x = 320.0f;
+  packet.y = 240.0f;
+  return packet;
+}
+
+EnemyStateUpdatePacket enemyStateUpdate() {
+  EnemyStateUpdatePacket packet;
+  packet.serverTick = 600;
+  for (uint32_t i = 0; i < ENEMY_COUNT; ++i) {
+    float f = static_cast<float>(i);
+    packet.enemies.push_back(
+        {i + 1, 0, 1, 10.0f * f, 20.0f * f, 0.5f, 0.5f, 40.0f, 50.0f});
+  }
+  return packet;
+}
+
+AttackEnemyPacket attackEnemy() {
+  AttackEnemyPacket packet;
+  packet.enemyId = 12;
+  packet.damage = 25.0f;
+  return packet;
+}
+
+EnemyDiedPacket enemyDied() {
+  EnemyDiedPacket packet;
+  packet.enemyId = 12;
+  packet.killerId = 7;
+  return packet;
+}
+
+InventoryUpdatePacket inventoryUpdate() {
+  InventoryUpdatePacket packet;
+  packet.playerId = 7;
+  for (uint32_t i = 0; i < 20; ++i) {
+    packet.inventory[i] = {i + 1, static_cast<int32_t>(i)};
+  }
+  packet.equipment[0] = {3, 1};
+  packet.equipment[1] = {0, 0};
+  return packet;
+}
+
+UseItemPacket useItem() {
+  UseItemPacket packet;
+  packet.slotIndex = 4;
+  return packet;
+}
+
+EquipItemPacket equipItem() {
+  EquipItemPacket packet;
+  packet.inventorySlot = 4;
+  packet.equipmentSlot = 0;
+  return packet;
+}
+
+ItemSpawnedPacket itemSpawned() {
+  ItemSpawnedPacket packet;
+  packet.worldItemId = 99;
+  packet.itemId = 3;
+  packet.x = 320.0f;
+  packet.y = 240.0f;
+  return packet;
+}
+
+ItemPickupRequestPacket itemPickupRequest() {
+  ItemPickupRequestPacket packet;
+  packet.worldItemId = 99;
+  return packet;
+}
+
+ItemPickedUpPacket itemPickedUp() {
+  ItemPickedUpPacket packet;
+  packet.worldItemId = 99;
+  packet.playerId = 7;
+  return packet;
+}
+
+EffectAppliedPacket effectApplied() {
+  EffectAppliedPacket packet;
+  packet.targetId = 12;
+  packet.isEnemy = true;
+  packet.effectType = 6;
+  packet.stacks = 2;
+  packet.remainingDuration = 3000.0f;
+  packet.sourceId = 7;
+  return packet;
+}
+
+EffectRemovedPacket effectRemoved() {
+  EffectRemovedPacket packet;
+  packet.targetId = 12;
+  packet.isEnemy = true;
+  packet.effectType = 6;
+  return packet;
+}
+
+EffectUpdatePacket effectUpdate() {
+  EffectUpdatePacket packet;
+  packet.targetId = 12;
+  packet.isEnemy = true;
+  for (uint8_t i = 0; i < EFFECT_COUNT; ++i) {
+    packet.effects.push_back({i, 1, 1500.0f});
+  }
+  return packet;
+}
+
+CharacterSelectedPacket characterSelected() {
+  CharacterSelectedPacket packet;
+  packet.characterId = 5;
+  return packet;
+}
+
+ObjectiveStatePacket objectiveState() {
+  ObjectiveStatePacket packet;
+  packet.objectiveId = 3;
+  packet.objectiveType = 1;
+  packet.objectiveState = 1;
+  packet.x = 800.0f;
+  packet.y = 600.0f;
+  packet.radius = 96.0f;
+  packet.progress = 0.5f;
+  packet.enemiesRequired = 10;
+  packet.enemiesKilled = 4;
+  packet.depositX = 900.0f;
+  packet.depositY = 650.0f;
+  return packet;
+}
+
+ObjectiveInteractPacket objectiveInteract() {
+  ObjectiveInteractPacket packet;
+  packet.objectiveId = 3;
+  return packet;
+}
+
+ShipLocationPacket shipLocation() {
+  ShipLocationPacket packet;
+  packet.x = 1024.0f;
+  packet.y = 512.0f;
+  return packet;
+}
+
+}  // namespace
+
+// One serialize and one deserialize benchmark per packet type
+#define PACKET_BENCHMARKS(Name, sample, deserialize) \
+  BENCHMARK_CAPTURE(BM_Serialize, Name, sample());   \
+  BENCHMARK_CAPTURE(BM_Deserialize, Name, sample(), deserialize)
+
+PACKET_BENCHMARKS(ClientInput, clientInput, deserializeClientInput);
+PACKET_BENCHMARKS(StateUpdate, stateUpdate, deserializeStateUpdate);
+PACKET_BENCHMARKS(PlayerJoined, playerJoined, deserializePlayerJoined);
+PACKET_BENCHMARKS(PlayerLeft, playerLeft, deserializePlayerLeft);
+PACKET_BENCHMARKS(PlayerDied, playerDied, deserializePlayerDied);
+PACKET_BENCHMARKS(PlayerRespawned, playerRespawned,
+                  deserializePlayerRespawned);
+PACKET_BENCHMARKS(EnemyStateUpdate, enemyStateUpdate,
+                  deserializeEnemyStateUpdate);
+PACKET_BENCHMARKS(AttackEnemy, attackEnemy, deserializeAttackEnemy);
+PACKET_BENCHMARKS(EnemyDied, enemyDied, deserializeEnemyDied);
+PACKET_BENCHMARKS(InventoryUpdate, inventoryUpdate,
+                  deserializeInventoryUpdate);
+PACKET_BENCHMARKS(UseItem, useItem, deserializeUseItem);
+PACKET_BENCHMARKS(EquipItem, equipItem, deserializeEquipItem);
+PACKET_BENCHMARKS(ItemSpawned, itemSpawned, deserializeItemSpawned);
+PACKET_BENCHMARKS(ItemPickupRequest, itemPickupRequest,
+                  deserializeItemPickupRequest);
+PACKET_BENCHMARKS(ItemPickedUp, itemPickedUp, deserializeItemPickedUp);
+PACKET_BENCHMARKS(EffectApplied, effectApplied, deserializeEffectApplied);
+PACKET_BENCHMARKS(EffectRemoved, effectRemoved, deserializeEffectRemoved);
+PACKET_BENCHMARKS(EffectUpdate, effectUpdate, deserializeEffectUpdate);
+PACKET_BENCHMARKS(CharacterSelected, characterSelected,
+                  deserializeCharacterSelected);
+PACKET_BENCHMARKS(ObjectiveState, objectiveState, deserializeObjectiveState);
+PACKET_BENCHMARKS(ObjectiveInteract, objectiveInteract,
+                  deserializeObjectiveInteract);
+PACKET_BENCHMARKS(ShipLocation, shipLocation, deserializeShipLocation);
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "EffectManager.h"
+#include "Enemy.h"
+#include "EnemySpawn.h"
+#include "EnemySystem.h"
+#include "EventBus.h"
+#include "Player.h"
+#include "config/PlayerConfig.h"
+#include "config/TimingConfig.h"
+
+namespace {
+
+constexpr float SPAWN_SPACING = 48.0f;
+constexpr uint32_t PLAYER_COUNT = 4;
+
+// Far longer than any benchmark runs, so the effect set stays constant
+constexpr float LONG_DURATION_MS = 1.0e9f;
+
+// Slimes on a square grid
+std::vector<EnemySpawn> gridSpawns(int64_t count) {
+  int64_t side = static_cast<int64_t>(std::ceil(std::sqrt(count)));
+  std::vector<EnemySpawn> spawns;
+  spawns.reserve(count);
+  for (int64_t i = 0; i < count; ++i) {
+    spawns.push_back({EnemyType::Slime, SPAWN_SPACING * (i % side),
+                      SPAWN_SPACING * (i / side), "bench"});
+  }
+  return spawns;
+}
+
+// Players spread along the grid's diagonal, so some enemies idle, some
+// chase and some attack
+std::unordered_map<uint32_t, Player> diagonalPlayers(int64_t enemyCount) {
+  float extent = SPAWN_SPACING * std::ceil(std::sqrt(enemyCount));
+  std::unordered_map<uint32_t, Player> players;
+  for (uint32_t i = 0; i < PLAYER_COUNT; ++i) {
+    Player player;
+    player.id = i + 1;
+    player.x = extent * (i + 0.5f) / PLAYER_COUNT;
+    player.y = player.x;
+    players[player.id] = player;
+  }
+  return players;
+}
+
+void BM_EnemySystemUpdate(benchmark::State& state) {
+  EventBus bus;
+  std::vector<EnemySpawn> spawns = gridSpawns(state.range(0));
+  std::unordered_map<uint32_t, Player> players =
+      diagonalPlayers(state.range(0));
+  EnemySystem enemySystem(spawns, bus, 1234);
+  EffectManager effectManager(1234);
+  enemySystem.spawnAllEnemies();
+
+  for (auto _ : state) {
+    enemySystem.update(Config::Timing::TARGET_DELTA_MS, players,
+                       &effectManager);
+
+    // Keep the players alive so the enemies keep chasing them
+    for (auto& [id, player] : players) {
+      player.health = Config::Player::MAX_HEALTH;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EnemySystemUpdate)->Arg(100)->Arg(1000)->Arg(10000);
+
+// Every enemy carries a slow, a damage modifier and a heal-over-time
+void BM_EffectManagerUpdate(benchmark::State& state) {
+  EventBus bus;
+  std::vector<EnemySpawn> spawns = gridSpawns(state.range(0));
+  std::unordered_map<uint32_t, Player> players;
+  EnemySystem enemySystem(spawns, bus, 1234);
+  EffectManager effectManager(1234);
+  enemySystem.spawnAllEnemies();
+
+  auto& enemies = enemySystem.getEnemies();
+  for (const auto& [id, enemy] : enemies) {
+    for (EffectType type :
+         {EffectType::Slow, EffectType::Weakened, EffectType::Mend}) {
+      effectManager.applyEffect(id, type, 1, LONG_DURATION_MS, 1, enemies);
+    }
+  }
+
+  for (auto _ : state) {
+    effectManager.update(Config::Timing::TARGET_DELTA_MS, players, enemies,
+                         &enemySystem);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EffectManagerUpdate)->Arg(100)->Arg(1000)->Arg(10000);
+
+}  // namespace
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstdint>
+
+// Heap allocations made through global operator new so far, on any thread
+// AllocationCounter.cpp replaces operator new/delete to count them, so only
+// link it into tools that report allocations (BotSwarm). Over-aligned
+// allocations are not counted.
+uint64_t allocationCount();
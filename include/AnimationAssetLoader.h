@@ -3,15 +3,21 @@
 #include <string>
 
 #include "AnimationController.h"
+#include "AnimationLibrary.h"
 
 // Loads animation data into AnimationController
 // Currently creates animations programmatically based on hardcoded sprite sheet
 // layout Future version will load from JSON metadata (PixelLab.ai integration)
 class AnimationAssetLoader {
  public:
-  // Load all player animations (idle + 8-directional walk)
+  // Player animations (idle + 8-directional walk) for a sprite sheet. Built
+  // on first use and kept for the life of the program.
   // spriteSheetPath: Path to the sprite sheet texture (for future metadata
   // loading)
+  static const AnimationLibrary& getPlayerLibrary(
+      const std::string& spriteSheetPath);
+
+  // Point `controller` at the player animations for a sprite sheet
   static void loadPlayerAnimations(AnimationController& controller,
                                    const std::string& spriteSheetPath);
 
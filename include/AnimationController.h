@@ -1,21 +1,34 @@
 #pragma once
 
-#include <cassert>
+#include <cstdint>
 #include <string>
-#include <unordered_map>
 
-#include "AnimationClip.h"
 #include "AnimationDirection.h"
+#include "AnimationLibrary.h"
 
+class AnimationSystem;
+
+// Per-entity playback state: which clip of a shared AnimationLibrary is
+// playing, and how far into it. Small and cheap to copy; without a library
+// (e.g., on the server) it does nothing.
+//
+// While registered with an AnimationSystem, the time into the clip lives
+// in the system's arrays (see AnimationSystem) and the controller keeps
+// only its slot there. Destroying a registered controller frees its slot.
 class AnimationController {
  public:
-  AnimationController();
+  AnimationController() = default;
+  ~AnimationController();
 
-  // Register an animation clip (e.g., "idle", "walk_north", "walk_east")
-  void addAnimation(const std::string& name, const AnimationClip& clip);
+  // Copies take the playback state, not the registration: a copy starts
+  // unregistered, and assigning keeps the target's own slot
+  AnimationController(const AnimationController& other);
+  AnimationController& operator=(const AnimationController& other);
 
-  // Get animation by name (Tiger Style: asserts if not found)
-  const AnimationClip& getAnimation(const std::string& name) const;
+  // Play clips from `library`, which must outlive the controller.
+  // Restarts at the idle clip.
+  void setLibrary(const AnimationLibrary* library);
+  const AnimationLibrary* getLibrary() const { return library; }
 
   // Update animation state based on velocity
   // Called every frame to determine direction and switch animations
@@ -33,19 +46,27 @@ class AnimationController {
   void reset();
 
   // Getters
-  const std::string& getCurrentAnimationName() const {
-    return currentAnimationName;
-  }
-  int getCurrentFrameIndex() const { return currentFrameIndex; }
+  AnimationClipId getCurrentClipId() const { return currentClip; }
+  // For logs; "idle" without a library
+  const std::string& getCurrentAnimationName() const;
+  int getCurrentFrameIndex() const;
   AnimationDirection getCurrentDirection() const { return currentDirection; }
+  bool isRegistered() const { return system != nullptr; }
 
  private:
-  std::unordered_map<std::string, AnimationClip> animations;
-  std::string currentAnimationName;
-  int currentFrameIndex;
-  float frameTimer;  // Milliseconds elapsed in current frame
-  AnimationDirection currentDirection;
+  friend class AnimationSystem;
+
+  const AnimationLibrary* library = nullptr;
+  AnimationSystem* system = nullptr;  // Owner of our playback slot, if any
+  uint32_t slot = 0;
+  AnimationClipId currentClip = 0;
+  AnimationDirection currentDirection = AnimationDirection::IDLE;
+  float elapsedMs = 0.0f;  // Time into the clip, while unregistered
+
+  float getElapsedMs() const;
+  void setElapsedMs(float ms);
+  float getCycleMs() const;
 
   // Internal helper to switch animation
-  void playAnimation(const std::string& name);
+  void playAnimation(AnimationClipId clip);
 };
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "AnimationClip.h"
+#include "AnimationDirection.h"
+
+using AnimationClipId = uint16_t;
+
+// AnimationLibrary: The clips of one sprite sheet, shared by every entity
+// drawn from it. Built once by AnimationAssetLoader and read-only after;
+// controllers refer to clips by index and pick walk clips from a table
+// indexed by AnimationDirection, so nothing is looked up by name per frame.
+//
+// Playback is just the time into the current clip: the frame is found
+// from it when drawn, and looping clips wrap it at their cycle length.
+class AnimationLibrary {
+ public:
+  static constexpr size_t DIRECTION_COUNT =
+      static_cast<size_t>(AnimationDirection::NORTHWEST) + 1;
+
+  // Cycle length of clips that never wrap (one-shot or empty)
+  static constexpr float NO_CYCLE = std::numeric_limits<float>::max();
+
+  AnimationClipId addClip(const AnimationClip& clip) {
+    clips.push_back(clip);
+    float total = clip.getTotalDuration();
+    cycleMs.push_back(clip.loop && total > 0.0f ? total : NO_CYCLE);
+    return static_cast<AnimationClipId>(clips.size() - 1);
+  }
+
+  void setDirectionClip(AnimationDirection dir, AnimationClipId id) {
+    assert(id < clips.size() && "Direction mapped to unknown clip");
+    directionClips[static_cast<size_t>(dir)] = id;
+  }
+
+  AnimationClipId getDirectionClip(AnimationDirection dir) const {
+    return directionClips[static_cast<size_t>(dir)];
+  }
+
+  // Tiger Style: asserts if id is out of range
+  const AnimationClip& getClip(AnimationClipId id) const {
+    assert(id < clips.size() && "Animation clip id out of bounds");
+    return clips[id];
+  }
+
+  size_t getClipCount() const { return clips.size(); }
+
+  // Time after which a clip starts over; NO_CYCLE if it doesn't
+  float getCycleMs(AnimationClipId id) const {
+    assert(id < clips.size() && "Animation clip id out of bounds");
+    return cycleMs[id];
+  }
+
+  // Frame shown `elapsedMs` into a clip. Looping clips wrap; one-shot
+  // clips hold their last frame; -1 for empty clips.
+  int frameAt(AnimationClipId id, float elapsedMs) const {
+    const AnimationClip& clip = getClip(id);
+    if (elapsedMs >= cycleMs[id]) {
+      elapsedMs = std::fmod(elapsedMs, cycleMs[id]);
+    }
+    int last = clip.getFrameCount() - 1;
+    for (int i = 0; i < last; ++i) {
+      elapsedMs -= clip.frames[i].duration;
+      if (elapsedMs < 0.0f) return i;
+    }
+    return last;
+  }
+
+  // Linear search by name, for tools and tests
+  bool findClip(const std::string& name, AnimationClipId& outId) const {
+    for (size_t i = 0; i < clips.size(); ++i) {
+      if (clips[i].name == name) {
+        outId = static_cast<AnimationClipId>(i);
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  std::vector<AnimationClip> clips;
+  std::vector<float> cycleMs;  // Parallel to clips
+  std::array<AnimationClipId, DIRECTION_COUNT> directionClips{};
+};
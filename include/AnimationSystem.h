@@ -1,25 +1,65 @@
 #pragma once
 
-#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 #include "Animatable.h"
+#include "AnimationController.h"
 #include "EventBus.h"
 
 // System that updates all animations in the game
 // Subscribes to UpdateEvent and advances all animation timers
+//
+// Playback time is kept in dense arrays, one slot per registered entity,
+// and each controller holds its slot. A tick is one branch-free pass over
+// those arrays, wrapping each time by its clip's cycle length; frames are
+// only worked out when drawn. Unregistering moves the last slot into the
+// hole.
+//
+// Either side may be destroyed first: a controller gives up its slot when
+// it is destroyed, and the system hands every remaining controller its
+// playback time back when it is.
 class AnimationSystem {
  public:
-  AnimationSystem();
+  explicit AnimationSystem(EventBus& bus);
+  ~AnimationSystem();
 
-  // Register an entity with the animation system
+  // Register an entity with the animation system (no-op if already)
   void registerEntity(Animatable* entity);
 
   // Unregister an entity (e.g., when player disconnects)
   void unregisterEntity(Animatable* entity);
 
+  size_t getEntityCount() const { return entities.size(); }
+
+  // Advance every registered animation by deltaTime milliseconds
+  void advance(float deltaTime);
+
  private:
+  friend class AnimationController;
+
+  // Parallel arrays, indexed by slot
   std::vector<Animatable*> entities;
+  std::vector<float> elapsedMs;  // Time into the current clip
+  std::vector<float> cycleMs;    // Clip length, or NO_CYCLE
+
+  std::vector<Subscription> subscriptions;
+
+  // Swap-remove a slot, re-pointing the controller moved into it. Inline
+  // so controllers can free their slot without linking the system in.
+  void removeSlot(uint32_t slot) {
+    size_t last = entities.size() - 1;
+    if (slot != last) {
+      entities[slot] = entities[last];
+      elapsedMs[slot] = elapsedMs[last];
+      cycleMs[slot] = cycleMs[last];
+      entities[slot]->getAnimationController()->slot = slot;
+    }
+    entities.pop_back();
+    elapsedMs.pop_back();
+    cycleMs.pop_back();
+  }
 
   void onUpdate(const UpdateEvent& e);
 };
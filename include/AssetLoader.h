@@ -0,0 +1,83 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// AssetLoader: Background job queue for asset decoding and parsing
+// Worker threads run CPU work (image decode, map/CSV parse, audio open).
+// Work that must touch GL is split in two: the decode half runs on a
+// worker and returns an Upload, which the render thread runs from pump()
+// a few per frame, within a byte budget, so a burst of loads never stalls
+// one frame.
+//
+// With zero workers (WASM, which is built without threads) submit() runs
+// the job immediately and decode halves run inside pump(), one per frame.
+class AssetLoader {
+ public:
+  // Render-thread half of a job, and its share of the frame budget
+  struct Upload {
+    std::function<void()> run;
+    size_t cost = 0;  // Bytes uploaded, typically
+  };
+
+  static constexpr size_t DEFAULT_UPLOAD_BUDGET = 8 * 1024 * 1024;
+
+  static AssetLoader& instance();
+
+  explicit AssetLoader(unsigned workerCount);
+  ~AssetLoader();  // Drops queued jobs, joins workers
+
+  AssetLoader(const AssetLoader&) = delete;
+  AssetLoader& operator=(const AssetLoader&) = delete;
+
+  // Run `job` on a worker; the future resolves with its result
+  template <typename Fn>
+  auto submit(Fn&& job) -> std::future<std::invoke_result_t<Fn>> {
+    using Result = std::invoke_result_t<Fn>;
+    auto task = std::make_shared<std::packaged_task<Result()>>(
+        std::forward<Fn>(job));
+    std::future<Result> future = task->get_future();
+    if (workers.empty()) {
+      (*task)();
+    } else {
+      enqueue([task]() { (*task)(); });
+    }
+    return future;
+  }
+
+  // Run `decode` on a worker, then the Upload it returns on the render
+  // thread from pump()
+  void submitWithUpload(std::function<Upload()> decode);
+
+  // Render thread, once per frame: run finished uploads until `budget` is
+  // spent. At least one runs per call so oversized uploads still land.
+  // Returns the number of uploads run.
+  size_t pump(size_t budget = DEFAULT_UPLOAD_BUDGET);
+
+  // submitWithUpload jobs not yet uploaded
+  size_t getPendingCount() const;
+  unsigned getWorkerCount() const {
+    return static_cast<unsigned>(workers.size());
+  }
+
+ private:
+  void enqueue(std::function<void()> job);
+  void workerLoop();
+
+  std::vector<std::thread> workers;
+
+  mutable std::mutex mutex;
+  std::condition_variable jobReady;
+  std::deque<std::function<void()>> jobs;
+  std::deque<Upload> uploads;
+  size_t inFlight = 0;  // submitWithUpload jobs not yet uploaded
+  bool stopping = false;
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+// One packed atlas image, stored next to the manifest
+struct AtlasPage {
+  std::string file;  // Relative to the manifest's directory
+  int width;
+  int height;
+};
+
+// Where a source image lives in the atlas, in page pixels
+struct AtlasEntry {
+  int page;
+  int x;
+  int y;
+  int width;
+  int height;
+};
+
+// AtlasManifest: Lookup table written by AtlasPacker, read by
+// TextureManager. Plain text, one record per line:
+//   page <index> <file> <width> <height>
+//   image <source path> <page> <x> <y> <width> <height>
+class AtlasManifest {
+ public:
+  static constexpr const char* DEFAULT_PATH = "assets/atlas/atlas.txt";
+
+  // False if the file is missing or malformed (the manifest is then empty)
+  bool load(const std::string& path);
+  bool save(const std::string& path) const;
+
+  void addPage(const AtlasPage& page) { pages.push_back(page); }
+  void addImage(const std::string& path, const AtlasEntry& entry) {
+    images[path] = entry;
+  }
+
+  const AtlasEntry* find(const std::string& path) const;
+
+  const std::vector<AtlasPage>& getPages() const { return pages; }
+  size_t getImageCount() const { return images.size(); }
+
+  // Directory that page files are relative to (with trailing '/')
+  const std::string& getBaseDirectory() const { return baseDirectory; }
+
+ private:
+  std::vector<AtlasPage> pages;
+  std::map<std::string, AtlasEntry> images;  // Sorted: stable output
+  std::string baseDirectory;
+};
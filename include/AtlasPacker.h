@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+
+// Where one image landed: page index and top-left pixel in that page
+// (page is -1 if the image can never fit a page)
+struct AtlasPlacement {
+  int page;
+  int x;
+  int y;
+};
+
+// AtlasPacker: Shelf bin packing of rectangles into square pages (no I/O)
+// Images are placed tallest first onto horizontal shelves, each shelf as
+// tall as its first image, opening a new shelf (then a new page) when
+// nothing fits. Works well for the repo's art, which comes in a handful of
+// uniform sizes. `padding` transparent pixels separate neighbours so
+// filtering never samples across images.
+class AtlasPacker {
+ public:
+  AtlasPacker(int pageSize, int padding);
+
+  struct Size {
+    int width;
+    int height;
+  };
+
+  // One placement per input, in input order. Deterministic for equal input.
+  std::vector<AtlasPlacement> pack(const std::vector<Size>& sizes);
+
+  int getPageCount() const { return static_cast<int>(pages.size()); }
+
+  // Bounding box actually used on a page; pages are written cropped to it
+  int getUsedWidth(int page) const { return pages[page].usedWidth; }
+  int getUsedHeight(int page) const { return pages[page].usedHeight; }
+
+ private:
+  struct Shelf {
+    int y;
+    int height;
+    int cursorX;  // Next free x on the shelf
+  };
+
+  struct Page {
+    std::vector<Shelf> shelves;
+    int nextShelfY = 0;
+    int usedWidth = 0;
+    int usedHeight = 0;
+  };
+
+  int pageSize;
+  int padding;
+  std::vector<Page> pages;
+
+  bool placeOnPage(Page& page, int width, int height, int& x, int& y);
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "transport/INetworkTransport.h"
+
+// Movement pattern a bot plays back (InputScript-style, generated per frame)
+enum class BotPattern {
+  Idle,        // Connect and send empty inputs
+  RandomWalk,  // Hold a random direction for 0.5-2s, then pick another
+  Circle,      // Cycle through the 8 directions, one per second
+  Zigzag       // Alternate left/right every second while drifting down
+};
+
+bool parseBotPattern(const std::string& name, BotPattern& outPattern);
+const char* botPatternName(BotPattern pattern);
+
+// BotClient: Protocol-level client for load generation
+// Sends one ClientInputPacket per frame and decodes only what it needs from
+// the server (its own player id and the StateUpdate tick/position). No
+// EventBus, prediction, animation or UI, so hundreds fit in one process.
+class BotClient {
+ public:
+  // Takes ownership of the transport. `seed` makes RandomWalk reproducible.
+  BotClient(std::unique_ptr<INetworkTransport> transport, BotPattern pattern,
+            uint32_t seed);
+  ~BotClient();
+
+  bool connect(const std::string& host, uint16_t port);
+  void disconnect();
+
+  // Send this frame's input
+  void sendInput(uint64_t frame);
+
+  // Drain and decode everything the server has sent
+  void receive();
+
+  bool hasJoined() const { return joined; }
+  uint32_t getPlayerId() const { return playerId; }
+  float getX() const { return x; }
+  float getY() const { return y; }
+  uint32_t getLastServerTick() const { return lastServerTick; }
+
+  uint64_t getBytesSent() const { return bytesSent; }
+  uint64_t getBytesReceived() const { return bytesReceived; }
+  uint64_t getPacketsReceived() const { return packetsReceived; }
+  uint64_t getStateUpdatesReceived() const { return stateUpdatesReceived; }
+
+  // Wall-clock ms per server tick, measured between consecutive StateUpdates
+  // (how fast the server is really ticking, as seen by this client)
+  const std::vector<float>& getTickIntervalsMs() const {
+    return tickIntervalsMs;
+  }
+
+ private:
+  std::unique_ptr<INetworkTransport> transport;
+  TransportEvent incoming;  // Reused by every receive()
+  BotPattern pattern;
+  std::mt19937 rng;
+
+  bool joined = false;
+  uint32_t playerId = 0;
+  float x = 0.0f;
+  float y = 0.0f;
+
+  uint32_t inputSequence = 1;  // Next to send; the server acks from 1
+  uint8_t directionMask = 0;  // bit 0..3 = left, right, up, down
+  uint64_t nextDirectionChangeFrame = 0;
+
+  uint32_t lastServerTick = 0;
+  std::chrono::steady_clock::time_point lastStateUpdateTime;
+
+  uint64_t bytesSent = 0;
+  uint64_t bytesReceived = 0;
+  uint64_t packetsReceived = 0;
+  uint64_t stateUpdatesReceived = 0;
+  std::vector<float> tickIntervalsMs;
+
+  void updateDirection(uint64_t frame);
+  void handlePacket(const uint8_t* data, size_t size);
+  void handleStateUpdate(const uint8_t* data, size_t size);
+};
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "BotClient.h"
+#include "EnemySpawn.h"
+#include "TickPhaseTimes.h"
+
+class InMemoryServerTransport;
+class Match;
+class SharedWorld;
+
+struct BotSwarmConfig {
+  size_t botCount = 32;
+  BotPattern pattern = BotPattern::RandomWalk;
+  uint64_t frames = 60 * 30;  // 30 simulated seconds
+  uint32_t seed = 1;
+
+  // In-process: the swarm hosts a Match over InMemoryServerTransport and
+  // times its ticks directly. Otherwise bots connect over ENet.
+  bool inProcess = true;
+  std::string mapPath = "assets/maps/test_map.tmx";  // Empty = no map
+
+  // In-process: host this many enemies, scattered around the map's spawn
+  // points (or over the whole world without a map), instead of the map's
+  // own. 0 = the map's spawns.
+  size_t enemyCount = 0;
+
+  // ENet target; bot i uses port + (i % portCount) to spread over a
+  // multi-match server
+  std::string host = "127.0.0.1";
+  uint16_t port = 1234;
+  size_t portCount = 1;
+
+  // Pace frames at 60 Hz. Always on for ENet; in-process runs unthrottled
+  // unless requested.
+  bool realtime = false;
+};
+
+struct PercentileSummary {
+  size_t count = 0;
+  float p50 = 0.0f;
+  float p90 = 0.0f;
+  float p99 = 0.0f;
+  float max = 0.0f;
+};
+
+// Nearest-rank percentiles (sorts the samples in place)
+PercentileSummary summarizePercentiles(std::vector<float>& samples);
+
+struct BotSwarmReport {
+  uint64_t frames = 0;
+  double wallSeconds = 0.0;
+  size_t botsConnected = 0;
+  size_t botsJoined = 0;
+
+  // In-process only: wall time of each Match::tick()
+  PercentileSummary serverTickMs;
+  size_t ticksOverBudget = 0;  // Ticks longer than one 60 Hz frame
+
+  // In-process only: what the server could sustain and where ticks go
+  double serverTicksPerSecond = 0.0;  // Ticks per second of tick time
+  TickPhaseTimes meanPhaseMs;
+  float meanNetworkMs = 0.0f;  // Rest of the tick: poll and input handling
+  PercentileSummary allocationsPerTick;
+  PercentileSummary bytesSerializedPerTick;  // Before fan-out to clients
+
+  // In-process only: messages lost to full or undersized channel rings,
+  // either direction. Any loss means the run didn't see the real traffic.
+  uint64_t messagesDropped = 0;
+
+  // Server tick spacing as observed by bots from StateUpdate arrivals
+  PercentileSummary observedTickIntervalMs;
+
+  // Per-bot average bandwidth over the simulated duration
+  PercentileSummary downstreamKbpsPerBot;
+  PercentileSummary upstreamKbpsPerBot;
+
+  // Server → all bots, bytes delivered per frame
+  PercentileSummary downstreamBytesPerFrame;
+
+  uint64_t totalBytesDown = 0;
+  uint64_t totalBytesUp = 0;
+};
+
+void printBotSwarmReport(const BotSwarmReport& report, std::ostream& out);
+
+// BotSwarm: Drives many BotClients against one server from a single process
+class BotSwarm {
+ public:
+  explicit BotSwarm(const BotSwarmConfig& config);
+  ~BotSwarm();
+
+  BotSwarm(const BotSwarm&) = delete;
+  BotSwarm& operator=(const BotSwarm&) = delete;
+
+  // Create the in-process match (if any) and connect every bot
+  bool start();
+
+  // Run config.frames frames and summarize
+  BotSwarmReport run();
+
+  const std::vector<std::unique_ptr<BotClient>>& getBots() const {
+    return bots;
+  }
+
+ private:
+  BotSwarmConfig config;
+
+  std::unique_ptr<SharedWorld> sharedWorld;
+  std::unique_ptr<Match> match;
+  InMemoryServerTransport* serverTransport = nullptr;  // Owned by match
+  std::vector<EnemySpawn> enemySpawns;  // For config.enemyCount
+
+  std::vector<std::unique_ptr<BotClient>> bots;
+  size_t botsConnected = 0;
+
+  bool startInProcessServer();
+  bool connectBots();
+};
@@ -1,7 +1,8 @@
 #pragma once
 
-#include <deque>
+#include <array>
 #include <unordered_map>
+#include <vector>
 
 #include "EventBus.h"
 #include "NetworkProtocol.h"
@@ -9,6 +10,7 @@
 #include "Player.h"
 #include "WorldConfig.h"
 #include "WorldItem.h"
+#include "config/NetworkConfig.h"
 
 // Client-side objective data for rendering
 struct ClientObjective {
@@ -29,11 +31,21 @@ class CollisionSystem;
 class ClientPrediction {
  public:
   ClientPrediction(NetworkClient* client, uint32_t localPlayerId,
-                   const WorldConfig& world);
+                   const WorldConfig& world,
+                   EventBus& bus = EventBus::instance());
 
   const Player& getLocalPlayer() const { return localPlayer; }
   Player& getLocalPlayerMutable() { return localPlayer; }
 
+  // Where to draw the local player: the predicted position plus what is
+  // left of the last correction, which decays a little every tick
+  float getRenderX() const { return localPlayer.x + correctionX; }
+  float getRenderY() const { return localPlayer.y + correctionY; }
+  float getCorrectionDistance() const;
+
+  // Reconciles that had to rewind and replay inputs
+  uint32_t getReplayCount() const { return replayCount; }
+
   const std::unordered_map<uint32_t, WorldItem>& getWorldItems() const {
     return worldItems;
   }
@@ -64,8 +76,24 @@ class ClientPrediction {
   float worldHeight;
   const CollisionSystem* collisionSystem;
 
-  std::deque<LocalInputEvent> inputHistory;
-  uint32_t localInputSequence;
+  // One predicted tick: the input sent and where it left the player
+  struct PredictedInput {
+    uint32_t inputSequence = 0;
+    bool moveLeft = false, moveRight = false, moveUp = false, moveDown = false;
+    float x = 0.0f, y = 0.0f;
+  };
+
+  // Ring keyed by inputSequence; holds the newest HISTORY_SIZE inputs
+  static constexpr size_t HISTORY_SIZE =
+      Config::Network::PREDICTION_HISTORY_SIZE;
+  std::array<PredictedInput, HISTORY_SIZE> history{};
+  uint32_t localInputSequence;  // Next to send; the server acks from 1
+  uint32_t historyStart;        // Oldest input a replay may use
+  uint32_t replayCount = 0;
+
+  // Visual offset from the predicted position after a correction
+  float correctionX = 0.0f;
+  float correctionY = 0.0f;
 
   // World items (items lying on the ground)
   std::unordered_map<uint32_t, WorldItem> worldItems;
@@ -85,4 +113,10 @@ class ClientPrediction {
   void onNetworkPacketReceived(const NetworkPacketReceivedEvent& e);
 
   void reconcile(const StateUpdatePacket& stateUpdate);
+  // Rewind to the server's state at `ackedSequence` and replay the inputs
+  // it has not processed yet
+  void replayFrom(const PlayerState& serverState, uint32_t ackedSequence);
+
+  EventBus& bus;
+  std::vector<Subscription> subscriptions;
 };
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "ClientPrediction.h"
 #include "EnemyInterpolation.h"
 #include "EventBus.h"
@@ -10,12 +12,14 @@
 class CombatSystem {
  public:
   CombatSystem(NetworkClient* netClient, ClientPrediction* prediction,
-               EnemyInterpolation* enemyInterp);
+               EnemyInterpolation* enemyInterp, EventBus& bus);
 
  private:
   NetworkClient* networkClient;
   ClientPrediction* clientPrediction;
   EnemyInterpolation* enemyInterpolation;
+  EventBus& bus;
+  std::vector<Subscription> subscriptions;
 
   static constexpr float ATTACK_RANGE = 150.0f;  // Increased from 50px to 150px
   static constexpr float ATTACK_DAMAGE = 6.0f;   // 3x boost for faster combat
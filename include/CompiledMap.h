@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+class TiledMap;
+
+// CompiledMap: Flat binary form of a TiledMap (.gmap), written by
+// MapCompiler from the TMX source and read back with no parsing
+// Layout (native little-endian, every offset 4-byte aligned):
+//   header:   "GMAP" | u32 version | map and tile sizes | tileset | ship |
+//             u32 sectionCount
+//   sections: sectionCount x {u32 id, u32 offset, u32 size, u32 count},
+//             then each section's data
+// Tile layers are raw gid grids used in place from the mapping. Collision
+// boxes are stored as x[], y[], w[], h[] arrays; spawns, zones and
+// objectives as fixed-size records. Strings live in one table and are
+// referenced by offset and length.
+class CompiledMap {
+ public:
+  static constexpr uint32_t VERSION = 1;
+  static constexpr const char* EXTENSION = ".gmap";
+
+  // "maps/arena.tmx" -> "maps/arena.gmap"
+  static std::string pathFor(const std::string& sourcePath);
+  static bool isCompiledPath(const std::string& path);
+
+  // Exists and is no older than its TMX source
+  static bool isUpToDate(const std::string& compiledPath,
+                         const std::string& sourcePath);
+
+  static bool write(const TiledMap& map, const std::string& path);
+
+  // Replaces the contents of `map`. Fails (leaving `map` untouched) on a
+  // missing, truncated or other-version file.
+  static bool read(const std::string& path, TiledMap& map);
+};
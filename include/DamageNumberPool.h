@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+enum class DamageNumberType : uint8_t {
+  Damage,
+  Critical,
+  PlayerDamage,
+  Healing
+};
+
+// DamageNumberPool: Fixed ring buffer of floating combat numbers
+// State is kept as parallel arrays (structure of arrays) and advanced in a
+// single loop per tick. Every number lives equally long, so the oldest is
+// always at the head and expiry just moves the head. When full, a new
+// number replaces the oldest one. Never allocates.
+class DamageNumberPool {
+ public:
+  static constexpr size_t CAPACITY = 512;  // Power of two (index masking)
+
+  static constexpr float DISPLAY_DURATION = 1.0f;  // Seconds to show
+  static constexpr float RISE_SPEED = 30.0f;       // Pixels per second upward
+  static constexpr float FADE_START = 0.5f;  // When to start fading (seconds)
+
+  void spawn(float worldX, float worldY, float amount, DamageNumberType type);
+
+  // Age, rise and fade every live number, then retire expired ones
+  void update(float deltaSeconds);
+
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+
+  // Visit live numbers oldest first:
+  // fn(worldX, worldY, alpha, value, type)
+  template <typename Fn>
+  void forEach(Fn&& fn) const {
+    for (size_t i = 0; i < count; ++i) {
+      size_t slot = (head + i) & MASK;
+      fn(worldX[slot], worldY[slot], alpha[slot], value[slot], type[slot]);
+    }
+  }
+
+ private:
+  static constexpr size_t MASK = CAPACITY - 1;
+  static_assert((CAPACITY & MASK) == 0, "CAPACITY must be a power of two");
+
+  std::array<float, CAPACITY> worldX;
+  std::array<float, CAPACITY> worldY;  // Rises over the number's life
+  std::array<float, CAPACITY> age;
+  std::array<float, CAPACITY> alpha;
+  std::array<int32_t, CAPACITY> value;
+  std::array<DamageNumberType, CAPACITY> type;
+
+  size_t head = 0;  // Oldest live number
+  size_t count = 0;
+};
@@ -1,13 +1,16 @@
 #pragma once
 
-#include <deque>
-#include <string>
+#include <memory>
+#include <vector>
 
+#include "DamageNumberPool.h"
 #include "EventBus.h"
+#include "GlyphAtlas.h"
 
 // Forward declarations
 class Camera;
 class SpriteRenderer;
+class Texture;
 
 // Events published when damage occurs
 struct DamageDealtEvent {
@@ -27,33 +30,34 @@ struct HealingEvent {
 };
 
 // System for rendering floating damage numbers
+// Numbers live in a DamageNumberPool and are drawn as glyph sprites from a
+// built-in GlyphAtlas, all in one batched SpriteRenderer draw.
 class DamageNumberSystem {
  public:
-  DamageNumberSystem(Camera* camera, SpriteRenderer* spriteRenderer);
+  DamageNumberSystem(Camera* camera, SpriteRenderer* spriteRenderer,
+                     EventBus& bus);
+  ~DamageNumberSystem();
 
   void render();
 
- private:
-  struct DamageNumber {
-    float worldX, worldY;  // World position
-    float damageAmount;
-    float creationTime;  // currentTime when created
-    enum class Type { Damage, Critical, PlayerDamage, Healing } type;
-  };
+  const DamageNumberPool& getPool() const { return pool; }
 
+ private:
   Camera* camera;
   SpriteRenderer* spriteRenderer;
-  std::deque<DamageNumber> activeNumbers;
-  float currentTime;
+  DamageNumberPool pool;
+  GlyphAtlas glyphAtlas;
+  std::unique_ptr<Texture> glyphTexture;
+
+  std::vector<Subscription> subscriptions;
 
-  static constexpr float DISPLAY_DURATION = 1.0f;  // Seconds to show
-  static constexpr float RISE_SPEED = 30.0f;       // Pixels per second upward
-  static constexpr float FADE_START = 0.5f;  // When to start fading (seconds)
+  static constexpr float GLYPH_SCALE = 3.0f;  // 5x7 font drawn at 15x21
 
   void onDamageDealt(const DamageDealtEvent& e);
   void onDamageReceived(const DamageReceivedEvent& e);
   void onHealing(const HealingEvent& e);
   void onUpdate(const UpdateEvent& e);
 
-  void renderDamageNumber(const DamageNumber& num);
+  void renderNumber(float worldX, float worldY, float alpha, int32_t value,
+                    DamageNumberType type);
 };
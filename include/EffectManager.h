@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <random>
 #include <unordered_map>
 
 #include "Effect.h"
@@ -9,12 +10,15 @@
 // Forward declarations
 struct Player;
 struct Enemy;
+class Counter;
 class EnemySystem;
 
 // Server-authoritative effect manager
 class EffectManager {
  public:
-  EffectManager();
+  // Seed drives the respawn delay of enemies killed by DoT; pass a fixed
+  // seed for reproducible simulation (replays)
+  explicit EffectManager(uint32_t rngSeed = std::random_device{}());
 
   // Stat modifiers calculated from active effects
   struct StatModifiers {
@@ -75,6 +79,11 @@ class EffectManager {
   // Accumulated time for DoT/HoT ticking
   float accumulatedTime;
 
+  std::mt19937 rng;
+
+  Counter* effectsApplied;
+  Counter* effectsExpired;
+
   // Internal helper methods
   void applyEffectInternal(ActiveEffects& activeEffects, EffectType type,
                            uint8_t stacks, float durationMs, uint32_t sourceId,
@@ -11,7 +11,7 @@
 // Client-side effect tracker for visual display
 class EffectTracker {
  public:
-  EffectTracker();
+  explicit EffectTracker(EventBus& bus);
 
   // Get active effects for an entity
   const std::vector<EffectInstance>& getEffects(uint32_t entityId,
@@ -20,11 +20,40 @@ class EffectTracker {
   // Check if entity has any effects
   bool hasEffects(uint32_t entityId, bool isEnemy) const;
 
+  // Ids of the entities that currently have effects, ascending. Kept up to
+  // date as EffectUpdate packets arrive, so callers never probe ids.
+  const std::vector<uint32_t>& getAffectedEntities(bool isEnemy) const {
+    return isEnemy ? affectedEnemies : affectedPlayers;
+  }
+
+  // Enemy the local player last attacked (0 = none)
+  uint32_t getTargetedEnemy() const { return targetedEnemy; }
+
+  // The affected enemies worth showing: the targeted one plus those
+  // `isOnScreen(id)` accepts. Clears `out`; ids stay ascending.
+  template <typename OnScreen>
+  void collectRelevantEnemies(OnScreen&& isOnScreen,
+                              std::vector<uint32_t>& out) const {
+    out.clear();
+    for (uint32_t id : affectedEnemies) {
+      if (id == targetedEnemy || isOnScreen(id)) {
+        out.push_back(id);
+      }
+    }
+  }
+
  private:
   void onNetworkPacketReceived(const NetworkPacketReceivedEvent& e);
+  // Forget a dead enemy's effects and drop it as the target
+  void removeEnemy(uint32_t enemyId);
 
   std::unordered_map<uint32_t, std::vector<EffectInstance>> playerEffects;
   std::unordered_map<uint32_t, std::vector<EffectInstance>> enemyEffects;
+  std::vector<uint32_t> affectedPlayers;  // Sorted keys of playerEffects
+  std::vector<uint32_t> affectedEnemies;  // Sorted keys of enemyEffects
+  uint32_t targetedEnemy = 0;
+
+  std::vector<Subscription> subscriptions;
 
   static const std::vector<EffectInstance> emptyEffects;
 };
@@ -1,12 +1,14 @@
 #pragma once
 
-#include <deque>
 #include <unordered_map>
 #include <vector>
 
 #include "Enemy.h"
 #include "EventBus.h"
 #include "NetworkProtocol.h"
+#include "ServerClock.h"
+#include "SnapshotBuffer.h"
+#include "config/NetworkConfig.h"
 
 class AnimationSystem;
 
@@ -15,35 +17,64 @@ struct EnemySnapshot {
   float vx, vy;
   float health;
   uint8_t state;
-  uint64_t timestamp;  // Milliseconds since epoch
+  uint32_t serverTick;
+};
+
+// What the renderer needs of an enemy, without copying an Enemy
+struct EnemyRenderState {
+  uint32_t id;
+  float x, y;
+  float health, maxHealth;
+  EnemyState state;
+  const AnimationController* animation;
 };
 
 // Client-side enemy state interpolation
 // Mirrors RemotePlayerInterpolation pattern
 class EnemyInterpolation {
  public:
-  explicit EnemyInterpolation(AnimationSystem* animSystem);
+  // `animSystem` must outlive the interpolation
+  explicit EnemyInterpolation(AnimationSystem* animSystem,
+                              EventBus& bus = EventBus::instance());
+  ~EnemyInterpolation();
 
-  // Update enemy state from network packet
-  void updateEnemyState(const NetworkEnemyState& state);
+  // Update enemy state from a network packet sent on `serverTick`
+  void updateEnemyState(const NetworkEnemyState& state, uint32_t serverTick);
 
   // Remove enemy (when died or despawned)
   void removeEnemy(uint32_t enemyId);
 
-  // Get interpolated enemy state for rendering
-  bool getInterpolatedState(uint32_t enemyId, float interpolation,
+  // Server tick to show enemies at now (see RemotePlayerInterpolation)
+  double getRenderTick() const;
+  ServerClock& getServerClock() { return serverClock; }
+
+  // Get an enemy's state at `renderTick` for rendering
+  bool getInterpolatedState(uint32_t enemyId, double renderTick,
                             Enemy& outEnemy) const;
 
+  // Interpolated position of an enemy at `renderTick`, without copying
+  // it; false if there are no snapshots yet
+  bool samplePosition(uint32_t enemyId, double renderTick, float& x,
+                      float& y) const;
+
   // Get all enemy IDs
   std::vector<uint32_t> getEnemyIds() const;
 
+  // Append every enemy's state at `renderTick` to `out` (allocation-free
+  // once `out` has capacity)
+  void appendRenderStates(double renderTick,
+                          std::vector<EnemyRenderState>& out) const;
+
  private:
   AnimationSystem* animationSystem;
   std::unordered_map<uint32_t, Enemy> enemies;
-  std::unordered_map<uint32_t, std::deque<EnemySnapshot>> snapshots;
-
-  static constexpr size_t MAX_SNAPSHOTS =
-      3;  // Same as RemotePlayerInterpolation
+  using Buffer =
+      SnapshotBuffer<EnemySnapshot, Config::Network::SNAPSHOT_BUFFER_SIZE>;
+  std::unordered_map<uint32_t, Buffer> snapshots;
+  ServerClock serverClock;
 
   void onNetworkPacketReceived(const NetworkPacketReceivedEvent& e);
+
+  EventBus& bus;
+  std::vector<Subscription> subscriptions;
 };
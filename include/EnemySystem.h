@@ -1,5 +1,6 @@
 #pragma once
 
+#include <random>
 #include <unordered_map>
 #include <vector>
 
@@ -8,7 +9,9 @@
 #include "EventBus.h"
 #include "Player.h"
 
+class Counter;
 class EffectManager;
+class Gauge;
 
 // Server-side enemy management system
 // - Spawns enemies from spawn points
@@ -17,7 +20,12 @@ class EffectManager;
 // - Broadcasts enemy state to clients
 class EnemySystem {
  public:
-  explicit EnemySystem(const std::vector<EnemySpawn>& spawns);
+  // rngSeed drives respawn delays; pass a fixed seed for reproducible
+  // simulation (replays)
+  explicit EnemySystem(const std::vector<EnemySpawn>& spawns,
+                       EventBus& bus = EventBus::instance(),
+                       uint32_t rngSeed = std::random_device{}());
+  ~EnemySystem();
 
   // Spawn enemies at all spawn points
   void spawnAllEnemies();
@@ -35,21 +43,10 @@ class EnemySystem {
     return enemies;
   }
 
-  // Enemy death tracking (for broadcasting death events)
-  struct EnemyDeath {
-    uint32_t enemyId;
-    uint32_t killerId;
-  };
-
-  // Get enemies that died this frame (cleared each update)
-  const std::vector<EnemyDeath>& getDiedThisFrame() const {
-    return diedThisFrame;
-  }
-
-  // Record an enemy death (for DoT and other non-combat deaths)
-  void recordDeath(uint32_t enemyId, uint32_t killerId) {
-    diedThisFrame.push_back({enemyId, killerId});
-  }
+  // Record an enemy death (for DoT and other non-combat deaths). Deaths are
+  // queued on the system's EventBus as EnemyDiedEvent for
+  // EventPhase::AfterSimulation.
+  void recordDeath(uint32_t enemyId, uint32_t killerId);
 
   // Disable enemy spawns within a radius (for CaptureOutpost completion)
   // Kills idle enemies in the zone and prevents future respawns there
@@ -64,8 +61,12 @@ class EnemySystem {
   const std::vector<EnemySpawn>& spawns;
   std::unordered_map<uint32_t, Enemy> enemies;  // enemyId -> Enemy
   uint32_t nextEnemyId;
-  std::vector<EnemyDeath> diedThisFrame;  // Cleared each update
   float accumulatedTime;                  // Milliseconds since server start
+  EventBus& bus;
+  std::mt19937 rng;
+
+  Gauge* aliveEnemies;  // Summed over every match
+  Counter* enemyDeaths;
 
   // AI behavior methods
   void updateEnemyAI(Enemy& enemy,
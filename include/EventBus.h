@@ -2,7 +2,9 @@
 
 #include <SDL2/SDL.h>
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <string>
@@ -41,6 +43,11 @@ struct LocalInputEvent {
 
 struct AttackInputEvent {};
 
+// Client-side: the local player sent an attack at this enemy
+struct LocalAttackEvent {
+  uint32_t enemyId;
+};
+
 struct ToggleMuteEvent {};
 
 struct NetworkPacketReceivedEvent {
@@ -72,9 +79,137 @@ struct ObjectiveUpdatedEvent {
   std::string name;  // Objective name for display
 };
 
-// Global singleton event bus for pub-sub architecture
+// Server-side: an enemy died this tick (combat, DoT, or disabled spawn zone).
+// Queued for EventPhase::AfterSimulation so loot, objective progress and the
+// EnemyDied broadcast are handled in one batch per tick.
+struct EnemyDiedEvent {
+  uint32_t enemyId;
+  uint32_t killerId;  // 0 for environmental deaths
+  float x;
+  float y;
+};
+
+// Server-side: a player walked out of range of the objective they were
+// interacting with. Queued so the interaction map is not mutated while it is
+// being iterated.
+struct ObjectiveRangeExitedEvent {
+  uint32_t playerId;
+  uint32_t objectiveId;
+};
+
+// Server-side: a ClientInput packet decoded in the receive path. Queued for
+// EventPhase::AfterNetworkReceive so every input drained by one
+// NetworkServer::poll is applied in one batch. The packet bytes are only
+// lent to receive handlers, so the fields are copied out here.
+struct ClientInputReceivedEvent {
+  uint32_t clientId;
+  uint32_t inputSequence;
+  bool moveLeft;
+  bool moveRight;
+  bool moveUp;
+  bool moveDown;
+};
+
+// Server-side: an AttackEnemy packet decoded in the receive path, queued like
+// ClientInputReceivedEvent
+struct AttackReceivedEvent {
+  uint32_t clientId;
+  uint32_t enemyId;
+  float damage;
+};
+
+// Points in the tick at which queued events are drained (see
+// EventBus::enqueue / EventBus::flush)
+enum class EventPhase : uint8_t {
+  AfterNetworkReceive = 0,  // NetworkServer::poll drained the transport;
+                            // decoded client inputs and attacks are applied
+  AfterSimulation,          // Enemy AI, effects and objectives have updated
+  BeforeBroadcast,          // Last chance to mutate state before StateUpdate
+  Count
+};
+
+// Read-only view over a contiguous run of queued events of one type
+template <typename EventType>
+struct EventSpan {
+  const EventType* data;
+  size_t count;
+
+  const EventType* begin() const { return data; }
+  const EventType* end() const { return data + count; }
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  const EventType& operator[](size_t i) const {
+    assert(i < count && "EventSpan index out of bounds");
+    return data[i];
+  }
+};
+
+using SubscriptionId = uint64_t;
+
+class EventBus;
+
+// RAII handle for a bus subscription: unsubscribes when destroyed. Systems
+// that capture `this` in handlers keep these as members so the bus never
+// calls into a destroyed object. Move-only.
+class Subscription {
+ public:
+  Subscription() = default;
+  Subscription(EventBus& bus, SubscriptionId id) : bus(&bus), id(id) {}
+  ~Subscription() { reset(); }
+
+  Subscription(const Subscription&) = delete;
+  Subscription& operator=(const Subscription&) = delete;
+
+  Subscription(Subscription&& other) noexcept : bus(other.bus), id(other.id) {
+    other.bus = nullptr;
+    other.id = 0;
+  }
+
+  Subscription& operator=(Subscription&& other) noexcept {
+    if (this != &other) {
+      reset();
+      bus = other.bus;
+      id = other.id;
+      other.bus = nullptr;
+      other.id = 0;
+    }
+    return *this;
+  }
+
+  // Unsubscribe now (no-op if already released)
+  inline void reset();
+
+  bool isActive() const { return bus != nullptr; }
+
+ private:
+  EventBus* bus = nullptr;
+  SubscriptionId id = 0;
+};
+
+// Pub-sub event bus
+//
+// Each match/session owns its own EventBus and passes it to the systems it
+// creates; instance() is the default bus used by the client and by code that
+// has not been given one. Subscriptions return a SubscriptionId which can be
+// released with unsubscribe() or wrapped in a Subscription for RAII cleanup.
+//
+// Two delivery modes:
+// - publish(): synchronous and re-entrant, handlers run before it returns
+// - enqueue(): the event is appended to a per-type contiguous arena for the
+//   given phase and delivered when flush(phase) is called. Batch handlers
+//   (subscribeBatch) receive the whole run as one EventSpan; plain handlers
+//   (subscribe) are still called once per event. Events enqueued while a
+//   phase is being flushed land in a fresh arena and are drained by the same
+//   flush, so handlers may safely mutate whatever produced the events.
+//
+// Handlers may subscribe or unsubscribe (including themselves) while an event
+// is being dispatched. New handlers do not see the event in flight; removed
+// handlers are skipped and compacted once dispatch unwinds.
 class EventBus {
  public:
+  EventBus() = default;
+
+  // Process-wide default bus
   static EventBus& instance() {
     static EventBus instance;
     return instance;
@@ -84,7 +219,7 @@ class EventBus {
   EventBus& operator=(const EventBus&) = delete;
 
   template <typename EventType>
-  void subscribe(std::function<void(const EventType&)> handler) {
+  SubscriptionId subscribe(std::function<void(const EventType&)> handler) {
     auto typeIndex = std::type_index(typeid(EventType));
 
     // Wrap typed handler to match void* signature
@@ -93,7 +228,16 @@ class EventBus {
       handler(*event);
     };
 
-    handlers[typeIndex].push_back(wrapper);
+    SubscriptionId id = nextSubscriptionId++;
+    handlers[typeIndex].push_back(
+        std::make_unique<Handler<EventFn>>(Handler<EventFn>{id, wrapper}));
+    return id;
+  }
+
+  // Subscribe and return an RAII handle that unsubscribes on destruction
+  template <typename EventType>
+  Subscription subscribeScoped(std::function<void(const EventType&)> handler) {
+    return Subscription(*this, subscribe<EventType>(std::move(handler)));
   }
 
   template <typename EventType>
@@ -102,18 +246,271 @@ class EventBus {
 
     auto it = handlers.find(typeIndex);
     if (it != handlers.end()) {
-      for (auto& handler : it->second) {
-        handler(&event);
+      dispatch(it->second, &event);
+    }
+  }
+
+  template <typename EventType>
+  SubscriptionId subscribeBatch(
+      std::function<void(EventSpan<EventType>)> handler) {
+    auto typeIndex = std::type_index(typeid(EventType));
+
+    auto wrapper = [handler](const void* eventsPtr, size_t count) {
+      handler(EventSpan<EventType>{static_cast<const EventType*>(eventsPtr),
+                                   count});
+    };
+
+    SubscriptionId id = nextSubscriptionId++;
+    batchHandlers[typeIndex].push_back(
+        std::make_unique<Handler<BatchFn>>(Handler<BatchFn>{id, wrapper}));
+    return id;
+  }
+
+  template <typename EventType>
+  Subscription subscribeBatchScoped(
+      std::function<void(EventSpan<EventType>)> handler) {
+    return Subscription(*this, subscribeBatch<EventType>(std::move(handler)));
+  }
+
+  // Remove a handler registered with subscribe() or subscribeBatch().
+  // Unknown or already removed ids are ignored.
+  void unsubscribe(SubscriptionId id) {
+    if (id == 0) {
+      return;
+    }
+    if (removeHandler(handlers, id)) {
+      return;
+    }
+    removeHandler(batchHandlers, id);
+  }
+
+  // Number of live handlers for an event type (plain + batch)
+  template <typename EventType>
+  size_t subscriberCount() const {
+    auto typeIndex = std::type_index(typeid(EventType));
+    return countLive(handlers, typeIndex) + countLive(batchHandlers, typeIndex);
+  }
+
+  template <typename EventType>
+  void enqueue(const EventType& event, EventPhase phase) {
+    assert(phase < EventPhase::Count && "Invalid event phase");
+    getQueue<EventType>(phase).pending.push_back(event);
+  }
+
+  // Deliver everything queued for a phase. Loops until the phase is empty so
+  // events enqueued by handlers during the flush are delivered too.
+  void flush(EventPhase phase) {
+    assert(phase < EventPhase::Count && "Invalid event phase");
+    size_t phaseIndex = static_cast<size_t>(phase);
+    assert(!flushing[phaseIndex] && "Re-entrant flush of the same phase");
+    flushing[phaseIndex] = true;
+    auto& phaseQueues = queues[phaseIndex];
+
+    bool delivered = true;
+    while (delivered) {
+      delivered = false;
+      // Index loop: a handler may enqueue a type not seen before, which
+      // appends to phaseQueues
+      for (size_t i = 0; i < phaseQueues.size(); ++i) {
+        if (phaseQueues[i]->drain(*this)) {
+          delivered = true;
+        }
+      }
+    }
+    flushing[phaseIndex] = false;
+  }
+
+  bool hasPending(EventPhase phase) const {
+    for (const auto& queue : queues[static_cast<size_t>(phase)]) {
+      if (!queue->empty()) {
+        return true;
       }
     }
+    return false;
   }
 
-  void clear() { handlers.clear(); }
+  // Drops all handlers and queued events. Outstanding Subscription handles
+  // become no-ops (their ids are never reused).
+  void clear() {
+    assert(dispatchDepth == 0 && "EventBus::clear() during dispatch");
+    handlers.clear();
+    batchHandlers.clear();
+    for (size_t i = 0; i < PHASE_COUNT; ++i) {
+      queues[i].clear();
+      queueIndex[i].clear();
+      flushing[i] = false;
+    }
+  }
 
  private:
-  EventBus() = default;
+  static constexpr size_t PHASE_COUNT = static_cast<size_t>(EventPhase::Count);
+
+  using EventFn = std::function<void(const void*)>;
+  using BatchFn = std::function<void(const void*, size_t)>;
+
+  // Heap-allocated so a handler stays put while it runs even if its list
+  // grows. Unsubscribing mid-dispatch only sets `removed`: `fn` may be the
+  // very function running, so it is destroyed by compact() afterwards.
+  template <typename Fn>
+  struct Handler {
+    SubscriptionId id;
+    Fn fn;
+    bool removed = false;
+  };
+
+  template <typename Fn>
+  using HandlerList = std::vector<std::unique_ptr<Handler<Fn>>>;
 
-  std::unordered_map<std::type_index,
-                     std::vector<std::function<void(const void*)>>>
-      handlers;
+  template <typename Fn>
+  using HandlerMap = std::unordered_map<std::type_index, HandlerList<Fn>>;
+
+  struct QueueBase {
+    virtual ~QueueBase() = default;
+    virtual bool empty() const = 0;
+    // Deliver the pending run; returns false if there was nothing to deliver
+    virtual bool drain(EventBus& bus) = 0;
+  };
+
+  // Per-type arena. Events are swapped into `draining` before dispatch so
+  // handlers can enqueue into `pending` without invalidating the span they
+  // are iterating. Both vectors keep their capacity across ticks.
+  template <typename EventType>
+  struct EventQueue : QueueBase {
+    std::vector<EventType> pending;
+    std::vector<EventType> draining;
+
+    bool empty() const override { return pending.empty(); }
+
+    bool drain(EventBus& bus) override {
+      if (pending.empty()) {
+        return false;
+      }
+      std::swap(pending, draining);
+      bus.dispatchBatch<EventType>(
+          EventSpan<EventType>{draining.data(), draining.size()});
+      draining.clear();
+      return true;
+    }
+  };
+
+  template <typename EventType>
+  EventQueue<EventType>& getQueue(EventPhase phase) {
+    size_t phaseIndex = static_cast<size_t>(phase);
+    auto typeIndex = std::type_index(typeid(EventType));
+
+    auto it = queueIndex[phaseIndex].find(typeIndex);
+    if (it != queueIndex[phaseIndex].end()) {
+      return *static_cast<EventQueue<EventType>*>(it->second);
+    }
+
+    auto queue = std::make_unique<EventQueue<EventType>>();
+    EventQueue<EventType>* raw = queue.get();
+    queues[phaseIndex].push_back(std::move(queue));
+    queueIndex[phaseIndex][typeIndex] = raw;
+    return *raw;
+  }
+
+  template <typename EventType>
+  void dispatchBatch(EventSpan<EventType> events) {
+    auto typeIndex = std::type_index(typeid(EventType));
+
+    auto batchIt = batchHandlers.find(typeIndex);
+    if (batchIt != batchHandlers.end()) {
+      dispatch(batchIt->second, events.data, events.count);
+    }
+
+    auto it = handlers.find(typeIndex);
+    if (it != handlers.end()) {
+      for (const auto& event : events) {
+        dispatch(it->second, &event);
+      }
+    }
+  }
+
+  // Calls every live handler that existed when dispatch started. Index loop
+  // with a fixed count: handlers appended during dispatch are not called and
+  // reallocation of the list does not move the Handler objects.
+  template <typename Fn, typename... Args>
+  void dispatch(HandlerList<Fn>& list, Args... args) {
+    ++dispatchDepth;
+    size_t count = list.size();
+    for (size_t i = 0; i < count; ++i) {
+      Handler<Fn>* handler = list[i].get();
+      if (!handler->removed) {
+        handler->fn(args...);
+      }
+    }
+    if (--dispatchDepth == 0 && needsCompaction) {
+      compact(handlers);
+      compact(batchHandlers);
+      needsCompaction = false;
+    }
+  }
+
+  template <typename Fn>
+  bool removeHandler(HandlerMap<Fn>& map, SubscriptionId id) {
+    for (auto& [typeIndex, list] : map) {
+      for (size_t i = 0; i < list.size(); ++i) {
+        if (list[i]->id != id || list[i]->removed) {
+          continue;
+        }
+        if (dispatchDepth > 0) {
+          // Handler (or one before it) may be running; tombstone it
+          list[i]->removed = true;
+          needsCompaction = true;
+        } else {
+          list.erase(list.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+
+  template <typename Fn>
+  static void compact(HandlerMap<Fn>& map) {
+    for (auto& [typeIndex, list] : map) {
+      list.erase(std::remove_if(list.begin(), list.end(),
+                                [](const std::unique_ptr<Handler<Fn>>& h) {
+                                  return h->removed;
+                                }),
+                 list.end());
+    }
+  }
+
+  template <typename Fn>
+  static size_t countLive(const HandlerMap<Fn>& map,
+                          std::type_index typeIndex) {
+    auto it = map.find(typeIndex);
+    if (it == map.end()) {
+      return 0;
+    }
+    size_t live = 0;
+    for (const auto& handler : it->second) {
+      if (!handler->removed) {
+        live++;
+      }
+    }
+    return live;
+  }
+
+  HandlerMap<EventFn> handlers;
+  HandlerMap<BatchFn> batchHandlers;
+
+  SubscriptionId nextSubscriptionId = 1;
+  int dispatchDepth = 0;
+  bool needsCompaction = false;
+
+  // Queues in first-use order so flush order is deterministic
+  std::vector<std::unique_ptr<QueueBase>> queues[PHASE_COUNT];
+  std::unordered_map<std::type_index, QueueBase*> queueIndex[PHASE_COUNT];
+  bool flushing[PHASE_COUNT] = {};
 };
+
+inline void Subscription::reset() {
+  if (bus != nullptr) {
+    bus->unsubscribe(id);
+    bus = nullptr;
+    id = 0;
+  }
+}
@@ -3,13 +3,15 @@
 #include <chrono>
 #include <functional>
 
+#include "EventBus.h"
+
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
 #endif
 
 class GameLoop {
  public:
-  GameLoop();
+  explicit GameLoop(EventBus& bus = EventBus::instance());
 
   void run();
   void tick();  // Single iteration — called by run() or emscripten main loop
@@ -18,6 +20,7 @@ class GameLoop {
   bool isRunning() const { return running; }
 
  private:
+  EventBus& bus;
   bool running;
   uint64_t frameNumber;
   float accumulator = 0.0f;
@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include "EventBus.h"
 #include "InMemoryChannel.h"
 
 class NetworkClient;
@@ -22,6 +23,9 @@ struct WorldConfig;
 //
 // The session owns the server-side state and transport. The client
 // transport communicates with the server via InMemoryChannel.
+//
+// Server systems run on the session's own EventBus, so server-side events
+// never reach client subscribers on EventBus::instance() and vice versa.
 
 class GameSession {
  public:
@@ -37,13 +41,16 @@ class GameSession {
   // Access server state for debugging/testing
   ServerGameState* getServerState() { return serverGameState.get(); }
 
-  // Tick both server and client (call from game loop)
-  // This processes messages in both directions
-  void tick();
+  // Tick both server and client (call from the client's UpdateEvent handler)
+  // Advances the server simulation by one update, then processes messages in
+  // both directions
+  void tick(const UpdateEvent& update);
 
  private:
   GameSession();
 
+  // Declared first so it outlives every server system subscribed to it
+  std::unique_ptr<EventBus> serverBus;
   std::shared_ptr<InMemoryChannel> channel;
   std::unique_ptr<NetworkServer> server;
   std::unique_ptr<NetworkClient> client;
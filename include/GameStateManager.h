@@ -1,5 +1,9 @@
 #pragma once
 
+#include <future>
+#include <map>
+#include <vector>
+
 #include "GameState.h"
 
 class GameStateManager {
@@ -9,6 +13,12 @@ class GameStateManager {
   GameState getCurrentState() const { return currentState; }
   void transitionTo(GameState newState);
 
+  // Loading gates: asset futures a screen needs before it is complete.
+  // Screens poll isLoaded() each frame (it never blocks) and show a
+  // loading state until it turns true.
+  void addLoadingFuture(GameState state, std::shared_future<void> future);
+  bool isLoaded(GameState state) const;
+
   // Prevent copying
   GameStateManager(const GameStateManager&) = delete;
   GameStateManager& operator=(const GameStateManager&) = delete;
@@ -16,4 +26,5 @@ class GameStateManager {
  private:
   GameStateManager() : currentState(GameState::MainMenu) {}
   GameState currentState;
+  std::map<GameState, std::vector<std::shared_future<void>>> loadingFutures;
 };
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// GlyphAtlas: Built-in 5x7 bitmap font for floating combat text
+// Rasterized once into an RGBA strip (white glyphs, transparent
+// background) so text can be tinted and drawn as ordinary sprites.
+// Covers digits and "+-!", which is all damage numbers need.
+class GlyphAtlas {
+ public:
+  static constexpr int GLYPH_WIDTH = 5;
+  static constexpr int GLYPH_HEIGHT = 7;
+
+  GlyphAtlas();
+
+  const std::vector<uint8_t>& getPixels() const { return pixels; }
+  int getWidth() const { return width; }
+  int getHeight() const { return height; }
+
+  // Top-left of a character's glyph in the atlas; false if not covered
+  bool getGlyph(char c, int& srcX, int& srcY) const;
+
+ private:
+  std::vector<uint8_t> pixels;
+  int width;
+  int height;
+};
@@ -1,12 +1,14 @@
 #pragma once
 
+#include <vector>
+
 #include "EventBus.h"
 
 // Headless rendering system for testing
 // Subscribes to RenderEvent but performs no actual rendering
 class HeadlessRenderSystem {
  public:
-  HeadlessRenderSystem();
+  explicit HeadlessRenderSystem(EventBus& bus);
   ~HeadlessRenderSystem() = default;
 
   // No-op sprite renderer access (returns nullptr)
@@ -14,4 +16,6 @@ class HeadlessRenderSystem {
 
  private:
   void onRender(const RenderEvent& e);
+
+  std::vector<Subscription> subscriptions;
 };
@@ -1,12 +1,14 @@
 #pragma once
 
+#include <vector>
+
 #include "EventBus.h"
 
 // Headless UI system for testing
 // Subscribes to RenderEvent and game events but performs no actual UI rendering
 class HeadlessUISystem {
  public:
-  HeadlessUISystem();
+  explicit HeadlessUISystem(EventBus& bus);
   ~HeadlessUISystem() = default;
 
   // No-op render method for compatibility
@@ -15,4 +17,6 @@ class HeadlessUISystem {
  private:
   void onRender(const RenderEvent& e);
   void onItemPickedUp(const ItemPickedUpEvent& e);
+
+  std::vector<Subscription> subscriptions;
 };
@@ -1,80 +1,54 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
-#include <mutex>
-#include <queue>
-#include <vector>
+
+#include "SpscByteRing.h"
+#include "config/NetworkConfig.h"
 
 // InMemoryChannel: Shared bidirectional message queue for embedded server mode
 // Used by InMemoryTransport (client) and InMemoryServerTransport (server)
 // to communicate without actual network sockets.
 //
-// Thread-safety: Uses mutex for queue access. Safe for use when client and
-// server tick on the same thread (synchronous) or different threads.
+// Thread-safety: Each direction is a lock-free single-producer/single-consumer
+// ring, so the client and server may tick on the same thread or on two
+// different threads, but each side must stay on one thread.
 
 struct InMemoryChannel {
+  InMemoryChannel(size_t serverToClientBytes, size_t clientToServerBytes)
+      : serverToClient(serverToClientBytes),
+        clientToServer(clientToServerBytes) {}
+
   // Messages from server to client
-  std::queue<std::vector<uint8_t>> serverToClient;
-  std::mutex serverToClientMutex;
+  SpscByteRing serverToClient;
 
   // Messages from client to server
-  std::queue<std::vector<uint8_t>> clientToServer;
-  std::mutex clientToServerMutex;
+  SpscByteRing clientToServer;
 
   // Connection state
-  bool connected = false;
-  bool clientWantsConnect = false;
-  bool clientWantsDisconnect = false;
-
-  // Push a message from client to server
-  void pushClientToServer(const uint8_t* data, size_t length) {
-    std::lock_guard<std::mutex> lock(clientToServerMutex);
-    clientToServer.emplace(data, data + length);
-  }
-
-  // Push a message from server to client
-  void pushServerToClient(const uint8_t* data, size_t length) {
-    std::lock_guard<std::mutex> lock(serverToClientMutex);
-    serverToClient.emplace(data, data + length);
-  }
-
-  // Pop a message destined for client (returns empty if none)
-  std::vector<uint8_t> popServerToClient() {
-    std::lock_guard<std::mutex> lock(serverToClientMutex);
-    if (serverToClient.empty()) {
-      return {};
-    }
-    auto msg = std::move(serverToClient.front());
-    serverToClient.pop();
-    return msg;
-  }
-
-  // Pop a message destined for server (returns empty if none)
-  std::vector<uint8_t> popClientToServer() {
-    std::lock_guard<std::mutex> lock(clientToServerMutex);
-    if (clientToServer.empty()) {
-      return {};
-    }
-    auto msg = std::move(clientToServer.front());
-    clientToServer.pop();
-    return msg;
-  }
-
-  // Check if there are messages for the client
-  bool hasServerToClient() {
-    std::lock_guard<std::mutex> lock(serverToClientMutex);
-    return !serverToClient.empty();
-  }
-
-  // Check if there are messages for the server
-  bool hasClientToServer() {
-    std::lock_guard<std::mutex> lock(clientToServerMutex);
-    return !clientToServer.empty();
-  }
+  std::atomic<bool> connected{false};
+  std::atomic<bool> clientWantsConnect{false};
+  std::atomic<bool> clientWantsDisconnect{false};
 };
 
-// Factory for creating a shared channel
-inline std::shared_ptr<InMemoryChannel> createInMemoryChannel() {
-  return std::make_shared<InMemoryChannel>();
+// Whether the transports should log a ring's drop number `droppedSoFar`:
+// the first, then each power of two, so a stalled consumer costs a handful
+// of log lines rather than one per message. The ring's dropped count keeps
+// the full total.
+inline bool shouldLogRingDrop(uint64_t droppedSoFar) {
+  return (droppedSoFar & (droppedSoFar - 1)) == 0;
+}
+
+// Factory for creating a shared channel. A full ring drops messages (and the
+// transports log it), so the server-to-client side must hold a whole tick of
+// state.
+inline std::shared_ptr<InMemoryChannel> createInMemoryChannel(
+    size_t serverToClientBytes =
+        Config::Network::IN_MEMORY_SERVER_TO_CLIENT_BYTES,
+    size_t clientToServerBytes =
+        Config::Network::IN_MEMORY_CLIENT_TO_SERVER_BYTES) {
+  return std::make_shared<InMemoryChannel>(serverToClientBytes,
+                                           clientToServerBytes);
 }
@@ -6,6 +6,8 @@
 #include <string>
 #include <vector>
 
+#include "EventBus.h"
+
 // Input action to be executed at a specific frame
 struct InputAction {
   uint64_t frame;     // Frame number when this action should execute
@@ -18,7 +20,8 @@ struct InputAction {
 // Allows programmatic or file-based input injection
 class InputScript {
  public:
-  InputScript();
+  // Key events are published on `bus`
+  explicit InputScript(EventBus& bus);
   ~InputScript();
 
   // Add a key press action (press and release)
@@ -44,6 +47,7 @@ class InputScript {
   void clear();
 
  private:
+  EventBus& bus;
   std::vector<InputAction> actions;
   size_t nextActionIndex;  // Index of next action to process
 };
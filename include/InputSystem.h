@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "CollisionDebugRenderer.h"
 #include "EventBus.h"
 #include "MusicZoneDebugRenderer.h"
@@ -9,10 +11,11 @@ class ClientPrediction;
 
 class InputSystem {
  public:
+  // Debug renderers may be null (headless clients, tests)
   InputSystem(ClientPrediction* clientPrediction,
-              CollisionDebugRenderer* collisionDebugRenderer = nullptr,
-              MusicZoneDebugRenderer* musicZoneDebugRenderer = nullptr,
-              ObjectiveDebugRenderer* objectiveDebugRenderer = nullptr);
+              CollisionDebugRenderer* collisionDebugRenderer,
+              MusicZoneDebugRenderer* musicZoneDebugRenderer,
+              ObjectiveDebugRenderer* objectiveDebugRenderer, EventBus& bus);
 
  private:
   bool moveLeft;
@@ -25,6 +28,8 @@ class InputSystem {
   CollisionDebugRenderer* collisionDebugRenderer;
   MusicZoneDebugRenderer* musicZoneDebugRenderer;
   ObjectiveDebugRenderer* objectiveDebugRenderer;
+  EventBus& bus;
+  std::vector<Subscription> subscriptions;
 
   void onKeyDown(const KeyDownEvent& e);
   void onKeyUp(const KeyUpEvent& e);
@@ -1,11 +1,119 @@
 #pragma once
 
+#include <spdlog/fmt/fmt.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <string>
+#include <utility>
+
+// Severity, lowest first
+enum class LogLevel : uint8_t { Debug, Info, Error, Off };
+
+// Parts of the game that can be given their own level (see
+// Logger::configure)
+enum class LogSubsystem : uint8_t {
+  General,
+  Network,
+  Combat,
+  Enemy,
+  Effect,
+  Render,
+  Audio,
+  Count
+};
 
+// Format-string calls below this level are compiled out. Release builds
+// drop debug logging unless built with -DGAMBIT_LOG_MIN_LEVEL=0.
+#ifndef GAMBIT_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define GAMBIT_LOG_MIN_LEVEL 1
+#else
+#define GAMBIT_LOG_MIN_LEVEL 0
+#endif
+#endif
+
+// Logger: Front end over spdlog
+// After init(), lines go into a bounded queue drained by a background
+// thread, so a tick never waits on the console (on WASM, which has no
+// threads, they are written directly). When the queue is full the oldest
+// line is dropped rather than blocking.
+//
+// Prefer the format-string overloads on hot paths:
+//   Logger::debug(LogSubsystem::Enemy, "Enemy {} took {} damage", id, dmg);
+// They check the subsystem's level before formatting anything, so a
+// disabled line costs one relaxed load. The string overloads log as
+// General and are kept for cold paths.
 class Logger {
  public:
+  // Idempotent. Also applies the GAMBIT_LOG environment variable, if set,
+  // as a configure() spec.
   static void init();
+
+  // Write out queued lines and stop the writer thread. Registered to run
+  // at exit by init().
+  static void shutdown();
+
   static void info(const std::string& message);
   static void debug(const std::string& message);
   static void error(const std::string& message);
+
+  template <typename... Args>
+  static void debug(LogSubsystem subsystem, fmt::format_string<Args...> format,
+                    Args&&... args) {
+    log<LogLevel::Debug>(subsystem, format, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  static void info(LogSubsystem subsystem, fmt::format_string<Args...> format,
+                   Args&&... args) {
+    log<LogLevel::Info>(subsystem, format, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  static void error(LogSubsystem subsystem, fmt::format_string<Args...> format,
+                    Args&&... args) {
+    log<LogLevel::Error>(subsystem, format, std::forward<Args>(args)...);
+  }
+
+  // Runtime levels, Info for every subsystem by default
+  static void setLevel(LogSubsystem subsystem, LogLevel level);
+  static LogLevel getLevel(LogSubsystem subsystem);
+  static bool isEnabled(LogSubsystem subsystem, LogLevel level) {
+    return static_cast<uint8_t>(level) >=
+           levels[static_cast<size_t>(subsystem)].load(
+               std::memory_order_relaxed);
+  }
+
+  // Set levels from a spec such as "info,enemy=debug,network=error": a bare
+  // level applies to every subsystem, name=level to one. Returns false
+  // (and logs why) if any part was not understood; the rest still apply.
+  static bool configure(const std::string& spec);
+
+  static const char* getSubsystemName(LogSubsystem subsystem);
+
+ private:
+  static std::atomic<uint8_t>
+      levels[static_cast<size_t>(LogSubsystem::Count)];
+
+  static void write(LogLevel level, LogSubsystem subsystem,
+                    fmt::string_view message);
+
+  template <LogLevel level, typename... Args>
+  static void log(LogSubsystem subsystem, fmt::format_string<Args...> format,
+                  Args&&... args) {
+    if constexpr (static_cast<int>(level) >= GAMBIT_LOG_MIN_LEVEL) {
+      if (!isEnabled(subsystem, level)) return;
+      fmt::memory_buffer buffer;
+      fmt::format_to(std::back_inserter(buffer), format,
+                     std::forward<Args>(args)...);
+      write(level, subsystem, fmt::string_view(buffer.data(), buffer.size()));
+    } else {
+      (void)subsystem;
+      (void)format;
+      ((void)args, ...);
+    }
+  }
 };
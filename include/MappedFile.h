@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// MappedFile: Read-only view of a whole file
+// Uses mmap where available, so processes opening the same file share its
+// pages; elsewhere the file is read into memory. The data pointer is page
+// aligned (or malloc aligned) and stays valid until the object is
+// destroyed.
+class MappedFile {
+ public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  bool open(const std::string& path);
+
+  const uint8_t* getData() const { return data; }
+  size_t getSize() const { return size; }
+
+ private:
+  void close();
+
+  const uint8_t* data = nullptr;
+  size_t size = 0;
+  bool mapped = false;
+  std::vector<uint8_t> buffer;  // Used when the file is read, not mapped
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "EventBus.h"
+#include "WorldConfig.h"
+#include "transport/IServerTransport.h"
+
+class NetworkServer;
+class ReplayRecorder;
+class ServerGameState;
+
+// Match: One independent game hosted inside a server process
+// Owns its EventBus, NetworkServer and ServerGameState. Map data comes in
+// through a WorldConfig that is only read, so many matches can share one
+// SharedWorld. tick() must never run on two threads at once; MatchScheduler
+// guarantees that, and tick() asserts it.
+class Match {
+ public:
+  // Takes ownership of the transport. Replays pass the recorded seed.
+  Match(uint32_t matchId, std::unique_ptr<IServerTransport> transport,
+        const WorldConfig& world,
+        uint32_t rngSeed = std::random_device{}());
+  ~Match();
+
+  Match(const Match&) = delete;
+  Match& operator=(const Match&) = delete;
+
+  bool initialize(const std::string& address, uint16_t port);
+
+  // Log every input from the first tick on; mapPath is stored in the log so
+  // the Replay tool can rebuild the same world
+  bool startRecording(const std::string& path, const std::string& mapPath);
+
+  // Advance one fixed 60 Hz step: simulation first, then network poll
+  // (same order as the single-match server loop)
+  void tick();
+
+  uint32_t getId() const { return id; }
+  uint64_t getFrameNumber() const { return frameNumber; }
+  EventBus& getEventBus() { return bus; }
+  ServerGameState* getGameState() { return gameState.get(); }
+  NetworkServer* getServer() { return server.get(); }
+
+ private:
+  uint32_t id;
+  uint64_t frameNumber = 0;
+  std::atomic<bool> ticking{false};
+
+  // Declared before the systems subscribed to it
+  EventBus bus;
+  std::unique_ptr<NetworkServer> server;
+  std::unique_ptr<ServerGameState> gameState;
+  std::unique_ptr<ReplayRecorder> recorder;
+};
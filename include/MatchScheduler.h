@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class Match;
+
+// MatchScheduler: Runs many Matches on a fixed pool of worker threads
+//
+// Each round (one 60 Hz server tick) every registered match is ticked exactly
+// once. Workers claim matches from a shared atomic cursor, so load balances
+// across threads, and a round only ends once every claimed tick has finished.
+// A match is therefore never ticked on two threads at once, and consecutive
+// ticks of the same match are ordered by the round barrier even if different
+// workers run them.
+class MatchScheduler {
+ public:
+  explicit MatchScheduler(size_t threadCount);
+  ~MatchScheduler();
+
+  MatchScheduler(const MatchScheduler&) = delete;
+  MatchScheduler& operator=(const MatchScheduler&) = delete;
+
+  // Register a match (not owned). Only valid before the first round.
+  void addMatch(Match* match);
+
+  // Tick every match once and block until all of them are done
+  void tickAll();
+
+  // Call tickAll() at the fixed 60 Hz rate until `running` becomes false
+  void run(const volatile bool& running);
+
+  size_t getMatchCount() const { return matches.size(); }
+  size_t getThreadCount() const { return workers.size(); }
+  uint64_t getRoundCount() const { return roundNumber; }
+
+ private:
+  std::vector<Match*> matches;
+  std::vector<std::thread> workers;
+
+  std::mutex mutex;
+  std::condition_variable roundStarted;
+  std::condition_variable roundFinished;
+  uint64_t roundNumber = 0;     // Guarded by mutex
+  size_t pendingMatches = 0;    // Guarded by mutex
+  bool stopping = false;        // Guarded by mutex
+  std::atomic<size_t> nextMatch{0};
+
+  void workerLoop();
+};
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Monotonic count. Each thread adds to its own cache line, so ticking
+// matches on several workers never contend; value() sums the shards.
+class Counter {
+ public:
+  void add(uint64_t n = 1) {
+    shards[shardIndex()].value.fetch_add(n, std::memory_order_relaxed);
+  }
+  uint64_t value() const;
+
+  // Shard the calling thread adds to (threads are spread round-robin)
+  static size_t shardIndex();
+
+  static constexpr size_t SHARD_COUNT = 16;
+
+ private:
+  struct alignas(64) Shard {
+    std::atomic<uint64_t> value{0};
+  };
+  std::array<Shard, SHARD_COUNT> shards;
+};
+
+// Value that goes up and down (entity counts, RTT)
+class Gauge {
+ public:
+  void set(double v) { bits.store(v, std::memory_order_relaxed); }
+  void add(double delta);
+  double value() const { return bits.load(std::memory_order_relaxed); }
+
+ private:
+  std::atomic<double> bits{0.0};
+};
+
+// Counts of observations at or below each upper bound, plus their sum
+class Histogram {
+ public:
+  explicit Histogram(std::vector<double> upperBounds);
+
+  void observe(double v);
+
+  const std::vector<double>& getUpperBounds() const { return upperBounds; }
+  // Not cumulative; the last entry counts values above every bound
+  uint64_t bucketCount(size_t i) const {
+    return buckets[i].load(std::memory_order_relaxed);
+  }
+  uint64_t count() const;
+  double sum() const { return total.value(); }
+
+ private:
+  std::vector<double> upperBounds;  // Ascending
+  std::unique_ptr<std::atomic<uint64_t>[]> buckets;
+  Gauge total;
+};
+
+// MetricsRegistry: Process-wide named metrics, exported as Prometheus text
+// Registering takes a lock and is meant for setup (constructors, new
+// connections); updating a metric is lock-free. Asking for a name and label
+// set that already exists returns the same metric, so every Match reports
+// into shared series. Metrics live until removed or the process exits.
+class MetricsRegistry {
+ public:
+  static MetricsRegistry& instance();
+
+  // `labels` is the inside of the braces, e.g. R"(type="StateUpdate")"
+  Counter& counter(const std::string& name, const std::string& help,
+                   const std::string& labels = "");
+  Gauge& gauge(const std::string& name, const std::string& help,
+               const std::string& labels = "");
+  Histogram& histogram(const std::string& name, const std::string& help,
+                       const std::vector<double>& upperBounds,
+                       const std::string& labels = "");
+
+  // Drop one series (e.g., a disconnected client's RTT). References to it
+  // become invalid.
+  void remove(const std::string& name, const std::string& labels);
+
+  // Everything in the text exposition format, families in registration
+  // order
+  std::string renderPrometheus() const;
+
+ private:
+  enum class Type { Counter, Gauge, Histogram };
+
+  struct Series {
+    std::string labels;
+    std::unique_ptr<Counter> counter;
+    std::unique_ptr<Gauge> gauge;
+    std::unique_ptr<Histogram> histogram;
+  };
+
+  struct Family {
+    std::string name;
+    std::string help;
+    Type type;
+    std::vector<Series> series;
+  };
+
+  mutable std::mutex mutex;
+  std::vector<Family> families;
+
+  Series& findOrAdd(const std::string& name, const std::string& help,
+                    Type type, const std::string& labels);
+};
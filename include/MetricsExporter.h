@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+class MetricsRegistry;
+
+// MetricsExporter: Publishes a MetricsRegistry in Prometheus text format
+// from a background thread, so scraping never touches a tick.
+//
+// `target` is either a file path, rewritten every interval (via a temporary
+// file and rename, so readers never see half a file), or "unix:<path>", a
+// Unix socket that answers each connection with the current text and
+// closes it (e.g. `curl --unix-socket <path> http://x/`).
+class MetricsExporter {
+ public:
+  MetricsExporter(MetricsRegistry& registry, std::string target,
+                  int intervalMs);
+  ~MetricsExporter();
+
+  MetricsExporter(const MetricsExporter&) = delete;
+  MetricsExporter& operator=(const MetricsExporter&) = delete;
+
+  // False (and logs why) if the socket can't be bound
+  bool start();
+  void stop();
+
+  // Write the file once now (file targets only)
+  bool writeFile() const;
+
+ private:
+  MetricsRegistry& registry;
+  std::string target;
+  int intervalMs;
+  int listenFd = -1;
+
+  std::thread thread;
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::atomic<bool> stopping{false};
+
+  bool isSocket() const;
+  std::string socketPath() const;
+
+  void fileLoop();
+  void socketLoop();
+};
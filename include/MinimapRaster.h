@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "CollisionShape.h"
+#include "Objective.h"
+
+// MinimapRaster: The still parts of the minimap as an RGBA image
+// Pure pixel math (no GL, no tmxlite), like TileChunkGrid, so it can be
+// tested directly. Terrain (tiles and collision) is baked once per map;
+// objectives are drawn over a copy of it whenever their state changes.
+// The image covers a world of worldWidth x worldHeight centered on the
+// origin, the same frame the minimap plots entities in.
+class MinimapRaster {
+ public:
+  MinimapRaster(int width, int height);
+
+  // Rasterize tile layers (width * height gids each, nullptr = empty) and
+  // collision shapes. Leaves the image showing just the terrain.
+  void bakeTerrain(int mapWidth, int mapHeight, int tileWidth, int tileHeight,
+                   const std::vector<const uint32_t*>& tileLayers,
+                   const std::vector<CollisionShape>& collisionShapes,
+                   float worldWidth, float worldHeight);
+
+  // Drop everything drawn over the terrain
+  void clearOverlay();
+
+  // Ring in the objective's state color, plus its deposit point diamond
+  // unless it is completed
+  void drawObjective(float x, float y, float radius, ObjectiveState state,
+                     float depositX, float depositY);
+
+  // World position to (fractional) pixel position
+  void worldToPixel(float wx, float wy, float& px, float& py) const;
+
+  int getWidth() const { return width; }
+  int getHeight() const { return height; }
+  const std::vector<uint8_t>& getPixels() const { return pixels; }
+
+ private:
+  int width, height;
+  float worldWidth = 1.0f, worldHeight = 1.0f;
+  std::vector<uint8_t> terrain;  // Baked tiles and collision
+  std::vector<uint8_t> pixels;   // terrain plus overlay
+
+  void setPixel(int px, int py, uint32_t rgba);
+  void fillCircle(float cx, float cy, float radius, uint32_t rgba);
+  void strokeCircle(float cx, float cy, float radius, uint32_t rgba);
+  void fillDiamond(float cx, float cy, float halfSize, uint32_t rgba);
+};
@@ -2,15 +2,17 @@
 
 #include <SDL_mixer.h>
 
+#include <future>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "EventBus.h"
 #include "MusicZone.h"
 
 // Forward declarations
 class ClientPrediction;
 class TiledMap;
-struct UpdateEvent;
 
 class MusicSystem {
  public:
@@ -23,7 +25,8 @@ class MusicSystem {
   static constexpr int SDL_MIXER_MAX_VOLUME = 128;  // SDL_mixer volume range
   static constexpr int LOOP_FOREVER = -1;           // SDL_mixer loop infinite
 
-  MusicSystem(const ClientPrediction* prediction, const TiledMap* map);
+  MusicSystem(const ClientPrediction* prediction, const TiledMap* map,
+              EventBus& bus);
   ~MusicSystem();
 
   // Manually trigger music change (for future event-based system)
@@ -36,13 +39,18 @@ class MusicSystem {
   const TiledMap* tiledMap;
 
   std::unordered_map<std::string, Mix_Music*> loadedTracks;
+  // Zone tracks opened on AssetLoader workers, claimed by loadMusic()
+  std::unordered_map<std::string, std::future<Mix_Music*>> pendingTracks;
   std::string currentTrack;
   std::string currentZoneName;
   float volume;
   bool muted;
 
+  std::vector<Subscription> subscriptions;
+
   void onUpdate(const UpdateEvent& e);
-  void onToggleMute(const struct ToggleMuteEvent& e);
+  void onToggleMute(const ToggleMuteEvent& e);
   void checkZoneTransition();
+  void prefetchZoneTracks();
   Mix_Music* loadMusic(const std::string& filename);
 };
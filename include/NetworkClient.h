@@ -5,12 +5,15 @@
 #include <string>
 #include <vector>
 
+#include "EventBus.h"
 #include "transport/INetworkTransport.h"
 
 class NetworkClient {
  public:
-  // Takes ownership of the transport
-  explicit NetworkClient(std::unique_ptr<INetworkTransport> transport);
+  // Takes ownership of the transport. Received packets are published on
+  // `bus`.
+  explicit NetworkClient(std::unique_ptr<INetworkTransport> transport,
+                         EventBus& bus = EventBus::instance());
   ~NetworkClient();
 
   bool connect(const std::string& host, uint16_t port);
@@ -21,4 +24,6 @@ class NetworkClient {
 
  private:
   std::unique_ptr<INetworkTransport> transport;
+  TransportEvent incoming;  // Reused by every run()
+  EventBus& bus;
 };
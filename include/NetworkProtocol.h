@@ -90,6 +90,7 @@ struct NetworkEnemyState {
 
 struct EnemyStateUpdatePacket {
   PacketType type = PacketType::EnemyStateUpdate;
+  uint32_t serverTick;  // Same tick as the StateUpdate sent with it
   std::vector<NetworkEnemyState> enemies;
 };
 
@@ -288,6 +289,10 @@ ObjectiveInteractPacket deserializeObjectiveInteract(const uint8_t* data,
                                                      size_t size);
 ShipLocationPacket deserializeShipLocation(const uint8_t* data, size_t size);
 
+// Name of a packet type byte for logs and metrics ("Unknown" if it isn't
+// one)
+const char* packetTypeName(uint8_t type);
+
 // Helper functions for binary I/O
 void writeUint32(std::vector<uint8_t>& buffer, uint32_t value);
 void writeInt32(std::vector<uint8_t>& buffer, int32_t value);
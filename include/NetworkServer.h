@@ -1,16 +1,23 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "EventBus.h"
 #include "transport/IServerTransport.h"
 
+class Counter;
+
 class NetworkServer {
  public:
-  // Takes ownership of the transport
-  explicit NetworkServer(std::unique_ptr<IServerTransport> transport);
+  // Takes ownership of the transport. Connection and packet events are
+  // published on `bus`.
+  explicit NetworkServer(std::unique_ptr<IServerTransport> transport,
+                         EventBus& bus = EventBus::instance());
   ~NetworkServer();
 
   bool initialize(const std::string& address, uint16_t port);
@@ -21,7 +28,25 @@ class NetworkServer {
   void broadcastPacket(const std::vector<uint8_t>& data);
   void send(uint32_t clientId, const std::vector<uint8_t>& data);
 
+  // Bytes serialized and handed to the transport (a broadcast counts once)
+  uint64_t getBytesSent() const { return bytesSent; }
+
  private:
   std::unique_ptr<IServerTransport> transport;
+  TransportEvent incoming;  // Reused by every poll()
+  EventBus& bus;
   bool running;
+
+  // Packets and bytes by packet type byte; the series are process-wide
+  struct TrafficCounters {
+    Counter* packets;
+    Counter* bytes;
+  };
+  using Traffic = std::array<TrafficCounters, 256>;
+  Traffic sent;
+  Traffic received;
+  uint64_t bytesSent = 0;
+
+  static void registerTraffic(Traffic& traffic, const char* direction);
+  static void count(Traffic& traffic, const uint8_t* data, size_t size);
 };
@@ -17,7 +17,30 @@ GLuint compileShader(GLenum type, const char* source);
 GLuint createShaderProgram(const char* vertexSource,
                            const char* fragmentSource);
 
-// Check for OpenGL errors and log them
-void checkGLError(const char* operation);
+// Opt-in GL debug layer. Off by default: markCallSite() is then a flag
+// check and the frame loop never calls glGetError, which stalls the
+// pipeline on many drivers. Enabled by the client's --gl-debug flag, or by
+// default in builds configured with -DENABLE_GL_DEBUG=ON.
+enum class DebugMode {
+  Off,
+  Callback,    // KHR_debug message callback, reported as errors happen
+  FrameCheck,  // glGetError drained once per frame (no KHR_debug, WebGL)
+};
+
+#ifdef GAMBIT_GL_DEBUG
+constexpr bool DEBUG_LAYER_DEFAULT = true;
+#else
+constexpr bool DEBUG_LAYER_DEFAULT = false;
+#endif
+
+// Install the debug layer; the GL context must be current
+DebugMode enableDebugLayer(void* (*getProcAddress)(const char*));
+DebugMode getDebugMode();
+
+// Name the code about to issue GL calls, so errors can be traced to it
+void markCallSite(const char* site);
+
+// Report errors raised since the last call (FrameCheck mode only)
+void checkFrameErrors();
 
 }  // namespace OpenGLUtils
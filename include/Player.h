@@ -3,7 +3,6 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
-#include <memory>
 
 #include "Animatable.h"
 #include "AnimationController.h"
@@ -25,9 +24,8 @@ struct Player : public Animatable {
   float health;
   uint8_t r, g, b;
 
-  // Animation (shared_ptr allows Player to be copyable for remote
-  // interpolation)
-  std::shared_ptr<AnimationController> animationController;
+  // Animation playback state; the clips are shared (see AnimationLibrary)
+  AnimationController animationController;
 
   // Inventory
   ItemStack inventory[INVENTORY_SIZE];
@@ -51,7 +49,6 @@ struct Player : public Animatable {
         r(255),
         g(255),
         b(255),
-        animationController(std::make_shared<AnimationController>()),
         lastInputSequence(0),
         deathTime(0.0f),
         lastServerTick(0) {}
@@ -88,11 +85,11 @@ struct Player : public Animatable {
 
   // Animatable interface implementation
   AnimationController* getAnimationController() override {
-    return animationController.get();
+    return &animationController;
   }
 
   const AnimationController* getAnimationController() const override {
-    return animationController.get();
+    return &animationController;
   }
 
   float getVelocityX() const override { return vx; }
@@ -146,9 +143,7 @@ inline void applyInput(
   player.vy = dy * effectiveSpeed;
 
   // Update animation state based on new velocity
-  if (player.animationController) {
-    player.animationController->updateAnimationState(player.vx, player.vy);
-  }
+  player.animationController.updateAnimationState(player.vx, player.vy);
 
   // Calculate new position
   float oldX = player.x;
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Map a float to a uint32_t whose unsigned order matches the float order
+// (negative values included), for use as a radix sort key. -0 and +0 get
+// the same key, as they compare equal.
+inline uint32_t radixKeyFromFloat(float value) {
+  value += 0.0f;  // -0 + 0 == +0
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+// Stable LSD radix sort of `items` by a 32-bit key, one byte per pass.
+// `scratch` is the ping-pong buffer; keep it alive across calls and the
+// sort allocates nothing once both vectors have grown. Passes where every
+// key has the same byte are skipped.
+template <typename T, typename KeyFn>
+void radixSort(std::vector<T>& items, std::vector<T>& scratch, KeyFn key) {
+  const size_t count = items.size();
+  if (count < 2) return;
+  scratch.resize(count);
+
+  for (int shift = 0; shift < 32; shift += 8) {
+    size_t buckets[256] = {};
+    for (const T& item : items) {
+      buckets[(key(item) >> shift) & 0xFF]++;
+    }
+    if (buckets[(key(items[0]) >> shift) & 0xFF] == count) {
+      continue;  // All keys share this byte
+    }
+
+    size_t offset = 0;
+    for (size_t& bucket : buckets) {
+      size_t size = bucket;
+      bucket = offset;
+      offset += size;
+    }
+    for (const T& item : items) {
+      scratch[buckets[(key(item) >> shift) & 0xFF]++] = item;
+    }
+    items.swap(scratch);
+  }
+}
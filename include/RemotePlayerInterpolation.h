@@ -1,12 +1,14 @@
 #pragma once
 
-#include <chrono>
-#include <deque>
 #include <unordered_map>
+#include <vector>
 
 #include "EventBus.h"
 #include "NetworkProtocol.h"
 #include "Player.h"
+#include "ServerClock.h"
+#include "SnapshotBuffer.h"
+#include "config/NetworkConfig.h"
 
 class AnimationSystem;
 
@@ -15,34 +17,65 @@ struct PlayerSnapshot {
   float vx, vy;
   float health;
   uint32_t serverTick;
-  std::chrono::steady_clock::time_point receivedTime;
+};
+
+// What the renderer needs of a remote player, without copying a Player
+struct RemotePlayerRenderState {
+  uint32_t id;
+  float x, y;
+  float health;
+  uint8_t r, g, b;
+  const AnimationController* animation;
 };
 
 class RemotePlayerInterpolation {
  public:
+  // `animationSystem`, if given, must outlive the interpolation
   RemotePlayerInterpolation(uint32_t localPlayerId,
-                            AnimationSystem* animationSystem = nullptr);
+                            AnimationSystem* animationSystem = nullptr,
+                            EventBus& bus = EventBus::instance());
+  ~RemotePlayerInterpolation();
 
-  // Get interpolated state for a remote player
-  bool getInterpolatedState(uint32_t playerId, float interpolation,
+  // Server tick to show remote players at now: a delay behind the
+  // newest snapshot, so there is usually a later one to interpolate to
+  double getRenderTick() const;
+  ServerClock& getServerClock() { return serverClock; }
+
+  // Get a remote player's state at `renderTick`. Past the newest
+  // snapshot, it is extrapolated along its velocity for a short while.
+  bool getInterpolatedState(uint32_t playerId, double renderTick,
                             Player& outPlayer) const;
 
   // Get all remote player IDs
   std::vector<uint32_t> getRemotePlayerIds() const;
 
+  // Append every remote player's state at `renderTick` to `out`. Allocates
+  // nothing once `out` has grown to the player count.
+  void appendRenderStates(double renderTick,
+                          std::vector<RemotePlayerRenderState>& out) const;
+
  private:
   uint32_t localPlayerId;
   bool localPlayerIdConfirmed;  // Track if we've received our real ID from
                                 // server
-  std::unordered_map<uint32_t, std::deque<PlayerSnapshot>> snapshotBuffers;
+  using Buffer =
+      SnapshotBuffer<PlayerSnapshot, Config::Network::SNAPSHOT_BUFFER_SIZE>;
+  std::unordered_map<uint32_t, Buffer> snapshotBuffers;
+  ServerClock serverClock;
   std::unordered_map<uint32_t, Player>
       remotePlayers;                 // Store latest known state
   AnimationSystem* animationSystem;  // Optional animation system for remote
                                      // players
 
-  static constexpr size_t MAX_SNAPSHOTS = 3;  // ~50ms buffer at 60 FPS
+  // Snapshot-derived fields of a player at `renderTick`; false if there
+  // are no snapshots yet
+  bool sample(uint32_t playerId, double renderTick,
+              PlayerSnapshot& out) const;
 
   void onNetworkPacketReceived(const NetworkPacketReceivedEvent& e);
   void onPlayerJoined(uint32_t playerId, uint8_t r, uint8_t g, uint8_t b);
   void onPlayerLeft(uint32_t playerId);
+
+  EventBus& bus;
+  std::vector<Subscription> subscriptions;
 };
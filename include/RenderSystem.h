@@ -3,6 +3,7 @@
 #include <SDL2/SDL.h>
 
 #include <memory>
+#include <vector>
 
 #include "Camera.h"
 #include "ClientPrediction.h"
@@ -13,6 +14,7 @@
 #include "ObjectiveDebugRenderer.h"
 #include "RemotePlayerInterpolation.h"
 #include "SpriteRenderer.h"
+#include "TextureManager.h"
 #include "TileRenderer.h"
 #include "TiledMap.h"
 #include "Window.h"
@@ -26,7 +28,7 @@ class RenderSystem {
                TiledMap* tiledMap,
                CollisionDebugRenderer* collisionDebugRenderer,
                MusicZoneDebugRenderer* musicZoneDebugRenderer,
-               ObjectiveDebugRenderer* objectiveDebugRenderer);
+               ObjectiveDebugRenderer* objectiveDebugRenderer, EventBus& bus);
 
   ~RenderSystem() = default;
 
@@ -37,6 +39,20 @@ class RenderSystem {
   void captureScreenshot(const std::string& path);
 
  private:
+  // One sprite to depth-sort and draw this frame. Plain data, filled from
+  // the interpolation buffers into arrays reused every frame.
+  struct RenderItem {
+    enum Kind : uint8_t { Character, Ship };
+
+    float depth;
+    int screenX, screenY;        // Sprite center
+    int srcX, srcY, srcW, srcH;  // Sprite sheet frame; srcW == 0: whole
+    float r, g, b;               // Tint
+    float health, maxHealth;
+    float healthBarOffsetY;  // Health bar position relative to screenY
+    Kind kind;
+  };
+
   Window* window;
   ClientPrediction* clientPrediction;
   RemotePlayerInterpolation* remoteInterpolation;
@@ -49,14 +65,23 @@ class RenderSystem {
   std::unique_ptr<SpriteRenderer> spriteRenderer;
   std::unique_ptr<Texture> whitePixelTexture;
   std::unique_ptr<TileRenderer> tileRenderer;
-  Texture* playerTexture;  // Managed by TextureManager, not owned
-  Texture* shipTexture;    // Managed by TextureManager, not owned
+  // Atlas slots (or whole textures) from TextureManager, not owned
+  TextureRegion playerSprite;
+  TextureRegion shipSprite;
+
+  // Per-frame scratch; cleared, never shrunk
+  std::vector<RenderItem> renderItems;
+  std::vector<RenderItem> sortScratch;
+  std::vector<RemotePlayerRenderState> remoteStates;
+  std::vector<EnemyRenderState> enemyStates;
+
+  std::vector<Subscription> subscriptions;
 
   void onRender(const RenderEvent& e);
-  void drawPlayer(const Player& player);
-  void drawEnemy(const Enemy& enemy);
+  void gatherRenderItems(const Player& localPlayer);
+  void drawCharacter(const RenderItem& item);
   void drawWorldItem(const WorldItem& worldItem);
   void drawObjective(const ClientObjective& objective);
-  void drawShip(float worldX, float worldY);
+  void drawShip(const RenderItem& item);
   void drawHealthBar(int x, int y, float health, float maxHealth);
 };
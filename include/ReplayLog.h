@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// ReplayLog: Compact binary log of everything that enters a match
+// Layout (little-endian):
+//   header:  "GRPL" | u16 version | u32 rngSeed | u16 len | mapPath bytes
+//   record:  u8 kind | varint tickDelta | varint clientId
+//            [Packet only: varint size | raw packet bytes]
+// Ticks are stored as deltas from the previous record, so an idle match
+// costs a few bytes per event rather than per tick. The final End record's
+// tick is the number of ticks the match ran.
+
+enum class ReplayRecordKind : uint8_t {
+  Connect = 1,
+  Disconnect = 2,
+  Packet = 3,
+  End = 4,
+};
+
+struct ReplayRecord {
+  ReplayRecordKind kind = ReplayRecordKind::End;
+  uint64_t tick = 0;
+  uint32_t clientId = 0;
+  const uint8_t* data = nullptr;  // Points into the reader's buffer
+  size_t size = 0;
+};
+
+class ReplayWriter {
+ public:
+  ReplayWriter() = default;
+  ~ReplayWriter();
+
+  ReplayWriter(const ReplayWriter&) = delete;
+  ReplayWriter& operator=(const ReplayWriter&) = delete;
+
+  bool open(const std::string& path, uint32_t rngSeed,
+            const std::string& mapPath);
+  bool isOpen() const { return file.is_open(); }
+
+  // Ticks must be non-decreasing
+  void write(ReplayRecordKind kind, uint64_t tick, uint32_t clientId,
+             const uint8_t* data = nullptr, size_t size = 0);
+
+  // Writes the End record and closes the file
+  void close(uint64_t tickCount);
+
+  uint64_t getBytesWritten() const { return bytesWritten; }
+
+ private:
+  void flush();
+
+  std::ofstream file;
+  std::vector<uint8_t> buffer;
+  uint64_t lastTick = 0;
+  uint64_t bytesWritten = 0;
+
+  static constexpr size_t FLUSH_THRESHOLD = 64 * 1024;
+};
+
+class ReplayReader {
+ public:
+  // Loads and validates the whole log up front
+  bool open(const std::string& path);
+  bool openFromMemory(std::vector<uint8_t> bytes);
+
+  uint32_t getRngSeed() const { return rngSeed; }
+  const std::string& getMapPath() const { return mapPath; }
+
+  // Ticks the recorded match ran. Logs cut short by a crash have no End
+  // record; they end one tick after their last event.
+  uint64_t getTickCount() const { return tickCount; }
+  size_t getRecordCount() const { return recordCount; }
+  // Log size in bytes, less any torn record dropped at the end
+  size_t getLogSize() const { return bytes.size(); }
+
+  // Returns records in order, End excluded. Record data stays valid for
+  // the reader's lifetime.
+  bool next(ReplayRecord& record);
+  void rewind();
+
+ private:
+  bool parseHeader();
+  bool parseRecord(size_t& offset, uint64_t& tick, ReplayRecord& record) const;
+
+  std::vector<uint8_t> bytes;
+  size_t recordsOffset = 0;
+  size_t cursor = 0;
+  uint64_t cursorTick = 0;
+
+  uint32_t rngSeed = 0;
+  std::string mapPath;
+  uint64_t tickCount = 0;
+  size_t recordCount = 0;
+};
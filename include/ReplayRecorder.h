@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "EventBus.h"
+#include "ReplayLog.h"
+
+// ReplayRecorder: Writes a match's inputs to a ReplayLog
+// Listens on the match's bus for connects, disconnects and raw client
+// packets, stamped with the frame of the UpdateEvent they arrived in.
+// Together with the match's RNG seed that is all the server needs to
+// re-simulate the match tick for tick (see ReplayServerTransport).
+class ReplayRecorder {
+ public:
+  explicit ReplayRecorder(EventBus& bus);
+  ~ReplayRecorder();
+
+  ReplayRecorder(const ReplayRecorder&) = delete;
+  ReplayRecorder& operator=(const ReplayRecorder&) = delete;
+
+  bool start(const std::string& path, uint32_t rngSeed,
+             const std::string& mapPath);
+  // Writes the End record; also called on destruction
+  void stop();
+
+  bool isRecording() const { return writer.isOpen(); }
+  uint64_t getRecordCount() const { return recordCount; }
+
+ private:
+  void onUpdate(const UpdateEvent& e);
+  void onClientConnected(const ClientConnectedEvent& e);
+  void onClientDisconnected(const ClientDisconnectedEvent& e);
+  void onNetworkPacketReceived(const NetworkPacketReceivedEvent& e);
+
+  EventBus& bus;
+  std::vector<Subscription> subscriptions;
+  ReplayWriter writer;
+  uint64_t currentTick = 0;
+  uint64_t ticksSeen = 0;
+  uint64_t recordCount = 0;
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+#include "config/NetworkConfig.h"
+#include "config/TimingConfig.h"
+
+// ServerClock: Client-side estimate of the server's tick, for rendering
+// Every snapshot's arrival gives a sample of (server time - local time);
+// the estimate follows those samples slowly, so one late or early packet
+// does not shift it. Remote entities are drawn at getRenderTick(), which
+// runs a fixed delay behind the newest tick we expect to have received,
+// leaving room for packets that arrive with jitter.
+class ServerClock {
+ public:
+  explicit ServerClock(
+      float tickMs = Config::Timing::TARGET_DELTA_MS,
+      float delayMs = Config::Network::INTERPOLATION_DELAY_MS);
+
+  // A snapshot for `serverTick` arrived at local time `nowMs`
+  void observe(uint32_t serverTick, double nowMs);
+
+  bool isSynced() const { return synced; }
+
+  // Fractional server tick at local time `nowMs`
+  double getServerTick(double nowMs) const;
+  double getRenderTick(double nowMs) const;
+
+  void setDelayMs(float ms) { delayMs = ms; }
+  float getDelayMs() const { return delayMs; }
+  float getTickMs() const { return tickMs; }
+
+  // Monotonic milliseconds, the time base for observe() and getters
+  static double nowMs();
+
+ private:
+  float tickMs;
+  float delayMs;
+  double offsetMs = 0.0;  // Estimated server time minus local time
+  bool synced = false;
+
+  // Share of each sample's error absorbed into the estimate
+  static constexpr double SMOOTHING = 0.05;
+  // Errors beyond this (a stall, or the server restarting) resync at once
+  static constexpr double RESYNC_MS = 500.0;
+};
@@ -2,7 +2,9 @@
 
 #include <cstdlib>
 #include <memory>
+#include <random>
 #include <unordered_map>
+#include <vector>
 
 #include "EffectManager.h"
 #include "EventBus.h"
@@ -11,30 +13,45 @@
 #include "ObjectiveSystem.h"
 #include "Player.h"
 #include "PlayerSpawn.h"
+#include "TickPhaseTimes.h"
 #include "WorldConfig.h"
 #include "WorldItem.h"
 
+class Counter;
+class Gauge;
+class Histogram;
 class NetworkServer;
 class CollisionSystem;
 class EnemySystem;
 
 class ServerGameState {
  public:
-  ServerGameState(NetworkServer* server, const WorldConfig& world);
+  // Subscribes to the match's EventBus; pass a dedicated bus per match when
+  // hosting several in one process. All server randomness derives from
+  // rngSeed, so the same seed and inputs reproduce the same simulation.
+  ServerGameState(NetworkServer* server, const WorldConfig& world,
+                  EventBus& bus = EventBus::instance(),
+                  uint32_t rngSeed = std::random_device{}());
   ~ServerGameState();
 
   EnemySystem* getEnemySystem() { return enemySystem.get(); }
   EffectManager* getEffectManager() { return effectManager.get(); }
   ObjectiveSystem* getObjectiveSystem() { return objectiveSystem.get(); }
+  uint32_t getRngSeed() const { return rngSeed; }
+  uint32_t getServerTick() const { return serverTick; }
+  const TickPhaseTimes& getLastTickPhases() const { return lastTickPhases; }
 
  private:
   NetworkServer* server;
+  EventBus& bus;
+  uint32_t rngSeed;
   float worldWidth;
   float worldHeight;
   const CollisionSystem* collisionSystem;
   const std::vector<PlayerSpawn>* playerSpawns;
   std::unordered_map<uint32_t, Player> players;
   uint32_t serverTick;
+  TickPhaseTimes lastTickPhases;
   std::unique_ptr<EnemySystem> enemySystem;
   std::unique_ptr<EffectManager> effectManager;
   std::unique_ptr<ObjectiveSystem> objectiveSystem;
@@ -48,12 +65,22 @@ class ServerGameState {
   std::unordered_map<uint32_t, WorldItem> worldItems;
   uint32_t nextWorldItemId;
 
+  // Process-wide series, shared with every other match
+  Histogram* tickDuration;
+  Counter* tickOverruns;
+  Gauge* connectedPlayers;
+
   void onClientConnected(const ClientConnectedEvent& e);
   void onClientDisconnected(const ClientDisconnectedEvent& e);
   void onNetworkPacketReceived(const NetworkPacketReceivedEvent& e);
   void onUpdate(const UpdateEvent& e);
+  void onEnemiesDied(EventSpan<EnemyDiedEvent> deaths);
+  void onObjectiveRangesExited(EventSpan<ObjectiveRangeExitedEvent> exits);
+  void onClientInputs(EventSpan<ClientInputReceivedEvent> inputs);
+  void onAttacks(EventSpan<AttackReceivedEvent> attacks);
 
-  void processClientInput(uint32_t clientId, const uint8_t* data, size_t size);
+  void processClientInput(const ClientInputReceivedEvent& input);
+  void processAttack(const AttackReceivedEvent& attack);
   void processUseItem(uint32_t clientId, const uint8_t* data, size_t size);
   void processEquipItem(uint32_t clientId, const uint8_t* data, size_t size);
   void broadcastStateUpdate();
@@ -70,7 +97,6 @@ class ServerGameState {
   void respawnPlayer(Player& player);
 
   // World item management methods
-  void checkEnemyLootDrops();
   void spawnWorldItem(uint32_t itemId, float x, float y);
   void processItemPickupRequest(uint32_t clientId, const uint8_t* data,
                                 size_t size);
@@ -86,4 +112,7 @@ class ServerGameState {
 
   // Link LittleJohn objectives to their guardian enemies
   void initializeLittleJohnGuardians();
+
+  // Declared last so handlers are released before the state they capture
+  std::vector<Subscription> subscriptions;
 };
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "CollisionSystem.h"
+#include "TiledMap.h"
+#include "WorldConfig.h"
+
+// SharedWorld: Immutable map data shared by every match in a server process
+// Loaded once at startup; matches only read it through the const
+// WorldConfig returned by getWorldConfig(). Must outlive all matches.
+class SharedWorld {
+ public:
+  SharedWorld() = default;
+
+  SharedWorld(const SharedWorld&) = delete;
+  SharedWorld& operator=(const SharedWorld&) = delete;
+
+  bool load(const std::string& mapPath);
+
+  const TiledMap& getMap() const { return map; }
+  const CollisionSystem& getCollisionSystem() const {
+    return *collisionSystem;
+  }
+
+  WorldConfig getWorldConfig() const;
+
+ private:
+  TiledMap map;
+  std::unique_ptr<CollisionSystem> collisionSystem;
+};
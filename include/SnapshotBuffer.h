@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// SnapshotBuffer: One entity's recent server snapshots, by server tick
+// A fixed ring (no allocation per packet) that keeps the newest CAPACITY
+// snapshots. Snapshot needs a uint32_t serverTick; stale or duplicate
+// ticks are dropped, so the ring stays sorted.
+template <typename Snapshot, size_t CAPACITY>
+class SnapshotBuffer {
+ public:
+  // Where a render tick falls in the buffer. Interpolate from -> to by t;
+  // past the newest snapshot, from == to and extrapolateTicks is how far
+  // beyond it (already capped) to move along its velocity.
+  struct Sample {
+    const Snapshot* from = nullptr;
+    const Snapshot* to = nullptr;
+    float t = 0.0f;
+    float extrapolateTicks = 0.0f;
+  };
+
+  bool push(const Snapshot& snapshot) {
+    if (count > 0 && snapshot.serverTick <= newest().serverTick) {
+      return false;
+    }
+    ring[(start + count) % CAPACITY] = snapshot;
+    if (count < CAPACITY) {
+      count++;
+    } else {
+      start = (start + 1) % CAPACITY;
+    }
+    return true;
+  }
+
+  void clear() { start = count = 0; }
+  bool empty() const { return count == 0; }
+  size_t size() const { return count; }
+
+  // 0 is the oldest
+  const Snapshot& at(size_t i) const { return ring[(start + i) % CAPACITY]; }
+  const Snapshot& newest() const { return at(count - 1); }
+
+  // Requires a non-empty buffer. Before the oldest snapshot, holds it.
+  Sample sample(double renderTick, double maxExtrapolationTicks) const {
+    Sample result;
+    const Snapshot& last = newest();
+    if (renderTick >= last.serverTick) {
+      double ahead = renderTick - last.serverTick;
+      result.from = result.to = &last;
+      result.extrapolateTicks = static_cast<float>(
+          ahead < maxExtrapolationTicks ? ahead : maxExtrapolationTicks);
+      return result;
+    }
+
+    // Newest first: the render tick is normally a few ticks behind it
+    for (size_t i = count - 1; i > 0; --i) {
+      const Snapshot& before = at(i - 1);
+      if (renderTick >= before.serverTick) {
+        const Snapshot& after = at(i);
+        result.from = &before;
+        result.to = &after;
+        result.t = static_cast<float>((renderTick - before.serverTick) /
+                                      (after.serverTick - before.serverTick));
+        return result;
+      }
+    }
+    result.from = result.to = &at(0);
+    return result;
+  }
+
+ private:
+  std::array<Snapshot, CAPACITY> ring{};
+  size_t start = 0;
+  size_t count = 0;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// One sprite in a batch: screen rect, UV rect and tint. Laid out exactly as
+// the per-instance vertex attributes SpriteRenderer uploads.
+struct SpriteInstance {
+  float x, y, width, height;
+  float u1, v1, u2, v2;
+  float r, g, b, a;
+};
+
+// A contiguous range of sorted instances sharing one texture
+struct SpriteDrawRun {
+  uint32_t textureId;
+  size_t firstInstance;
+  size_t instanceCount;
+};
+
+// SpriteBatch: CPU side of instanced sprite rendering (no GL calls)
+// Sprites are queued into depth bands. flush() orders them by band, then by
+// texture (stable, so submission order survives within a texture), and
+// reports one run per texture per band. Callers open a new band wherever
+// painter's order across textures matters.
+class SpriteBatch {
+ public:
+  void add(uint32_t textureId, const SpriteInstance& instance);
+
+  // Later bands draw over earlier ones
+  void nextBand() { currentBand++; }
+  uint32_t getBand() const { return currentBand; }
+
+  bool empty() const { return pending.empty(); }
+  size_t size() const { return pending.size(); }
+
+  // Sorts queued sprites and calls `submit` once per run with the sorted
+  // instances (valid only during the call). Clears the batch and resets the
+  // band to 0; buffers keep their capacity across frames.
+  void flush(const std::function<void(const std::vector<SpriteInstance>&,
+                                      const std::vector<SpriteDrawRun>&)>&
+                 submit);
+
+  // Runs and sprites emitted since the last resetStats()
+  size_t getDrawCallCount() const { return drawCalls; }
+  size_t getSpriteCount() const { return spritesDrawn; }
+  void resetStats();
+
+ private:
+  struct SortKey {
+    uint64_t key;  // band << 32 | textureId
+    uint32_t index;
+  };
+
+  std::vector<SpriteInstance> pending;
+  std::vector<SortKey> keys;
+  std::vector<SpriteInstance> sorted;
+  std::vector<SpriteDrawRun> runs;
+  uint32_t currentBand = 0;
+
+  size_t drawCalls = 0;
+  size_t spritesDrawn = 0;
+};
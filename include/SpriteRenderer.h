@@ -7,9 +7,15 @@
 #endif
 
 #include <glm/glm.hpp>
+#include <vector>
 
+#include "SpriteBatch.h"
 #include "Texture.h"
 
+// SpriteRenderer: Instanced textured-quad renderer
+// Between beginBatch() and endBatch() draw calls only queue sprites; the
+// batch is flushed as one instanced draw per texture per depth band.
+// Outside a batch each draw is flushed immediately (one draw call).
 class SpriteRenderer {
  public:
   SpriteRenderer();
@@ -29,6 +35,18 @@ class SpriteRenderer {
                   float r = 1.0f, float g = 1.0f, float b = 1.0f,
                   float a = 1.0f);
 
+  // Queue sprites until endBatch()
+  void beginBatch();
+  // Start a new depth band: everything queued after this draws over
+  // everything queued before it, whatever the textures
+  void nextBand();
+  void endBatch();
+
+  // Draw calls and sprites issued since the last resetStats()
+  size_t getDrawCallCount() const { return batch.getDrawCallCount(); }
+  size_t getSpriteCount() const { return batch.getSpriteCount(); }
+  void resetStats() { batch.resetStats(); }
+
   // Draw a colored rectangle (no texture)
   void drawRect(float x, float y, float width, float height, float r = 1.0f,
                 float g = 1.0f, float b = 1.0f, float a = 1.0f);
@@ -36,14 +54,19 @@ class SpriteRenderer {
  private:
   GLuint shaderProgram;
   GLuint VAO;
-  GLuint VBO;
-  GLuint regionVAO;  // Separate VAO for dynamic region rendering
-  GLuint regionVBO;  // Separate VBO to avoid modifying main VBO
+  GLuint quadVBO;      // Static unit quad
+  GLuint instanceVBO;  // Per-sprite attributes, re-filled every flush
+  size_t instanceCapacity;  // instanceVBO size in sprites
 
   // Cached uniform locations (avoid expensive glGetUniformLocation calls)
-  GLint uniformModel;
-  GLint uniformColor;
   GLint uniformProjection;
 
+  SpriteBatch batch;
+  bool batching;
+
   void initRenderData();
+  void queue(const Texture& texture, const SpriteInstance& instance);
+  void flush();
+  void submit(const std::vector<SpriteInstance>& instances,
+              const std::vector<SpriteDrawRun>& runs);
 };
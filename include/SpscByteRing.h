@@ -0,0 +1,154 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+// SpscByteRing: Bounded lock-free queue of byte messages between exactly
+// one producer thread and one consumer thread
+//
+// Messages are stored in place as [uint32 length][payload], padded to 4
+// bytes, so pushing never allocates. A message is always contiguous: when
+// it would straddle the end of the buffer, a wrap marker fills the rest
+// and the message starts over at offset 0. That keeps peek() zero-copy,
+// and caps a message at half the capacity.
+//
+// Producer: push(), reject(). Consumer: peek(), consume(), empty().
+class SpscByteRing {
+ public:
+  // Rounded up to a power of two
+  explicit SpscByteRing(size_t capacityBytes)
+      : capacity(roundUpPowerOfTwo(capacityBytes)),
+        mask(capacity - 1),
+        buffer(new uint8_t[capacity]) {}
+
+  SpscByteRing(const SpscByteRing&) = delete;
+  SpscByteRing& operator=(const SpscByteRing&) = delete;
+
+  size_t getCapacity() const { return capacity; }
+  size_t getMaxMessageSize() const { return capacity / 2 - HEADER_SIZE; }
+
+  // Messages refused because the ring was full or they were too large
+  uint64_t getDroppedCount() const {
+    return dropped.load(std::memory_order_relaxed);
+  }
+
+  // Count a message the producer refused before calling push()
+  void reject() { dropped.fetch_add(1, std::memory_order_relaxed); }
+
+  // False (and nothing written) if the message doesn't fit right now
+  bool push(const uint8_t* data, size_t length) {
+    if (length > getMaxMessageSize()) {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    size_t head = writePos.load(std::memory_order_relaxed);
+    size_t needed = recordSize(length);
+    size_t untilEnd = capacity - (head & mask);
+    size_t padding = untilEnd < needed ? untilEnd : 0;
+
+    if (head + padding + needed - cachedReadPos > capacity) {
+      cachedReadPos = readPos.load(std::memory_order_acquire);
+      if (head + padding + needed - cachedReadPos > capacity) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+    }
+
+    if (padding > 0) {
+      writeHeader(head & mask, WRAP_MARKER);
+      head += padding;
+    }
+    size_t offset = head & mask;
+    writeHeader(offset, static_cast<uint32_t>(length));
+    if (length > 0) {
+      std::memcpy(&buffer[offset + HEADER_SIZE], data, length);
+    }
+    writePos.store(head + needed, std::memory_order_release);
+    return true;
+  }
+
+  // Oldest message, left in the ring until consume(). The pointer stays
+  // valid until then, so it can be lent out (see TransportPayload::borrow);
+  // peeking again before consume() returns the same message.
+  bool peek(const uint8_t*& data, size_t& length) {
+    size_t tail = readPos.load(std::memory_order_relaxed);
+    if (tail == cachedWritePos) {
+      cachedWritePos = writePos.load(std::memory_order_acquire);
+      if (tail == cachedWritePos) return false;
+    }
+
+    size_t offset = tail & mask;
+    uint32_t header = readHeader(offset);
+    if (header == WRAP_MARKER) {
+      // The producer publishes the marker together with the message after
+      // it, so there is always one at offset 0
+      tail += capacity - offset;
+      readPos.store(tail, std::memory_order_release);
+      offset = 0;
+      header = readHeader(offset);
+    }
+
+    data = &buffer[offset + HEADER_SIZE];
+    length = header;
+    peekedSize = recordSize(header);
+    return true;
+  }
+
+  // Release the message returned by the last peek()
+  void consume() {
+    assert(peekedSize > 0 && "consume() without a peeked message");
+    readPos.store(readPos.load(std::memory_order_relaxed) + peekedSize,
+                  std::memory_order_release);
+    peekedSize = 0;
+  }
+
+  bool empty() const {
+    return readPos.load(std::memory_order_relaxed) ==
+           writePos.load(std::memory_order_acquire);
+  }
+
+ private:
+  static constexpr size_t HEADER_SIZE = sizeof(uint32_t);
+  static constexpr uint32_t WRAP_MARKER = 0xFFFFFFFFu;
+
+  static size_t roundUpPowerOfTwo(size_t n) {
+    size_t size = 64;
+    while (size < n) size <<= 1;
+    return size;
+  }
+
+  // Header plus payload, keeping headers 4-byte aligned
+  static size_t recordSize(size_t length) {
+    return HEADER_SIZE + ((length + 3) & ~static_cast<size_t>(3));
+  }
+
+  void writeHeader(size_t offset, uint32_t value) {
+    std::memcpy(&buffer[offset], &value, sizeof(value));
+  }
+
+  uint32_t readHeader(size_t offset) const {
+    uint32_t value;
+    std::memcpy(&value, &buffer[offset], sizeof(value));
+    return value;
+  }
+
+  const size_t capacity;
+  const size_t mask;
+  std::unique_ptr<uint8_t[]> buffer;
+
+  // Positions count bytes ever written/read; offsets are position & mask.
+  // Each side keeps a stale copy of the other's position and only reloads
+  // it when the ring looks full (producer) or empty (consumer).
+  alignas(64) std::atomic<size_t> writePos{0};
+  size_t cachedReadPos = 0;  // Producer only
+  std::atomic<uint64_t> dropped{0};
+
+  alignas(64) std::atomic<size_t> readPos{0};
+  size_t cachedWritePos = 0;  // Consumer only
+  size_t peekedSize = 0;      // Consumer only
+};
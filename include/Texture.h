@@ -6,6 +6,7 @@
 #include <glad/glad.h>
 #endif
 
+#include <cstdint>
 #include <string>
 
 class Texture {
@@ -19,6 +20,12 @@ class Texture {
   // Create a simple 1x1 white texture (useful for colored rectangles)
   bool createWhitePixel();
 
+  // Create a texture from tightly packed RGBA8 pixels
+  bool createFromPixels(const uint8_t* rgba, int width, int height);
+
+  // Replace the contents of a texture made by createFromPixels (same size)
+  void updatePixels(const uint8_t* rgba);
+
   // Bind this texture for rendering
   void bind() const;
 
@@ -1,11 +1,25 @@
 #pragma once
 
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
+#include "AtlasManifest.h"
 #include "Texture.h"
 
+// A rectangle of a texture: an image's slot in an atlas page, or the whole
+// of a standalone texture
+struct TextureRegion {
+  Texture* texture = nullptr;
+  int x = 0, y = 0;  // Top-left in texture pixels
+  int width = 0, height = 0;
+  float u1 = 0.0f, v1 = 0.0f, u2 = 1.0f, v2 = 1.0f;
+};
+
 class TextureManager {
  public:
   static TextureManager& instance();
@@ -13,6 +27,26 @@ class TextureManager {
   // Get texture by path, loading it if not already cached
   Texture* get(const std::string& path);
 
+  // Read the lookup table written by AtlasPacker. Pages are only decoded
+  // when an image on them is first requested. Without a manifest every
+  // image is loaded on its own.
+  bool loadAtlas(const std::string& manifestPath = AtlasManifest::DEFAULT_PATH);
+
+  // Resolve an image path to the texture and rect holding it: its atlas
+  // slot if packed, else the image loaded standalone. nullptr if neither
+  // loads. The pointer stays valid until clear().
+  const TextureRegion* getRegion(const std::string& path);
+
+  // Non-blocking variants: decode on an AssetLoader worker, upload during
+  // AssetLoader::pump(). Futures resolve on the render thread, so poll them
+  // there (wait_for(0)) rather than calling get().
+  std::shared_future<const TextureRegion*> loadRegionAsync(
+      const std::string& path);
+  // The region if resident, else nullptr (and its load is started)
+  const TextureRegion* tryGetRegion(const std::string& path);
+  // Resolves once every path is resident or has failed
+  std::shared_future<void> prefetch(const std::vector<std::string>& paths);
+
   // Clear all cached textures
   void clear();
 
@@ -22,5 +56,33 @@ class TextureManager {
   TextureManager(const TextureManager&) = delete;
   TextureManager& operator=(const TextureManager&) = delete;
 
+  Texture* getAtlasPage(int page);
+
+  // Region for `path` if the texture holding it is already resident
+  const TextureRegion* findResidentRegion(const std::string& path);
+  const TextureRegion* cacheRegion(const std::string& path, Texture* texture,
+                                   int x, int y, int width, int height);
+
+  // Make the texture holding `path` resident asynchronously, then call
+  // `done` (also on failure)
+  void requestRegionTexture(const std::string& path,
+                            std::function<void()> done);
+  // Decode `file` once however many callers ask; `store` takes the
+  // texture (null on failure) before the waiting callbacks run
+  void decodeAsync(const std::string& file,
+                   std::function<void(std::unique_ptr<Texture>)> store,
+                   std::function<void()> done);
+
   std::unordered_map<std::string, std::unique_ptr<Texture>> textures;
+  std::unordered_map<std::string, TextureRegion> regions;
+
+  AtlasManifest atlas;
+  std::vector<std::unique_ptr<Texture>> atlasPages;  // Null until loaded
+  std::vector<bool> atlasPageUnusable;  // Too large for the GPU, or failed
+
+  std::unordered_map<std::string, std::shared_future<const TextureRegion*>>
+      pendingRegions;
+  std::unordered_map<std::string, std::vector<std::function<void()>>>
+      decodeWaiters;  // By file being decoded
+  std::unordered_set<std::string> failedPaths;
 };
@@ -0,0 +1,14 @@
+#pragma once
+
+// Wall time of each part of one ServerGameState tick, in milliseconds
+struct TickPhaseTimes {
+  float enemiesMs = 0.0f;
+  float effectsMs = 0.0f;
+  float objectivesMs = 0.0f;
+  float eventsMs = 0.0f;  // Event flushes, player deaths and respawns
+  float broadcastMs = 0.0f;
+
+  float totalMs() const {
+    return enemiesMs + effectsMs + objectivesMs + eventsMs + broadcastMs;
+  }
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// A square block of map tiles and its world-space bounds
+struct TileChunk {
+  int firstTileX, firstTileY;
+  int tilesWide, tilesHigh;
+  float minX, minY, maxX, maxY;  // Isometric world AABB of its tile quads
+};
+
+// TileChunkGrid: Splits an isometric map into fixed-size tile chunks
+// Pure layout math (no GL, no tmxlite) so culling can be tested directly.
+// Chunks are stored back to front (by cx + cy, then cx), the same painter
+// order tiles are drawn in, so visible chunks come out ready to draw.
+class TileChunkGrid {
+ public:
+  TileChunkGrid(int mapWidth, int mapHeight, int tileWidth, int tileHeight,
+                int chunkSize);
+
+  // Tiled's isometric grid-to-world formula, centered on the map
+  void gridToWorld(int tileX, int tileY, float& worldX, float& worldY) const;
+
+  const std::vector<TileChunk>& getChunks() const { return chunks; }
+
+  // Chunks overlapping the view rectangle, back to front. Clears `out`.
+  void findVisible(float viewMinX, float viewMinY, float viewMaxX,
+                   float viewMaxY, std::vector<size_t>& out) const;
+
+ private:
+  int mapWidth, mapHeight;
+  int tileWidth, tileHeight;
+  float centerWorldX, centerWorldY;
+  std::vector<TileChunk> chunks;
+};
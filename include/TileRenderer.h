@@ -8,16 +8,22 @@
 
 #include <functional>
 #include <glm/glm.hpp>
+#include <memory>
 #include <vector>
 
 #include "Camera.h"
 #include "SpriteRenderer.h"
 #include "Texture.h"
+#include "TileChunkGrid.h"
 #include "TiledMap.h"
 
 using PlayerRenderCallback =
     std::function<void(float minDepth, float maxDepth)>;
 
+// TileRenderer: Draws every tile layer of a TiledMap, chunk by chunk
+// Only chunks overlapping the camera are drawn, and each chunk's vertex
+// buffer is built the first time it becomes visible, so cost follows
+// screen area rather than map area.
 class TileRenderer {
  public:
   TileRenderer(Camera* camera, SpriteRenderer* spriteRenderer,
@@ -25,26 +31,44 @@ class TileRenderer {
   ~TileRenderer();
   void render(const TiledMap& map, PlayerRenderCallback playerCallback);
 
+  // Stats from the last render()
+  size_t getVisibleChunkCount() const { return visibleChunks.size(); }
+  size_t getDrawCallCount() const { return drawCalls; }
+  size_t getBuiltChunkCount() const { return builtChunks; }
+
  private:
+  // Vertex range of one layer inside a chunk's buffer
+  struct LayerRange {
+    GLint firstVertex;
+    GLsizei vertexCount;
+  };
+
+  struct ChunkBuffers {
+    GLuint VAO = 0;
+    GLuint VBO = 0;
+    bool built = false;
+    std::vector<LayerRange> layers;  // One per map tile layer
+  };
+
   Camera* camera;
   SpriteRenderer* spriteRenderer;
   Texture* whitePixel;
   Texture* tilesetTexture;  // Managed by TextureManager, not owned
 
-  // Batched rendering
   GLuint shaderProgram;
-  GLuint VAO, VBO;
   GLint uniformProjection;
   GLint uniformCameraPos;
   GLint uniformScreenCenter;
-  std::vector<float> batchVertices;
-  bool batchBuilt;        // Cache flag - tiles are static
-  bool verticesUploaded;  // Cache flag - vertices uploaded to GPU
-  size_t vboCapacity;     // Current VBO buffer capacity in floats
-
-  void initBatchRenderer();
-  void buildTileBatch(const TiledMap& map);
-  void renderBatch();
-  void gridToWorld(const TiledMap& map, int tileX, int tileY, float& worldX,
-                   float& worldY);
+
+  std::unique_ptr<TileChunkGrid> grid;
+  std::vector<ChunkBuffers> chunkBuffers;  // Parallel to grid->getChunks()
+  std::vector<size_t> visibleChunks;
+  std::vector<float> scratchVertices;  // Reused while building chunks
+  size_t drawCalls;
+  size_t builtChunks;
+
+  void initShader();
+  void loadTileset(const TiledMap& map);
+  void buildChunk(const TiledMap& map, size_t chunkIndex);
+  void renderVisibleChunks(size_t layerCount);
 };
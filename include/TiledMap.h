@@ -1,9 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <string>
-#include <tmxlite/Map.hpp>
-#include <tmxlite/ObjectGroup.hpp>
-#include <tmxlite/TileLayer.hpp>
 #include <vector>
 
 #include "CollisionShape.h"
@@ -12,19 +11,44 @@
 #include "Objective.h"
 #include "PlayerSpawn.h"
 
+class MappedFile;
+
+namespace tmx {
+class Map;
+}
+
+// TiledMap: Tiles and gameplay objects of one isometric map
+// Authored as Tiled TMX; MapCompiler turns that into a flat .gmap file
+// (see CompiledMap.h) which load() prefers when it is up to date, since
+// it is mapped and used in place instead of parsed.
 class TiledMap {
  public:
   TiledMap() = default;
 
+  // Tile layers point into this object (or its mapping)
+  TiledMap(const TiledMap&) = delete;
+  TiledMap& operator=(const TiledMap&) = delete;
+
+  // Loads the compiled form of `filepath` when there is a current one,
+  // otherwise parses the TMX. A .gmap path is loaded directly.
   bool load(const std::string& filepath);
 
+  // Always parses the TMX source (what MapCompiler compiles from)
+  bool loadTmx(const std::string& filepath);
+
+  // True when the map came from a compiled file rather than TMX
+  bool isCompiled() const { return mappedFile != nullptr; }
+
   int getWidth() const { return mapWidth; }
   int getHeight() const { return mapHeight; }
   int getTileWidth() const { return tileWidth; }
   int getTileHeight() const { return tileHeight; }
   int getWorldWidth() const;
   int getWorldHeight() const;
-  const std::vector<const tmx::TileLayer*>& getTileLayers() const {
+
+  // One entry per tile layer, in draw order: width * height tile gids
+  // (0 = empty, row-major), or nullptr for a layer with nothing to draw
+  const std::vector<const uint32_t*>& getTileLayers() const {
     return tileLayers;
   }
   const std::vector<CollisionShape>& getCollisionShapes() const {
@@ -41,18 +65,23 @@ class TiledMap {
   float getShipY() const { return shipY; }
 
   // Tileset information
-  std::string getTilesetImagePath() const;
-  int getTilesetColumns() const;
-  int getTilesetSpacing() const;
-  const tmx::Map& getTmxMap() const { return tmxMap; }
+  const std::string& getTilesetImagePath() const { return tilesetImagePath; }
+  int getTilesetColumns() const { return tilesetColumns; }
+  int getTilesetSpacing() const { return tilesetSpacing; }
 
  private:
-  tmx::Map tmxMap;
+  friend class CompiledMap;
+
   int mapWidth = 0;
   int mapHeight = 0;
   int tileWidth = 0;
   int tileHeight = 0;
-  std::vector<const tmx::TileLayer*> tileLayers;
+  std::string tilesetImagePath;
+  int tilesetColumns = 1;
+  int tilesetSpacing = 0;
+  std::vector<const uint32_t*> tileLayers;
+  std::vector<uint32_t> tileData;  // Backs tileLayers for TMX maps
+  std::shared_ptr<const MappedFile> mappedFile;  // Backs compiled maps
   std::vector<CollisionShape> collisionShapes;
   std::vector<MusicZone> musicZones;
   std::vector<EnemySpawn> enemySpawns;
@@ -62,9 +91,11 @@ class TiledMap {
   float shipY = 0.0f;
   bool hasShip = false;
 
-  void extractCollisionShapes();
-  void extractEnemySpawns();
-  void extractPlayerSpawns();
-  void extractShip();
-  void extractObjectives();
+  void extractTiles(const tmx::Map& tmxMap);
+  void extractCollisionShapes(const tmx::Map& tmxMap);
+  void extractMusicZones(const tmx::Map& tmxMap);
+  void extractEnemySpawns(const tmx::Map& tmxMap);
+  void extractPlayerSpawns(const tmx::Map& tmxMap);
+  void extractShip(const tmx::Map& tmxMap);
+  void extractObjectives(const tmx::Map& tmxMap);
 };
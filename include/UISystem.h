@@ -3,18 +3,24 @@
 #include <SDL_mixer.h>
 
 #include <deque>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "Camera.h"
 #include "EnemyInterpolation.h"
 #include "EventBus.h"
+#include "MinimapRaster.h"
 #include "RemotePlayerInterpolation.h"
 #include "Settings.h"
 
 class Window;
 class ClientPrediction;
 class NetworkClient;
+struct TextureRegion;
 class Texture;
+class TiledMap;
 class DamageNumberSystem;
 class EffectTracker;
 struct ItemDefinition;
@@ -27,12 +33,17 @@ class UISystem {
            NetworkClient* client, DamageNumberSystem* damageNumbers,
            EffectTracker* effectTracker,
            RemotePlayerInterpolation* remoteInterpolation,
-           EnemyInterpolation* enemyInterpolation, Camera* camera);
+           EnemyInterpolation* enemyInterpolation, Camera* camera,
+           EventBus& bus);
   ~UISystem();
 
   // Called each frame to render UI
   void render();
 
+  // Map shown on the minimap. Its layout is baked into a texture on the
+  // next frame; call again after loading a different map.
+  void setMap(const TiledMap* map);
+
  private:
   void onRender(const RenderEvent& e);
 
@@ -74,9 +85,17 @@ class UISystem {
 
   // Effect display
   void renderEffectBars();
+  std::vector<uint32_t> effectBarEnemies;  // Scratch for renderEffectBars
 
   // Minimap
+  struct MinimapMarker {
+    float x, y;  // World position
+    uint32_t color;
+    float radius;
+  };
   void renderMinimap();
+  void refreshMinimapTexture();
+  void refreshMinimapMarkers();
 
   // State
   Window* window;
@@ -96,7 +115,7 @@ class UISystem {
   float currentTime;           // Accumulated time in seconds
 
   // Title screen assets
-  Texture* titleScreenBackground;
+  const TextureRegion* titleScreenBackground;
   Mix_Music* titleMusic;
 
   // Character selection state
@@ -110,4 +129,19 @@ class UISystem {
 
   // Debug coordinate display
   bool showCoordinates;
+
+  // Minimap: the map layout lives in a texture, redrawn only on a new map
+  // or an objective state change; entities are plotted from markers
+  // refreshed every MINIMAP_MARKER_INTERVAL_S
+  const TiledMap* minimapMap;
+  bool minimapTerrainDirty;
+  MinimapRaster minimapRaster;
+  std::unique_ptr<Texture> minimapTexture;
+  std::vector<std::pair<uint32_t, ObjectiveState>> minimapObjectiveStates;
+  std::vector<MinimapMarker> minimapMarkers;
+  float minimapMarkersTime;  // currentTime of the last marker refresh
+  std::vector<EnemyRenderState> minimapEnemies;  // Scratch for refreshes
+  std::vector<RemotePlayerRenderState> minimapRemotePlayers;
+
+  std::vector<Subscription> subscriptions;
 };
@@ -3,10 +3,16 @@
 #include <SDL2/SDL.h>
 
 #include <string>
+#include <vector>
+
+#include "EventBus.h"
 
 class Window {
  public:
-  Window(const std::string& title, int width, int height);
+  // Key events are published on `bus`. glDebug requests a debug context and
+  // installs the OpenGLUtils debug layer.
+  Window(const std::string& title, int width, int height, EventBus& bus,
+         bool glDebug = false);
   ~Window();
 
   void pollEvents();
@@ -24,4 +30,6 @@ class Window {
   SDL_Window* sdlWindow;
   SDL_GLContext glContext;
   bool open;
+  EventBus& bus;
+  std::vector<Subscription> subscriptions;
 };
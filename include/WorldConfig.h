@@ -1,7 +1,10 @@
 #pragma once
 
+#include <vector>
+
 class CollisionSystem;
 class TiledMap;
+struct EnemySpawn;
 
 struct WorldConfig {
   float width;
@@ -9,6 +12,10 @@ struct WorldConfig {
   const CollisionSystem* collisionSystem;
   const TiledMap* tiledMap;
 
+  // Used instead of the map's enemy spawns when set (e.g., BotSwarm's
+  // --enemies). Must outlive the matches.
+  const std::vector<EnemySpawn>* enemySpawns = nullptr;
+
   WorldConfig(float w, float h, const CollisionSystem* cs = nullptr,
               const TiledMap* map = nullptr)
       : width(w), height(h), collisionSystem(cs), tiledMap(map) {}
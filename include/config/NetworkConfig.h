@@ -21,5 +21,22 @@ constexpr size_t CHANNEL_COUNT = 2;  // Reliable + unreliable
 // Timeouts
 constexpr int POLL_TIMEOUT_MS = 1000;  // ENet poll timeout
 
+// Embedded/in-process ring sizes per client (see InMemoryChannel). A message
+// may use at most half a ring and larger ones are rejected with an error; an
+// EnemyStateUpdate costs ~30 bytes/enemy, so 1 MiB tops out near 17k enemies.
+constexpr size_t IN_MEMORY_SERVER_TO_CLIENT_BYTES = 1 << 20;
+constexpr size_t IN_MEMORY_CLIENT_TO_SERVER_BYTES = 64 << 10;
+
+// Remote entity interpolation (see ServerClock)
+constexpr float INTERPOLATION_DELAY_MS = 100.0f;  // Render behind newest
+constexpr float MAX_EXTRAPOLATION_MS = 100.0f;    // Then hold position
+constexpr size_t SNAPSHOT_BUFFER_SIZE = 32;       // ~0.5s at 60 ticks/s
+
+// Local player prediction (see ClientPrediction)
+constexpr size_t PREDICTION_HISTORY_SIZE = 128;  // ~2s of unacked inputs
+constexpr float PREDICTION_TOLERANCE_PX = 0.5f;  // Closer counts as a match
+constexpr float CORRECTION_SNAP_PX = 100.0f;     // Further jumps: no smoothing
+constexpr float CORRECTION_DECAY = 0.85f;  // Offset kept per tick (~100ms)
+
 }  // namespace Network
 }  // namespace Config
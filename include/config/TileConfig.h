@@ -14,9 +14,9 @@ constexpr int HEIGHT = 32;  // Tile height in pixels
 constexpr int VERTICES_PER_TILE = 6;  // 2 triangles = 6 vertices
 constexpr int FLOATS_PER_VERTEX = 4;  // x, y, u, v
 
-// NOTE: Buffer size is now dynamically allocated based on actual map
-// dimensions. No fixed BATCH_SIZE or BATCH_BUFFER_SIZE needed - TileRenderer
-// auto-resizes.
+// Maps are split into CHUNK_SIZE x CHUNK_SIZE tile chunks, each with its own
+// GPU buffer built the first time the camera sees it
+constexpr int CHUNK_SIZE = 32;
 
 }  // namespace Tile
 }  // namespace Config
@@ -15,11 +15,11 @@ constexpr float TARGET_DELTA_SECONDS = TARGET_DELTA_MS / 1000.0f;
 constexpr float MAX_FRAME_TIME_MS =
     33.0f;  // Minimum 30 FPS (slowest acceptable)
 
-// Input history
-constexpr int INPUT_HISTORY_SIZE = 60;  // 1 second of inputs at 60 FPS
+// Minimap entity markers are re-sampled at 10Hz rather than every frame
+constexpr float MINIMAP_MARKER_INTERVAL_S = 0.1f;
 
-// Network snapshots
-constexpr int MAX_SNAPSHOTS = 3;  // ~50ms interpolation buffer
+// How often a file metrics target is rewritten (server --metrics)
+constexpr int METRICS_EXPORT_INTERVAL_MS = 1000;
 
 // Logging frequency
 constexpr int LOG_FRAME_INTERVAL = 60;  // Log every second (60 frames)
@@ -8,6 +8,8 @@
 
 #include "transport/IServerTransport.h"
 
+class Gauge;
+
 class ENetServerTransport : public IServerTransport {
  public:
   ENetServerTransport();
@@ -23,4 +25,12 @@ class ENetServerTransport : public IServerTransport {
   ENetHost* server;
   std::unordered_map<uint32_t, ENetPeer*> clientPeers;
   uint32_t nextClientId;
+
+  // Metrics: clients across all transports, and each client's RTT as ENet
+  // estimates it, labelled by listen port and client id
+  uint16_t listenPort = 0;
+  Gauge* connectedClients;
+  std::unordered_map<uint32_t, Gauge*> clientRtt;
+
+  std::string rttLabels(uint32_t clientId) const;
 };
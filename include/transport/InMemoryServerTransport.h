@@ -1,18 +1,33 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "InMemoryChannel.h"
 #include "transport/IServerTransport.h"
 
 // InMemoryServerTransport: Server-side transport for embedded server mode
-// Communicates with InMemoryTransport via a shared InMemoryChannel.
+// Communicates with InMemoryTransport via shared InMemoryChannels, one per
+// client. Embedded play attaches a single channel; load generators attach
+// many with addClient().
 
 class InMemoryServerTransport : public IServerTransport {
  public:
+  // Single embedded client (client id 1)
   explicit InMemoryServerTransport(std::shared_ptr<InMemoryChannel> channel);
+  // No clients yet; attach them with addClient()
+  InMemoryServerTransport() = default;
   ~InMemoryServerTransport() override = default;
 
+  // Attach another client's channel. Returns the client id the server will
+  // report for it (ids start at 1, in attach order).
+  uint32_t addClient(std::shared_ptr<InMemoryChannel> channel);
+  size_t getClientCount() const { return clients.size(); }
+
+  // Messages lost in either direction on any channel: full ring or over
+  // the ring's message size limit. Each one is also logged as an error.
+  uint64_t getDroppedCount() const;
+
   bool initialize(const std::string& address, uint16_t port) override;
   bool poll(TransportEvent& event) override;
   void send(uint32_t clientId, const uint8_t* data, size_t length) override;
@@ -20,9 +35,18 @@ class InMemoryServerTransport : public IServerTransport {
   void stop() override;
 
  private:
-  std::shared_ptr<InMemoryChannel> channel;
+  struct ClientSlot {
+    std::shared_ptr<InMemoryChannel> channel;
+    bool connected = false;
+  };
+
+  // Slot i has client id i + FIRST_CLIENT_ID
+  std::vector<ClientSlot> clients;
+  size_t pollCursor = 0;  // Slot polled next; rotates for fairness
   bool running = false;
-  bool clientConnected = false;
 
-  static constexpr uint32_t EMBEDDED_CLIENT_ID = 1;
+  static constexpr uint32_t FIRST_CLIENT_ID = 1;
+
+  bool pollSlot(size_t slotIndex, TransportEvent& event);
+  void pushToClient(size_t slotIndex, const uint8_t* data, size_t length);
 };
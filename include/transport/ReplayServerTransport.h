@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+
+#include "ReplayLog.h"
+#include "transport/IServerTransport.h"
+
+// ReplayServerTransport: Feeds a recorded ReplayLog back into a match
+// Call setTick() with the frame about to run; poll() then yields exactly
+// the events recorded during that frame. Outgoing traffic goes nowhere but
+// is counted and hashed, so two replays of one log can be compared.
+class ReplayServerTransport : public IServerTransport {
+ public:
+  // The reader must outlive the transport
+  explicit ReplayServerTransport(ReplayReader& reader);
+  ~ReplayServerTransport() override = default;
+
+  bool initialize(const std::string& address, uint16_t port) override;
+  bool poll(TransportEvent& event) override;
+  void send(uint32_t clientId, const uint8_t* data, size_t length) override;
+  void broadcast(const uint8_t* data, size_t length) override;
+  void stop() override;
+
+  void setTick(uint64_t tick) { currentTick = tick; }
+  bool isFinished() const { return currentTick >= reader.getTickCount(); }
+
+  // FNV-1a over every outgoing (clientId, payload) in order
+  uint64_t getOutputHash() const { return outputHash; }
+  uint64_t getBytesSent() const { return bytesSent; }
+  uint64_t getPacketsSent() const { return packetsSent; }
+
+ private:
+  void hashOutput(uint32_t clientId, const uint8_t* data, size_t length);
+
+  ReplayReader& reader;
+  ReplayRecord pending;
+  bool hasPending = false;
+  uint64_t currentTick = 0;
+  bool running = false;
+
+  uint64_t outputHash = 14695981039346656037ull;
+  uint64_t bytesSent = 0;
+  uint64_t packetsSent = 0;
+};
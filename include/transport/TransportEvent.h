@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -10,8 +11,79 @@ enum class TransportEventType {
   NONE
 };
 
+// TransportPayload: Bytes of a received message
+// Either a copy in owned storage, whose capacity is kept for the next
+// message, or a view over a buffer the transport lends (an ENet packet, an
+// in-memory ring record), which is handed back through its release function
+// when the payload is cleared, reassigned or destroyed. Valid until then.
+class TransportPayload {
+ public:
+  using ReleaseFn = void (*)(void* owner);
+
+  TransportPayload() = default;
+  ~TransportPayload() { releaseBorrowed(); }
+
+  TransportPayload(const TransportPayload&) = delete;
+  TransportPayload& operator=(const TransportPayload&) = delete;
+
+  const uint8_t* data() const { return bytes; }
+  size_t size() const { return length; }
+  bool empty() const { return length == 0; }
+
+  // Copy [first, last) into owned storage
+  void assign(const uint8_t* first, const uint8_t* last) {
+    releaseBorrowed();
+    storage.assign(first, last);
+    bytes = storage.data();
+    length = storage.size();
+  }
+
+  // View [bytes, bytes + length) without copying. release(owner) runs once
+  // the payload lets go of it; pass nullptr for buffers that outlive it.
+  void borrow(const uint8_t* borrowedBytes, size_t borrowedLength,
+              void* borrowedOwner = nullptr,
+              ReleaseFn releaseFn = nullptr) {
+    releaseBorrowed();
+    bytes = borrowedBytes;
+    length = borrowedLength;
+    owner = borrowedOwner;
+    release = releaseFn;
+  }
+
+  // Empty, releasing any borrowed buffer; owned capacity is kept
+  void clear() {
+    releaseBorrowed();
+    bytes = nullptr;
+    length = 0;
+  }
+
+ private:
+  void releaseBorrowed() {
+    if (release != nullptr) {
+      release(owner);
+    }
+    owner = nullptr;
+    release = nullptr;
+  }
+
+  std::vector<uint8_t> storage;
+  const uint8_t* bytes = nullptr;
+  size_t length = 0;
+  void* owner = nullptr;
+  ReleaseFn release = nullptr;
+};
+
+// Filled in by a transport's poll(). Keep one event around and pass it to
+// every poll so its storage is reused, and clear() it once the last event
+// has been dispatched so borrowed buffers go back to the transport.
 struct TransportEvent {
   TransportEventType type = TransportEventType::NONE;
   uint32_t clientId = 0;
-  std::vector<uint8_t> data;
+  TransportPayload data;
+
+  void clear() {
+    type = TransportEventType::NONE;
+    clientId = 0;
+    data.clear();
+  }
 };
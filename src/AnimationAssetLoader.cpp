@@ -1,5 +1,10 @@
 #include "AnimationAssetLoader.h"
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
 #include "Logger.h"
 #include "config/AnimationConfig.h"
 #include "config/PlayerConfig.h"
@@ -15,33 +20,49 @@
 // Row 7: Walk West (4 frames, y=224)
 // Top-right: Walk Northwest (4 frames, y=0, x=128+)
 
-void AnimationAssetLoader::loadPlayerAnimations(
-    AnimationController& controller, const std::string& spriteSheetPath) {
+const AnimationLibrary& AnimationAssetLoader::getPlayerLibrary(
+    const std::string& spriteSheetPath) {
+  // Libraries are never freed: controllers hold plain pointers to them
+  static std::mutex mutex;
+  static std::unordered_map<std::string, std::unique_ptr<AnimationLibrary>>
+      libraries;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  std::unique_ptr<AnimationLibrary>& library = libraries[spriteSheetPath];
+  if (library) {
+    return *library;
+  }
+
   // TODO: In future, load from JSON metadata if available
   // For now, use hardcoded layout
+  library = std::make_unique<AnimationLibrary>();
+  library->setDirectionClip(AnimationDirection::IDLE,
+                            library->addClip(createIdleAnimation()));
 
-  // Add idle animation
-  controller.addAnimation("idle", createIdleAnimation());
-
-  // Add walk animations for all 8 directions
-  controller.addAnimation("walk_north",
-                          createWalkAnimation(AnimationDirection::NORTH));
-  controller.addAnimation("walk_northeast",
-                          createWalkAnimation(AnimationDirection::NORTHEAST));
-  controller.addAnimation("walk_east",
-                          createWalkAnimation(AnimationDirection::EAST));
-  controller.addAnimation("walk_southeast",
-                          createWalkAnimation(AnimationDirection::SOUTHEAST));
-  controller.addAnimation("walk_south",
-                          createWalkAnimation(AnimationDirection::SOUTH));
-  controller.addAnimation("walk_southwest",
-                          createWalkAnimation(AnimationDirection::SOUTHWEST));
-  controller.addAnimation("walk_west",
-                          createWalkAnimation(AnimationDirection::WEST));
-  controller.addAnimation("walk_northwest",
-                          createWalkAnimation(AnimationDirection::NORTHWEST));
+  // Walk animations for all 8 directions
+  static const std::pair<AnimationDirection, const char*> walkClips[] = {
+      {AnimationDirection::NORTH, "walk_north"},
+      {AnimationDirection::NORTHEAST, "walk_northeast"},
+      {AnimationDirection::EAST, "walk_east"},
+      {AnimationDirection::SOUTHEAST, "walk_southeast"},
+      {AnimationDirection::SOUTH, "walk_south"},
+      {AnimationDirection::SOUTHWEST, "walk_southwest"},
+      {AnimationDirection::WEST, "walk_west"},
+      {AnimationDirection::NORTHWEST, "walk_northwest"},
+  };
+  for (const auto& [dir, name] : walkClips) {
+    AnimationClip clip = createWalkAnimation(dir);
+    clip.name = name;
+    library->setDirectionClip(dir, library->addClip(clip));
+  }
 
   Logger::info("Loaded player animations from: " + spriteSheetPath);
+  return *library;
+}
+
+void AnimationAssetLoader::loadPlayerAnimations(
+    AnimationController& controller, const std::string& spriteSheetPath) {
+  controller.setLibrary(&getPlayerLibrary(spriteSheetPath));
 }
 
 AnimationClip AnimationAssetLoader::createIdleAnimation() {
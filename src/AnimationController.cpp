@@ -1,30 +1,56 @@
 #include "AnimationController.h"
 
-#include "Logger.h"
-#include "config/AnimationConfig.h"
+#include <algorithm>
+#include <cmath>
+
+#include "AnimationSystem.h"
 #include "config/PlayerConfig.h"
 
-AnimationController::AnimationController()
-    : currentAnimationName("idle"),
-      currentFrameIndex(0),
-      frameTimer(0.0f),
-      currentDirection(AnimationDirection::IDLE) {}
+AnimationController::AnimationController(const AnimationController& other)
+    : library(other.library),
+      currentClip(other.currentClip),
+      currentDirection(other.currentDirection),
+      elapsedMs(other.getElapsedMs()) {}
+
+AnimationController::~AnimationController() {
+  if (system) {
+    system->removeSlot(slot);
+  }
+}
+
+AnimationController& AnimationController::operator=(
+    const AnimationController& other) {
+  if (this == &other) return *this;
+  float elapsed = other.getElapsedMs();
+  library = other.library;
+  currentClip = other.currentClip;
+  currentDirection = other.currentDirection;
+  setElapsedMs(elapsed);
+  if (system) {
+    system->cycleMs[slot] = getCycleMs();
+  }
+  return *this;
+}
 
-void AnimationController::addAnimation(const std::string& name,
-                                       const AnimationClip& clip) {
-  animations[name] = clip;
+void AnimationController::setLibrary(const AnimationLibrary* newLibrary) {
+  library = newLibrary;
+  currentDirection = AnimationDirection::IDLE;
+  playAnimation(library ? library->getDirectionClip(currentDirection) : 0);
 }
 
-const AnimationClip& AnimationController::getAnimation(
-    const std::string& name) const {
-  auto it = animations.find(name);
-  assert(it != animations.end() && "Animation not found");
-  return it->second;
+const std::string& AnimationController::getCurrentAnimationName() const {
+  static const std::string idle = "idle";
+  return library ? library->getClip(currentClip).name : idle;
+}
+
+int AnimationController::getCurrentFrameIndex() const {
+  if (!library) return 0;
+  return std::max(library->frameAt(currentClip, getElapsedMs()), 0);
 }
 
 void AnimationController::updateAnimationState(float vx, float vy) {
   // If no animations loaded (e.g., on server), skip animation updates
-  if (animations.empty()) {
+  if (!library) {
     return;
   }
 
@@ -34,78 +60,27 @@ void AnimationController::updateAnimationState(float vx, float vy) {
   if (newDirection != currentDirection) {
     currentDirection = newDirection;
 
-    std::string newAnimationName;
-    if (newDirection == AnimationDirection::IDLE) {
-      newAnimationName = "idle";
-    } else {
-      // Map direction to animation name
-      switch (newDirection) {
-        case AnimationDirection::NORTH:
-          newAnimationName = "walk_north";
-          break;
-        case AnimationDirection::NORTHEAST:
-          newAnimationName = "walk_northeast";
-          break;
-        case AnimationDirection::EAST:
-          newAnimationName = "walk_east";
-          break;
-        case AnimationDirection::SOUTHEAST:
-          newAnimationName = "walk_southeast";
-          break;
-        case AnimationDirection::SOUTH:
-          newAnimationName = "walk_south";
-          break;
-        case AnimationDirection::SOUTHWEST:
-          newAnimationName = "walk_southwest";
-          break;
-        case AnimationDirection::WEST:
-          newAnimationName = "walk_west";
-          break;
-        case AnimationDirection::NORTHWEST:
-          newAnimationName = "walk_northwest";
-          break;
-        default:
-          newAnimationName = "idle";
-      }
-    }
-
-    if (newAnimationName != currentAnimationName) {
-      playAnimation(newAnimationName);
+    AnimationClipId clip = library->getDirectionClip(newDirection);
+    if (clip != currentClip) {
+      playAnimation(clip);
     }
   }
 }
 
 void AnimationController::advanceFrame(float deltaTime) {
-  if (animations.empty()) return;
-
-  const AnimationClip& currentAnim = getAnimation(currentAnimationName);
-  if (currentAnim.getFrameCount() == 0) return;
-
-  frameTimer += deltaTime;
-
-  const AnimationFrame& currentFrame = currentAnim.getFrame(currentFrameIndex);
-
-  // Advance to next frame if timer exceeded
-  while (frameTimer >= currentFrame.duration) {
-    frameTimer -= currentFrame.duration;
-    currentFrameIndex++;
+  if (!library) return;
 
-    // Loop or clamp
-    if (currentFrameIndex >= currentAnim.getFrameCount()) {
-      if (currentAnim.loop) {
-        currentFrameIndex = 0;
-      } else {
-        currentFrameIndex = currentAnim.getFrameCount() - 1;
-        frameTimer = 0.0f;
-        break;
-      }
-    }
-  }
+  // Looping clips wrap at their cycle length; NO_CYCLE never does
+  float t = getElapsedMs() + deltaTime;
+  float cycle = getCycleMs();
+  setElapsedMs(t - cycle * std::floor(t / cycle));
 }
 
 void AnimationController::getCurrentFrame(int& outSrcX, int& outSrcY,
                                           int& outSrcW, int& outSrcH) const {
-  if (animations.empty()) {
+  int frameIndex =
+      library ? library->frameAt(currentClip, getElapsedMs()) : -1;
+  if (frameIndex < 0) {
     // Fallback to full sprite
     outSrcX = 0;
     outSrcY = 0;
@@ -114,33 +89,37 @@ void AnimationController::getCurrentFrame(int& outSrcX, int& outSrcY,
     return;
   }
 
-  const AnimationClip& currentAnim = getAnimation(currentAnimationName);
-  if (currentAnim.getFrameCount() == 0) {
-    outSrcX = 0;
-    outSrcY = 0;
-    outSrcW = Config::Player::FRAME_WIDTH;
-    outSrcH = Config::Player::FRAME_HEIGHT;
-    return;
-  }
-
-  const AnimationFrame& frame = currentAnim.getFrame(currentFrameIndex);
+  const AnimationFrame& frame =
+      library->getClip(currentClip).getFrame(frameIndex);
   outSrcX = frame.srcX;
   outSrcY = frame.srcY;
   outSrcW = frame.srcW;
   outSrcH = frame.srcH;
 }
 
-void AnimationController::reset() {
-  currentFrameIndex = 0;
-  frameTimer = 0.0f;
+void AnimationController::reset() { setElapsedMs(0.0f); }
+
+float AnimationController::getElapsedMs() const {
+  return system ? system->elapsedMs[slot] : elapsedMs;
 }
 
-void AnimationController::playAnimation(const std::string& name) {
-  // Tiger Style: Validate animation exists
-  assert(animations.find(name) != animations.end() &&
-         "Attempted to play non-existent animation");
+void AnimationController::setElapsedMs(float ms) {
+  if (system) {
+    system->elapsedMs[slot] = ms;
+  } else {
+    elapsedMs = ms;
+  }
+}
 
-  currentAnimationName = name;
-  currentFrameIndex = 0;
-  frameTimer = 0.0f;
+float AnimationController::getCycleMs() const {
+  return library ? library->getCycleMs(currentClip)
+                 : AnimationLibrary::NO_CYCLE;
+}
+
+void AnimationController::playAnimation(AnimationClipId clip) {
+  currentClip = clip;
+  setElapsedMs(0.0f);
+  if (system) {
+    system->cycleMs[slot] = getCycleMs();
+  }
 }
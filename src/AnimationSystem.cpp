@@ -1,43 +1,76 @@
 #include "AnimationSystem.h"
 
-#include <algorithm>
+#include <cassert>
 
 #include "AnimationController.h"
 #include "Logger.h"
 
-AnimationSystem::AnimationSystem() {
+AnimationSystem::AnimationSystem(EventBus& bus) {
   // Subscribe to UpdateEvent to advance animations every frame
-  EventBus::instance().subscribe<UpdateEvent>(
-      [this](const UpdateEvent& e) { onUpdate(e); });
+  subscriptions.push_back(bus.subscribeScoped<UpdateEvent>(
+      [this](const UpdateEvent& e) { onUpdate(e); }));
 
   Logger::info("AnimationSystem initialized");
 }
 
+AnimationSystem::~AnimationSystem() {
+  for (size_t slot = 0; slot < entities.size(); ++slot) {
+    AnimationController* controller = entities[slot]->getAnimationController();
+    controller->elapsedMs = elapsedMs[slot];
+    controller->system = nullptr;
+  }
+}
+
 void AnimationSystem::registerEntity(Animatable* entity) {
   assert(entity != nullptr && "Cannot register null entity");
-  assert(entity->getAnimationController() != nullptr &&
-         "Entity must have AnimationController");
+  AnimationController* controller = entity->getAnimationController();
+  assert(controller != nullptr && "Entity must have AnimationController");
 
+  if (controller->system == this) return;
+  if (controller->system) {
+    controller->system->unregisterEntity(entity);
+  }
+
+  // The slot takes over the controller's own clock
+  controller->slot = static_cast<uint32_t>(entities.size());
   entities.push_back(entity);
+  elapsedMs.push_back(controller->elapsedMs);
+  cycleMs.push_back(controller->getCycleMs());
+  controller->system = this;
+
   Logger::debug("Registered entity with AnimationSystem (total: " +
                 std::to_string(entities.size()) + ")");
 }
 
 void AnimationSystem::unregisterEntity(Animatable* entity) {
-  auto it = std::find(entities.begin(), entities.end(), entity);
-  if (it != entities.end()) {
-    entities.erase(it);
-    Logger::debug("Unregistered entity from AnimationSystem (total: " +
-                  std::to_string(entities.size()) + ")");
+  AnimationController* controller = entity->getAnimationController();
+  if (!controller || controller->system != this) return;
+
+  uint32_t slot = controller->slot;
+  controller->elapsedMs = elapsedMs[slot];
+  controller->system = nullptr;
+  removeSlot(slot);
+
+  Logger::debug("Unregistered entity from AnimationSystem (total: " +
+                std::to_string(entities.size()) + ")");
+}
+
+void AnimationSystem::advance(float deltaTime) {
+  float* elapsed = elapsedMs.data();
+  const float* cycle = cycleMs.data();
+  size_t count = elapsedMs.size();
+
+  // No virtual calls, and both arms computed so the choice is a select:
+  // this vectorizes. A step longer than a whole cycle wraps once here and
+  // the rest of the way over the next ticks (frameAt copes meanwhile).
+  for (size_t i = 0; i < count; ++i) {
+    float t = elapsed[i] + deltaTime;
+    float wrapped = t - cycle[i];
+    elapsed[i] = wrapped >= 0.0f ? wrapped : t;
   }
 }
 
 void AnimationSystem::onUpdate(const UpdateEvent& e) {
   // Advance all animations by deltaTime
-  for (Animatable* entity : entities) {
-    AnimationController* controller = entity->getAnimationController();
-    if (controller) {
-      controller->advanceFrame(e.deltaTime);
-    }
-  }
+  advance(e.deltaTime);
 }
@@ -0,0 +1,126 @@
+#include "AssetLoader.h"
+
+#include <algorithm>
+
+#include "Logger.h"
+
+namespace {
+
+unsigned defaultWorkerCount() {
+#ifdef __EMSCRIPTEN__
+  return 0;
+#else
+  // Leave a core for the render thread; decoding rarely needs more than 4
+  unsigned cores = std::thread::hardware_concurrency();
+  return std::clamp(cores > 1 ? cores - 1 : 1u, 1u, 4u);
+#endif
+}
+
+}  // namespace
+
+AssetLoader& AssetLoader::instance() {
+  static AssetLoader instance(defaultWorkerCount());
+  return instance;
+}
+
+AssetLoader::AssetLoader(unsigned workerCount) {
+  for (unsigned i = 0; i < workerCount; ++i) {
+    workers.emplace_back([this]() { workerLoop(); });
+  }
+  Logger::info("AssetLoader started with " + std::to_string(workerCount) +
+               " worker threads");
+}
+
+AssetLoader::~AssetLoader() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+    jobs.clear();
+  }
+  jobReady.notify_all();
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+}
+
+void AssetLoader::submitWithUpload(std::function<Upload()> decode) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    inFlight++;
+  }
+  auto job = [this, decode = std::move(decode)]() {
+    Upload upload = decode();
+    std::lock_guard<std::mutex> lock(mutex);
+    uploads.push_back(std::move(upload));
+  };
+  if (workers.empty()) {
+    // Decoded later, inside pump()
+    std::lock_guard<std::mutex> lock(mutex);
+    jobs.push_back(std::move(job));
+  } else {
+    enqueue(std::move(job));
+  }
+}
+
+size_t AssetLoader::pump(size_t budget) {
+  if (workers.empty()) {
+    std::function<void()> job;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!jobs.empty()) {
+        job = std::move(jobs.front());
+        jobs.pop_front();
+      }
+    }
+    if (job) job();
+  }
+
+  size_t spent = 0;
+  size_t count = 0;
+  while (true) {
+    Upload upload;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (uploads.empty()) break;
+      if (count > 0 && spent + uploads.front().cost > budget) break;
+      upload = std::move(uploads.front());
+      uploads.pop_front();
+    }
+
+    // Outside the lock: uploads may submit follow-up jobs
+    if (upload.run) upload.run();
+    spent += upload.cost;
+    count++;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    inFlight--;
+  }
+  return count;
+}
+
+size_t AssetLoader::getPendingCount() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return inFlight;
+}
+
+void AssetLoader::enqueue(std::function<void()> job) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    jobs.push_back(std::move(job));
+  }
+  jobReady.notify_one();
+}
+
+void AssetLoader::workerLoop() {
+  while (true) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      jobReady.wait(lock, [this]() { return stopping || !jobs.empty(); });
+      if (stopping) return;
+      job = std::move(jobs.front());
+      jobs.pop_front();
+    }
+    job();
+  }
+}
@@ -0,0 +1,91 @@
+#include "AtlasManifest.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "Logger.h"
+
+namespace {
+
+std::string directoryOf(const std::string& path) {
+  size_t slash = path.find_last_of('/');
+  return slash == std::string::npos ? "" : path.substr(0, slash + 1);
+}
+
+}  // namespace
+
+bool AtlasManifest::load(const std::string& path) {
+  pages.clear();
+  images.clear();
+  baseDirectory = directoryOf(path);
+
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  std::string line;
+  int lineNumber = 0;
+  while (std::getline(file, line)) {
+    lineNumber++;
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    std::istringstream fields(line);
+    std::string kind;
+    fields >> kind;
+
+    bool ok = false;
+    if (kind == "page") {
+      int index;
+      AtlasPage page;
+      ok = static_cast<bool>(fields >> index >> page.file >> page.width >>
+                             page.height) &&
+           index == static_cast<int>(pages.size());
+      if (ok) pages.push_back(page);
+    } else if (kind == "image") {
+      std::string imagePath;
+      AtlasEntry entry;
+      ok = static_cast<bool>(fields >> imagePath >> entry.page >> entry.x >>
+                             entry.y >> entry.width >> entry.height) &&
+           entry.page >= 0 && entry.page < static_cast<int>(pages.size());
+      if (ok) images[imagePath] = entry;
+    }
+
+    if (!ok) {
+      Logger::error("AtlasManifest: Malformed line " +
+                    std::to_string(lineNumber) + " in " + path);
+      pages.clear();
+      images.clear();
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool AtlasManifest::save(const std::string& path) const {
+  std::ofstream file(path);
+  if (!file.is_open()) {
+    Logger::error("AtlasManifest: Failed to write " + path);
+    return false;
+  }
+
+  file << "# Generated by AtlasPacker - do not edit\n";
+  for (size_t i = 0; i < pages.size(); ++i) {
+    const AtlasPage& page = pages[i];
+    file << "page " << i << " " << page.file << " " << page.width << " "
+         << page.height << "\n";
+  }
+  for (const auto& [imagePath, entry] : images) {
+    file << "image " << imagePath << " " << entry.page << " " << entry.x << " "
+         << entry.y << " " << entry.width << " " << entry.height << "\n";
+  }
+  return true;
+}
+
+const AtlasEntry* AtlasManifest::find(const std::string& path) const {
+  auto it = images.find(path);
+  return it != images.end() ? &it->second : nullptr;
+}
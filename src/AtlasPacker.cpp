@@ -0,0 +1,70 @@
+#include "AtlasPacker.h"
+
+#include <algorithm>
+#include <numeric>
+
+AtlasPacker::AtlasPacker(int pageSize, int padding)
+    : pageSize(pageSize), padding(padding) {}
+
+std::vector<AtlasPlacement> AtlasPacker::pack(const std::vector<Size>& sizes) {
+  pages.clear();
+  std::vector<AtlasPlacement> placements(sizes.size(),
+                                         AtlasPlacement{-1, 0, 0});
+
+  // Tallest first keeps shelves tight; ties keep input order
+  std::vector<size_t> order(sizes.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return sizes[a].height > sizes[b].height;
+  });
+
+  for (size_t index : order) {
+    const Size& size = sizes[index];
+    if (size.width <= 0 || size.height <= 0 || size.width > pageSize ||
+        size.height > pageSize) {
+      continue;  // Left unplaced
+    }
+
+    AtlasPlacement& placement = placements[index];
+    for (size_t p = 0; p < pages.size() && placement.page < 0; ++p) {
+      if (placeOnPage(pages[p], size.width, size.height, placement.x,
+                      placement.y)) {
+        placement.page = static_cast<int>(p);
+      }
+    }
+    if (placement.page < 0) {
+      pages.emplace_back();
+      bool placed = placeOnPage(pages.back(), size.width, size.height,
+                                placement.x, placement.y);
+      (void)placed;  // An empty page always fits an image <= pageSize
+      placement.page = static_cast<int>(pages.size() - 1);
+    }
+  }
+
+  return placements;
+}
+
+bool AtlasPacker::placeOnPage(Page& page, int width, int height, int& x,
+                              int& y) {
+  Shelf* shelf = nullptr;
+  for (Shelf& candidate : page.shelves) {
+    if (height <= candidate.height && candidate.cursorX + width <= pageSize) {
+      shelf = &candidate;
+      break;
+    }
+  }
+
+  if (!shelf) {
+    if (page.nextShelfY + height > pageSize) return false;
+    page.shelves.push_back(Shelf{page.nextShelfY, height, 0});
+    page.nextShelfY += height + padding;
+    shelf = &page.shelves.back();
+  }
+
+  x = shelf->cursorX;
+  y = shelf->y;
+  shelf->cursorX += width + padding;
+  page.usedWidth = std::max(page.usedWidth, x + width);
+  page.usedHeight = std::max(page.usedHeight, y + height);
+  return true;
+}
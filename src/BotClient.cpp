@@ -0,0 +1,208 @@
+#include "BotClient.h"
+
+#include <cassert>
+#include <cstring>
+
+#include "Logger.h"
+#include "NetworkProtocol.h"
+#include "config/TimingConfig.h"
+
+namespace {
+
+constexpr uint8_t MOVE_LEFT = 1 << 0;
+constexpr uint8_t MOVE_RIGHT = 1 << 1;
+constexpr uint8_t MOVE_UP = 1 << 2;
+constexpr uint8_t MOVE_DOWN = 1 << 3;
+
+constexpr uint8_t CIRCLE_DIRECTIONS[] = {
+    MOVE_RIGHT, MOVE_RIGHT | MOVE_DOWN, MOVE_DOWN, MOVE_DOWN | MOVE_LEFT,
+    MOVE_LEFT,  MOVE_LEFT | MOVE_UP,    MOVE_UP,   MOVE_UP | MOVE_RIGHT};
+constexpr size_t CIRCLE_DIRECTION_COUNT =
+    sizeof(CIRCLE_DIRECTIONS) / sizeof(CIRCLE_DIRECTIONS[0]);
+
+// StateUpdate layout: type(1) serverTick(4) playerCount(2) then 31 bytes per
+// player starting with playerId(4), x(4), y(4)
+constexpr size_t STATE_UPDATE_HEADER_SIZE = 7;
+constexpr size_t PLAYER_STATE_SIZE = 31;
+
+uint32_t readLE32(const uint8_t* data) {
+  return static_cast<uint32_t>(data[0]) |
+         (static_cast<uint32_t>(data[1]) << 8) |
+         (static_cast<uint32_t>(data[2]) << 16) |
+         (static_cast<uint32_t>(data[3]) << 24);
+}
+
+float readLEFloat(const uint8_t* data) {
+  uint32_t bits = readLE32(data);
+  float value;
+  std::memcpy(&value, &bits, sizeof(float));
+  return value;
+}
+
+}  // namespace
+
+bool parseBotPattern(const std::string& name, BotPattern& outPattern) {
+  if (name == "idle") {
+    outPattern = BotPattern::Idle;
+  } else if (name == "random") {
+    outPattern = BotPattern::RandomWalk;
+  } else if (name == "circle") {
+    outPattern = BotPattern::Circle;
+  } else if (name == "zigzag") {
+    outPattern = BotPattern::Zigzag;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+const char* botPatternName(BotPattern pattern) {
+  switch (pattern) {
+    case BotPattern::Idle:
+      return "idle";
+    case BotPattern::RandomWalk:
+      return "random";
+    case BotPattern::Circle:
+      return "circle";
+    case BotPattern::Zigzag:
+      return "zigzag";
+  }
+  return "unknown";
+}
+
+BotClient::BotClient(std::unique_ptr<INetworkTransport> transport,
+                     BotPattern pattern, uint32_t seed)
+    : transport(std::move(transport)), pattern(pattern), rng(seed) {
+  assert(this->transport && "BotClient needs a transport");
+  // ~1s of samples per bot up front; grows for longer runs
+  tickIntervalsMs.reserve(Config::Timing::TARGET_FPS);
+}
+
+BotClient::~BotClient() {
+  if (transport && transport->isConnected()) {
+    transport->disconnect();
+  }
+}
+
+bool BotClient::connect(const std::string& host, uint16_t port) {
+  return transport->connect(host, port);
+}
+
+void BotClient::disconnect() {
+  if (transport->isConnected()) {
+    transport->disconnect();
+  }
+}
+
+void BotClient::updateDirection(uint64_t frame) {
+  const uint64_t framesPerSecond = Config::Timing::TARGET_FPS;
+
+  switch (pattern) {
+    case BotPattern::Idle:
+      directionMask = 0;
+      break;
+    case BotPattern::RandomWalk:
+      if (frame >= nextDirectionChangeFrame) {
+        // Any combination of the four keys, including standing still
+        directionMask = static_cast<uint8_t>(rng() & 0x0F);
+        std::uniform_int_distribution<uint64_t> hold(framesPerSecond / 2,
+                                                     framesPerSecond * 2);
+        nextDirectionChangeFrame = frame + hold(rng);
+      }
+      break;
+    case BotPattern::Circle:
+      directionMask =
+          CIRCLE_DIRECTIONS[(frame / framesPerSecond) % CIRCLE_DIRECTION_COUNT];
+      break;
+    case BotPattern::Zigzag:
+      directionMask = ((frame / framesPerSecond) % 2 == 0) ? MOVE_LEFT
+                                                            : MOVE_RIGHT;
+      directionMask |= MOVE_DOWN;
+      break;
+  }
+}
+
+void BotClient::sendInput(uint64_t frame) {
+  if (!transport->isConnected()) return;
+
+  updateDirection(frame);
+
+  ClientInputPacket packet;
+  packet.inputSequence = inputSequence++;
+  packet.moveLeft = (directionMask & MOVE_LEFT) != 0;
+  packet.moveRight = (directionMask & MOVE_RIGHT) != 0;
+  packet.moveUp = (directionMask & MOVE_UP) != 0;
+  packet.moveDown = (directionMask & MOVE_DOWN) != 0;
+
+  std::vector<uint8_t> data = serialize(packet);
+  transport->send(data.data(), data.size(), true);
+  bytesSent += data.size();
+}
+
+void BotClient::receive() {
+  while (transport->poll(incoming)) {
+    if (incoming.type == TransportEventType::RECEIVE) {
+      handlePacket(incoming.data.data(), incoming.data.size());
+    }
+  }
+  incoming.clear();
+}
+
+void BotClient::handlePacket(const uint8_t* data, size_t size) {
+  if (size == 0) return;
+
+  bytesReceived += size;
+  packetsReceived++;
+
+  PacketType type = static_cast<PacketType>(data[0]);
+  switch (type) {
+    case PacketType::PlayerJoined:
+      // The server sends our own PlayerJoined before any other
+      if (!joined) {
+        PlayerJoinedPacket packet = deserializePlayerJoined(data, size);
+        playerId = packet.playerId;
+        joined = true;
+      }
+      break;
+    case PacketType::StateUpdate:
+      handleStateUpdate(data, size);
+      break;
+    default:
+      // Counted for bandwidth only
+      break;
+  }
+}
+
+void BotClient::handleStateUpdate(const uint8_t* data, size_t size) {
+  if (size < STATE_UPDATE_HEADER_SIZE) return;
+
+  stateUpdatesReceived++;
+  uint32_t serverTick = readLE32(data + 1);
+  auto now = std::chrono::steady_clock::now();
+
+  if (stateUpdatesReceived > 1 && serverTick > lastServerTick) {
+    float elapsedMs =
+        std::chrono::duration<float, std::milli>(now - lastStateUpdateTime)
+            .count();
+    tickIntervalsMs.push_back(elapsedMs /
+                              static_cast<float>(serverTick - lastServerTick));
+  }
+  lastServerTick = serverTick;
+  lastStateUpdateTime = now;
+
+  if (!joined) return;
+
+  // Scan player ids only; decode position for our own entry
+  uint16_t playerCount = static_cast<uint16_t>(data[5] | (data[6] << 8));
+  size_t end = STATE_UPDATE_HEADER_SIZE + playerCount * PLAYER_STATE_SIZE;
+  if (size < end) return;
+
+  for (size_t offset = STATE_UPDATE_HEADER_SIZE; offset < end;
+       offset += PLAYER_STATE_SIZE) {
+    if (readLE32(data + offset) == playerId) {
+      x = readLEFloat(data + offset + 4);
+      y = readLEFloat(data + offset + 8);
+      break;
+    }
+  }
+}
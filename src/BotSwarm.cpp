@@ -0,0 +1,348 @@
+#include "BotSwarm.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <random>
+#include <thread>
+
+#include "AllocationCounter.h"
+#include "InMemoryChannel.h"
+#include "Logger.h"
+#include "Match.h"
+#include "NetworkServer.h"
+#include "ServerGameState.h"
+#include "SharedWorld.h"
+#include "WorldConfig.h"
+#include "config/ScreenConfig.h"
+#include "config/TimingConfig.h"
+#include "transport/ENetTransport.h"
+#include "transport/InMemoryServerTransport.h"
+#include "transport/InMemoryTransport.h"
+
+PercentileSummary summarizePercentiles(std::vector<float>& samples) {
+  PercentileSummary summary;
+  summary.count = samples.size();
+  if (samples.empty()) {
+    return summary;
+  }
+
+  std::sort(samples.begin(), samples.end());
+  auto rank = [&samples](float percentile) {
+    size_t index = static_cast<size_t>(
+        std::ceil(percentile * static_cast<float>(samples.size()))) - 1;
+    return samples[std::min(index, samples.size() - 1)];
+  };
+
+  summary.p50 = rank(0.50f);
+  summary.p90 = rank(0.90f);
+  summary.p99 = rank(0.99f);
+  summary.max = samples.back();
+  return summary;
+}
+
+namespace {
+
+void printSummary(std::ostream& out, const char* label,
+                  const PercentileSummary& summary, const char* unit) {
+  out << "  " << label << ": ";
+  if (summary.count == 0) {
+    out << "n/a\n";
+    return;
+  }
+  out << "p50 " << summary.p50 << unit << ", p90 " << summary.p90 << unit
+      << ", p99 " << summary.p99 << unit << ", max " << summary.max << unit
+      << " (" << summary.count << " samples)\n";
+}
+
+// How far soak enemies land from the map spawn point they are based on
+constexpr float SPAWN_SCATTER = 64.0f;
+
+std::vector<EnemySpawn> scatterEnemySpawns(
+    size_t count, const std::vector<EnemySpawn>& mapSpawns, float worldWidth,
+    float worldHeight, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> scatter(-SPAWN_SCATTER, SPAWN_SCATTER);
+  std::uniform_real_distribution<float> anyX(0.0f, worldWidth);
+  std::uniform_real_distribution<float> anyY(0.0f, worldHeight);
+
+  std::vector<EnemySpawn> spawns(count);
+  for (size_t i = 0; i < count; ++i) {
+    EnemySpawn& spawn = spawns[i];
+    spawn.name = "soak";
+    if (mapSpawns.empty()) {
+      spawn.type = EnemyType::Slime;
+      spawn.x = anyX(rng);
+      spawn.y = anyY(rng);
+    } else {
+      const EnemySpawn& base = mapSpawns[i % mapSpawns.size()];
+      spawn.type = base.type;
+      spawn.x = base.x + scatter(rng);
+      spawn.y = base.y + scatter(rng);
+    }
+  }
+  return spawns;
+}
+
+void addPhases(TickPhaseTimes& sum, const TickPhaseTimes& phases) {
+  sum.enemiesMs += phases.enemiesMs;
+  sum.effectsMs += phases.effectsMs;
+  sum.objectivesMs += phases.objectivesMs;
+  sum.eventsMs += phases.eventsMs;
+  sum.broadcastMs += phases.broadcastMs;
+}
+
+}  // namespace
+
+void printBotSwarmReport(const BotSwarmReport& report, std::ostream& out) {
+  double simulatedSeconds = static_cast<double>(report.frames) /
+                            Config::Timing::TARGET_FPS;
+
+  out << std::fixed << std::setprecision(2);
+  out << "=== Bot Swarm Report ===\n"
+      << "  Frames: " << report.frames << " (" << simulatedSeconds
+      << "s simulated, " << report.wallSeconds << "s wall)\n"
+      << "  Bots: " << report.botsJoined << " joined / "
+      << report.botsConnected << " connected\n";
+
+  printSummary(out, "Server tick time", report.serverTickMs, "ms");
+  if (report.serverTickMs.count > 0) {
+    const TickPhaseTimes& phases = report.meanPhaseMs;
+    out << "  Ticks over " << Config::Timing::TARGET_DELTA_MS
+        << "ms budget: " << report.ticksOverBudget << "\n"
+        << "  Server throughput: " << report.serverTicksPerSecond
+        << " ticks/s ("
+        << report.serverTicksPerSecond / Config::Timing::TARGET_FPS
+        << "x real time)\n"
+        << "  Mean tick phases: enemies " << phases.enemiesMs << "ms, effects "
+        << phases.effectsMs << "ms, objectives " << phases.objectivesMs
+        << "ms, events " << phases.eventsMs << "ms, broadcast "
+        << phases.broadcastMs << "ms, network " << report.meanNetworkMs
+        << "ms\n";
+    printSummary(out, "Allocations per tick", report.allocationsPerTick, "");
+    printSummary(out, "Bytes serialized per tick",
+                 report.bytesSerializedPerTick, " B");
+    out << "  Messages dropped: " << report.messagesDropped << "\n";
+  }
+  printSummary(out, "Observed tick interval", report.observedTickIntervalMs,
+               "ms");
+  printSummary(out, "Downstream per bot", report.downstreamKbpsPerBot,
+               " kbps");
+  printSummary(out, "Upstream per bot", report.upstreamKbpsPerBot, " kbps");
+  printSummary(out, "Server egress per frame", report.downstreamBytesPerFrame,
+               " B");
+  out << "  Total: " << report.totalBytesDown << " B down, "
+      << report.totalBytesUp << " B up\n";
+}
+
+BotSwarm::BotSwarm(const BotSwarmConfig& config) : config(config) {
+  assert(config.botCount > 0 && "BotSwarm needs at least one bot");
+  assert(config.portCount > 0 && "BotSwarm needs at least one port");
+}
+
+BotSwarm::~BotSwarm() {
+  // Bots disconnect before the in-process server goes away
+  bots.clear();
+  match.reset();
+  sharedWorld.reset();
+}
+
+bool BotSwarm::start() {
+  if (config.inProcess && !startInProcessServer()) {
+    return false;
+  }
+  return connectBots();
+}
+
+bool BotSwarm::startInProcessServer() {
+  WorldConfig world(static_cast<float>(Config::Screen::WIDTH),
+                    static_cast<float>(Config::Screen::HEIGHT));
+  if (!config.mapPath.empty()) {
+    sharedWorld = std::make_unique<SharedWorld>();
+    if (!sharedWorld->load(config.mapPath)) {
+      return false;
+    }
+    world = sharedWorld->getWorldConfig();
+  }
+  if (config.enemyCount > 0) {
+    const std::vector<EnemySpawn> noMapSpawns;
+    const std::vector<EnemySpawn>& mapSpawns =
+        sharedWorld ? sharedWorld->getMap().getEnemySpawns() : noMapSpawns;
+    enemySpawns = scatterEnemySpawns(config.enemyCount, mapSpawns, world.width,
+                                     world.height, config.seed);
+    world.enemySpawns = &enemySpawns;
+  }
+
+  auto transport = std::make_unique<InMemoryServerTransport>();
+  serverTransport = transport.get();
+  match = std::make_unique<Match>(0, std::move(transport), world);
+
+  // Bots are created before initialize() so the transport knows its clients
+  bots.reserve(config.botCount);
+  for (size_t i = 0; i < config.botCount; ++i) {
+    auto channel = createInMemoryChannel();
+    serverTransport->addClient(channel);
+    bots.push_back(std::make_unique<BotClient>(
+        std::make_unique<InMemoryTransport>(channel), config.pattern,
+        config.seed + static_cast<uint32_t>(i)));
+  }
+
+  return match->initialize("embedded", 0);
+}
+
+bool BotSwarm::connectBots() {
+  if (!config.inProcess) {
+    bots.reserve(config.botCount);
+    for (size_t i = 0; i < config.botCount; ++i) {
+      bots.push_back(std::make_unique<BotClient>(
+          std::make_unique<ENetTransport>(), config.pattern,
+          config.seed + static_cast<uint32_t>(i)));
+    }
+  }
+
+  botsConnected = 0;
+  for (size_t i = 0; i < bots.size(); ++i) {
+    uint16_t port =
+        static_cast<uint16_t>(config.port + (i % config.portCount));
+    if (bots[i]->connect(config.host, port)) {
+      botsConnected++;
+    } else {
+      Logger::error("BotSwarm: Bot " + std::to_string(i) +
+                    " failed to connect to " + config.host + ":" +
+                    std::to_string(port));
+    }
+  }
+
+  Logger::info("BotSwarm: " + std::to_string(botsConnected) + "/" +
+               std::to_string(bots.size()) + " bots connected (" +
+               botPatternName(config.pattern) + " pattern)");
+  return botsConnected > 0;
+}
+
+BotSwarmReport BotSwarm::run() {
+  BotSwarmReport report;
+  report.frames = config.frames;
+  report.botsConnected = botsConnected;
+
+  std::vector<float> serverTickMs;
+  std::vector<float> allocationsPerTick;
+  std::vector<float> bytesSerializedPerTick;
+  std::vector<float> downstreamBytesPerFrame;
+  serverTickMs.reserve(config.frames);
+  allocationsPerTick.reserve(config.frames);
+  bytesSerializedPerTick.reserve(config.frames);
+  downstreamBytesPerFrame.reserve(config.frames);
+  TickPhaseTimes phaseTotals;
+  double tickMsTotal = 0.0;
+  double networkMsTotal = 0.0;
+
+  const bool paced = config.realtime || !config.inProcess;
+  const auto frameDuration =
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<float, std::milli>(
+              Config::Timing::TARGET_DELTA_MS));
+
+  uint64_t lastBytesDown = 0;
+  auto runStart = std::chrono::steady_clock::now();
+  auto nextFrame = runStart;
+
+  for (uint64_t frame = 0; frame < config.frames; ++frame) {
+    for (auto& bot : bots) {
+      bot->sendInput(frame);
+    }
+
+    if (match) {
+      uint64_t allocationsBefore = allocationCount();
+      uint64_t bytesBefore = match->getServer()->getBytesSent();
+      auto tickStart = std::chrono::steady_clock::now();
+      match->tick();
+      float tickMs = std::chrono::duration<float, std::milli>(
+                         std::chrono::steady_clock::now() - tickStart)
+                         .count();
+      allocationsPerTick.push_back(
+          static_cast<float>(allocationCount() - allocationsBefore));
+      bytesSerializedPerTick.push_back(static_cast<float>(
+          match->getServer()->getBytesSent() - bytesBefore));
+
+      serverTickMs.push_back(tickMs);
+      if (tickMs > Config::Timing::TARGET_DELTA_MS) {
+        report.ticksOverBudget++;
+      }
+      const TickPhaseTimes& phases = match->getGameState()->getLastTickPhases();
+      addPhases(phaseTotals, phases);
+      tickMsTotal += tickMs;
+      networkMsTotal += std::max(0.0f, tickMs - phases.totalMs());
+    }
+
+    uint64_t bytesDown = 0;
+    for (auto& bot : bots) {
+      bot->receive();
+      bytesDown += bot->getBytesReceived();
+    }
+    downstreamBytesPerFrame.push_back(
+        static_cast<float>(bytesDown - lastBytesDown));
+    lastBytesDown = bytesDown;
+
+    if (paced) {
+      nextFrame += frameDuration;
+      std::this_thread::sleep_until(nextFrame);
+    }
+  }
+
+  report.wallSeconds = std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - runStart)
+                           .count();
+  if (serverTransport) {
+    report.messagesDropped = serverTransport->getDroppedCount();
+  }
+
+  // Per-bot averages over simulated time, so unthrottled runs still report
+  // what the traffic would be at 60 Hz
+  double simulatedSeconds =
+      static_cast<double>(config.frames) / Config::Timing::TARGET_FPS;
+  std::vector<float> downstreamKbps;
+  std::vector<float> upstreamKbps;
+  std::vector<float> tickIntervals;
+  for (const auto& bot : bots) {
+    if (bot->hasJoined()) {
+      report.botsJoined++;
+    }
+    report.totalBytesDown += bot->getBytesReceived();
+    report.totalBytesUp += bot->getBytesSent();
+    if (simulatedSeconds > 0.0) {
+      downstreamKbps.push_back(static_cast<float>(
+          bot->getBytesReceived() * 8.0 / 1000.0 / simulatedSeconds));
+      upstreamKbps.push_back(static_cast<float>(
+          bot->getBytesSent() * 8.0 / 1000.0 / simulatedSeconds));
+    }
+    // Tick intervals only mean something when frames are paced
+    if (paced) {
+      const auto& intervals = bot->getTickIntervalsMs();
+      tickIntervals.insert(tickIntervals.end(), intervals.begin(),
+                           intervals.end());
+    }
+  }
+
+  if (!serverTickMs.empty()) {
+    float ticks = static_cast<float>(serverTickMs.size());
+    report.serverTicksPerSecond =
+        tickMsTotal > 0.0 ? 1000.0 * ticks / tickMsTotal : 0.0;
+    report.meanPhaseMs.enemiesMs = phaseTotals.enemiesMs / ticks;
+    report.meanPhaseMs.effectsMs = phaseTotals.effectsMs / ticks;
+    report.meanPhaseMs.objectivesMs = phaseTotals.objectivesMs / ticks;
+    report.meanPhaseMs.eventsMs = phaseTotals.eventsMs / ticks;
+    report.meanPhaseMs.broadcastMs = phaseTotals.broadcastMs / ticks;
+    report.meanNetworkMs = static_cast<float>(networkMsTotal / ticks);
+  }
+  report.serverTickMs = summarizePercentiles(serverTickMs);
+  report.allocationsPerTick = summarizePercentiles(allocationsPerTick);
+  report.bytesSerializedPerTick = summarizePercentiles(bytesSerializedPerTick);
+  report.observedTickIntervalMs = summarizePercentiles(tickIntervals);
+  report.downstreamKbpsPerBot = summarizePercentiles(downstreamKbps);
+  report.upstreamKbpsPerBot = summarizePercentiles(upstreamKbps);
+  report.downstreamBytesPerFrame =
+      summarizePercentiles(downstreamBytesPerFrame);
+  return report;
+}
@@ -1,5 +1,6 @@
 #include "ClientPrediction.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "CharacterRegistry.h"
@@ -13,14 +14,16 @@
 
 ClientPrediction::ClientPrediction(NetworkClient* client,
                                    uint32_t localPlayerId,
-                                   const WorldConfig& world)
+                                   const WorldConfig& world, EventBus& bus)
     : client(client),
       localPlayerId(localPlayerId),
       worldWidth(world.width),
       worldHeight(world.height),
       collisionSystem(world.collisionSystem),
-      localInputSequence(0),
-      sentCharacterSelection(false) {
+      localInputSequence(1),
+      historyStart(1),
+      sentCharacterSelection(false),
+      bus(bus) {
   // Initialize local player
   localPlayer.id = localPlayerId;
   localPlayer.x =
@@ -33,18 +36,33 @@ ClientPrediction::ClientPrediction(NetworkClient* client,
   localPlayer.g = 255;
   localPlayer.b = 255;
 
+  // Until the server acks an input, it should agree with the spawn point
+  history[0].x = localPlayer.x;
+  history[0].y = localPlayer.y;
+
   // Subscribe to local input events
-  EventBus::instance().subscribe<LocalInputEvent>(
-      [this](const LocalInputEvent& e) { onLocalInput(e); });
+  subscriptions.push_back(bus.subscribeScoped<LocalInputEvent>(
+      [this](const LocalInputEvent& e) { onLocalInput(e); }));
 
   // Subscribe to network packet events
-  EventBus::instance().subscribe<NetworkPacketReceivedEvent>(
+  subscriptions.push_back(bus.subscribeScoped<NetworkPacketReceivedEvent>(
       [this](const NetworkPacketReceivedEvent& e) {
         onNetworkPacketReceived(e);
-      });
+      }));
+}
+
+float ClientPrediction::getCorrectionDistance() const {
+  return std::sqrt(correctionX * correctionX + correctionY * correctionY);
 }
 
 void ClientPrediction::onLocalInput(const LocalInputEvent& e) {
+  // One input per tick, so the correction fades at tick rate
+  correctionX *= Config::Network::CORRECTION_DECAY;
+  correctionY *= Config::Network::CORRECTION_DECAY;
+  if (getCorrectionDistance() < 0.01f) {
+    correctionX = correctionY = 0.0f;
+  }
+
   // Skip input processing if player is dead
   if (localPlayer.isDead()) {
     return;
@@ -55,19 +73,23 @@ void ClientPrediction::onLocalInput(const LocalInputEvent& e) {
                       worldWidth, worldHeight, collisionSystem);
   applyInput(localPlayer, input);
 
-  // Store input in history for reconciliation
-  LocalInputEvent inputCopy = e;
-  inputCopy.inputSequence = localInputSequence++;
-  inputHistory.push_back(inputCopy);
-
-  // Keep only last 60 inputs (1 second at 60 FPS)
-  if (inputHistory.size() > 60) {
-    inputHistory.pop_front();
+  // Record the prediction for reconciliation
+  uint32_t sequence = localInputSequence++;
+  PredictedInput& predicted = history[sequence % HISTORY_SIZE];
+  predicted.inputSequence = sequence;
+  predicted.moveLeft = e.moveLeft;
+  predicted.moveRight = e.moveRight;
+  predicted.moveUp = e.moveUp;
+  predicted.moveDown = e.moveDown;
+  predicted.x = localPlayer.x;
+  predicted.y = localPlayer.y;
+  if (localInputSequence - historyStart > HISTORY_SIZE) {
+    historyStart = localInputSequence - HISTORY_SIZE;
   }
 
   // Serialize and send to server
   ClientInputPacket packet;
-  packet.inputSequence = inputCopy.inputSequence;
+  packet.inputSequence = sequence;
   packet.moveLeft = e.moveLeft;
   packet.moveRight = e.moveRight;
   packet.moveUp = e.moveUp;
@@ -142,8 +164,9 @@ void ClientPrediction::onNetworkPacketReceived(
     if (packet.playerId == localPlayerId) {
       Logger::info("Local player respawned at (" + std::to_string(packet.x) +
                    ", " + std::to_string(packet.y) + ")");
-      // Clear input history since we teleported
-      inputHistory.clear();
+      // Inputs from before the teleport must not be replayed after it
+      historyStart = localInputSequence;
+      correctionX = correctionY = 0.0f;
       // Position and health will be reconciled via StateUpdate packets
     }
   } else if (type == PacketType::InventoryUpdate) {
@@ -186,7 +209,7 @@ void ClientPrediction::onNetworkPacketReceived(
         ItemPickedUpEvent event;
         event.itemId = itemId;
         event.quantity = 1;
-        EventBus::instance().publish(event);
+        bus.publish(event);
       }
     }
 
@@ -212,23 +235,6 @@ void ClientPrediction::reconcile(const StateUpdatePacket& stateUpdate) {
   // Update server tick
   localPlayer.lastServerTick = stateUpdate.serverTick;
 
-  // Calculate prediction error
-  float dx = localPlayer.x - serverState->x;
-  float dy = localPlayer.y - serverState->y;
-  float error = std::sqrt(dx * dx + dy * dy);
-
-  // Tiger Style: Warn if prediction error is large
-  if (error > 50.0f) {
-    Logger::info("Large prediction error: " + std::to_string(error) +
-                 " pixels");
-  }
-
-  // Rewind to server state
-  localPlayer.x = serverState->x;
-  localPlayer.y = serverState->y;
-  localPlayer.vx = serverState->vx;
-  localPlayer.vy = serverState->vy;
-
   // Check for health decrease (player took damage)
   float oldHealth = localPlayer.health;
   localPlayer.health = serverState->health;
@@ -240,40 +246,82 @@ void ClientPrediction::reconcile(const StateUpdatePacket& stateUpdate) {
     damageEvent.x = localPlayer.x;
     damageEvent.y = localPlayer.y;
     damageEvent.damageAmount = damageTaken;
-    EventBus::instance().publish(damageEvent);
+    bus.publish(damageEvent);
   }
   localPlayer.r = serverState->r;
   localPlayer.g = serverState->g;
   localPlayer.b = serverState->b;
 
-  // Find inputs that happened AFTER the server state
-  // (These are inputs the server hasn't processed yet)
-  std::deque<LocalInputEvent> inputsToReplay;
-  for (const auto& input : inputHistory) {
-    // Only replay inputs the server hasn't processed yet
-    if (input.inputSequence > serverState->lastInputSequence) {
-      inputsToReplay.push_back(input);
+  // Compare the server's position with what we predicted for the last
+  // input it processed. If they agree, every later prediction still holds
+  // and there is nothing to replay.
+  uint32_t acked = serverState->lastInputSequence;
+  const PredictedInput& predicted = history[acked % HISTORY_SIZE];
+  bool known = acked < localInputSequence &&
+               localInputSequence - acked <= HISTORY_SIZE &&
+               predicted.inputSequence == acked;
+  if (known) {
+    float dx = predicted.x - serverState->x;
+    float dy = predicted.y - serverState->y;
+    if (dx * dx + dy * dy <= Config::Network::PREDICTION_TOLERANCE_PX *
+                                 Config::Network::PREDICTION_TOLERANCE_PX) {
+      return;
     }
   }
 
-  // Re-apply all inputs that happened after the server state
-  for (const auto& inputEvent : inputsToReplay) {
-    MovementInput input(inputEvent.moveLeft, inputEvent.moveRight,
-                        inputEvent.moveUp, inputEvent.moveDown, 16.67f,
+  replayFrom(*serverState, acked);
+}
+
+void ClientPrediction::replayFrom(const PlayerState& serverState,
+                                  uint32_t ackedSequence) {
+  float shownX = getRenderX();
+  float shownY = getRenderY();
+
+  // Rewind to server state
+  localPlayer.x = serverState.x;
+  localPlayer.y = serverState.y;
+  localPlayer.vx = serverState.vx;
+  localPlayer.vy = serverState.vy;
+
+  // Later packets acking the same input compare against the server's
+  // answer, not the prediction it just overruled
+  if (ackedSequence < localInputSequence &&
+      localInputSequence - ackedSequence <= HISTORY_SIZE) {
+    PredictedInput& acked = history[ackedSequence % HISTORY_SIZE];
+    acked.inputSequence = ackedSequence;
+    acked.x = serverState.x;
+    acked.y = serverState.y;
+  }
+
+  // Re-apply the inputs the server hasn't processed yet, refreshing their
+  // predictions as we go
+  uint32_t first = std::max(ackedSequence + 1, historyStart);
+  for (uint32_t sequence = first; sequence < localInputSequence; ++sequence) {
+    PredictedInput& predicted = history[sequence % HISTORY_SIZE];
+    MovementInput input(predicted.moveLeft, predicted.moveRight,
+                        predicted.moveUp, predicted.moveDown, 16.67f,
                         worldWidth, worldHeight, collisionSystem);
     applyInput(localPlayer, input);
+    predicted.x = localPlayer.x;
+    predicted.y = localPlayer.y;
   }
-
-  // Remove old inputs from history (server has processed these)
-  while (!inputHistory.empty() &&
-         inputHistory.front().inputSequence <= serverState->lastInputSequence) {
-    inputHistory.pop_front();
+  replayCount++;
+
+  // Keep drawing where we were and ease into the corrected position,
+  // unless the jump is too far to be a misprediction (a teleport)
+  correctionX = shownX - localPlayer.x;
+  correctionY = shownY - localPlayer.y;
+  float error = getCorrectionDistance();
+  if (error > Config::Network::CORRECTION_SNAP_PX) {
+    Logger::info("Large prediction error: " + std::to_string(error) +
+                 " pixels");
+    correctionX = correctionY = 0.0f;
   }
 }
 
 void ClientPrediction::setupObjectiveEventHandlers() {
   // Subscribe to InteractInputEvent for objective interaction (E key)
-  EventBus::instance().subscribe<InteractInputEvent>(
+  subscriptions.push_back(bus.subscribeScoped<InteractInputEvent>(
       [this](const InteractInputEvent&) {
         GameState currentState = GameStateManager::instance().getCurrentState();
         if (currentState != GameState::Playing) {
@@ -290,10 +338,10 @@ void ClientPrediction::setupObjectiveEventHandlers() {
         packet.objectiveId = 0;
         client->send(serialize(packet));
         Logger::debug("Sent objective interact request");
-      });
+      }));
 
   // Subscribe to NetworkPacketReceivedEvent for ObjectiveState packets
-  EventBus::instance().subscribe<NetworkPacketReceivedEvent>(
+  subscriptions.push_back(bus.subscribeScoped<NetworkPacketReceivedEvent>(
       [this](const NetworkPacketReceivedEvent& e) {
         if (e.size == 0) return;
 
@@ -357,13 +405,13 @@ void ClientPrediction::setupObjectiveEventHandlers() {
                         std::to_string(static_cast<int>(packet.x)) + ", " +
                         std::to_string(static_cast<int>(packet.y)) + ")");
 
-          EventBus::instance().publish(event);
+          bus.publish(event);
 
           Logger::debug("Received objective state: " + event.name +
                         " state=" + std::to_string(packet.objectiveState) +
                         " progress=" + std::to_string(packet.progress));
         }
-      });
+      }));
 }
 
 void ClientPrediction::updateObjective(const ObjectiveStatePacket& packet) {
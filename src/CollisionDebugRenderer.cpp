@@ -101,6 +101,7 @@ void CollisionDebugRenderer::render() {
 
 void CollisionDebugRenderer::renderMapBounds(float worldWidth,
                                              float worldHeight) {
+  OpenGLUtils::markCallSite("CollisionDebugRenderer::renderMapBounds");
   if (!enabled) {
     return;
   }
@@ -148,8 +149,6 @@ void CollisionDebugRenderer::renderMapBounds(float worldWidth,
   glBindVertexArray(VAO);
   glDrawArrays(GL_LINES, 0, 8);  // 8 vertices = 4 lines
   glBindVertexArray(0);
-
-  OpenGLUtils::checkGLError("CollisionDebugRenderer::renderMapBounds");
 }
 
 void CollisionDebugRenderer::renderShape(const CollisionShape& shape) {
@@ -163,6 +162,7 @@ void CollisionDebugRenderer::renderShape(const CollisionShape& shape) {
 
 void CollisionDebugRenderer::renderAABB(const AABB& aabb, uint8_t r, uint8_t g,
                                         uint8_t b) {
+  OpenGLUtils::markCallSite("CollisionDebugRenderer::renderAABB");
   // Convert world corners to screen coordinates
   int screenX1, screenY1, screenX2, screenY2, screenX3, screenY3, screenX4,
       screenY4;
@@ -205,6 +205,4 @@ void CollisionDebugRenderer::renderAABB(const AABB& aabb, uint8_t r, uint8_t g,
   glBindVertexArray(VAO);
   glDrawArrays(GL_LINES, 0, 8);  // 8 vertices = 4 lines
   glBindVertexArray(0);
-
-  OpenGLUtils::checkGLError("CollisionDebugRenderer::renderAABB");
 }
@@ -8,13 +8,14 @@
 
 CombatSystem::CombatSystem(NetworkClient* netClient,
                            ClientPrediction* prediction,
-                           EnemyInterpolation* enemyInterp)
+                           EnemyInterpolation* enemyInterp, EventBus& bus)
     : networkClient(netClient),
       clientPrediction(prediction),
-      enemyInterpolation(enemyInterp) {
+      enemyInterpolation(enemyInterp),
+      bus(bus) {
   // Subscribe to attack input
-  EventBus::instance().subscribe<AttackInputEvent>(
-      [this](const AttackInputEvent& e) { onAttackInput(e); });
+  subscriptions.push_back(bus.subscribeScoped<AttackInputEvent>(
+      [this](const AttackInputEvent& e) { onAttackInput(e); }));
 
   Logger::info("CombatSystem initialized");
 }
@@ -41,6 +42,7 @@ void CombatSystem::onAttackInput(const AttackInputEvent& e) {
   packet.damage = ATTACK_DAMAGE;
 
   networkClient->send(serialize(packet));
+  bus.publish(LocalAttackEvent{enemyId});
 
   Logger::info("Attacked enemy ID=" + std::to_string(enemyId));
 }
@@ -48,13 +50,14 @@ void CombatSystem::onAttackInput(const AttackInputEvent& e) {
 uint32_t CombatSystem::findNearestEnemy(float playerX, float playerY,
                                         float maxRange) const {
   auto enemyIds = enemyInterpolation->getEnemyIds();
+  double renderTick = enemyInterpolation->getRenderTick();
 
   uint32_t nearestId = 0;
   float nearestDist = maxRange;
 
   for (uint32_t id : enemyIds) {
     Enemy enemy;
-    if (enemyInterpolation->getInterpolatedState(id, 0.0f, enemy)) {
+    if (enemyInterpolation->getInterpolatedState(id, renderTick, enemy)) {
       // Skip dead enemies
       if (enemy.state == ::EnemyState::Dead) {
         continue;
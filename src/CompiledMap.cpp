@@ -0,0 +1,585 @@
+#include "CompiledMap.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "Logger.h"
+#include "MappedFile.h"
+#include "TiledMap.h"
+
+namespace {
+
+constexpr char MAGIC[4] = {'G', 'M', 'A', 'P'};
+constexpr uint32_t NO_TILES = UINT32_MAX;  // Tile layer with nothing to draw
+
+struct StringRef {
+  uint32_t offset;
+  uint32_t length;
+};
+
+struct FileHeader {
+  char magic[4];
+  uint32_t version;
+  int32_t mapWidth;
+  int32_t mapHeight;
+  int32_t tileWidth;
+  int32_t tileHeight;
+  StringRef tilesetImage;  // Relative to the .gmap's directory
+  int32_t tilesetColumns;
+  int32_t tilesetSpacing;
+  float shipX;
+  float shipY;
+  uint32_t hasShip;
+  uint32_t sectionCount;
+};
+
+struct SectionEntry {
+  uint32_t id;
+  uint32_t offset;
+  uint32_t size;
+  uint32_t count;
+};
+
+enum class SectionId : uint32_t {
+  Strings = 1,         // count bytes
+  TileLayers = 2,      // u32 first tile (into Tiles) or NO_TILES per layer
+  Tiles = 3,           // u32 gid per tile
+  CollisionBoxes = 4,  // float x[count], y[count], w[count], h[count]
+  CollisionNames = 5,  // CollisionNameRecord per box
+  EnemySpawns = 6,
+  PlayerSpawns = 7,
+  MusicZones = 8,
+  Objectives = 9,
+};
+constexpr uint32_t SECTION_ID_COUNT = 10;
+
+struct CollisionNameRecord {
+  StringRef name;
+  StringRef objectType;
+};
+
+struct EnemySpawnRecord {
+  uint32_t type;
+  float x;
+  float y;
+  StringRef name;
+};
+
+struct PlayerSpawnRecord {
+  float x;
+  float y;
+  StringRef name;
+};
+
+struct MusicZoneRecord {
+  StringRef name;
+  StringRef trackName;
+  float x;
+  float y;
+  float width;
+  float height;
+};
+
+// The fields TiledMap fills in; the rest are match state
+struct ObjectiveRecord {
+  uint32_t id;
+  uint32_t type;
+  StringRef name;
+  StringRef description;
+  float x;
+  float y;
+  float radius;
+  float interactionTime;
+  int32_t enemiesRequired;
+  int32_t frogsRequired;
+  float depositX;
+  float depositY;
+  uint32_t hasDepositPoint;
+};
+
+template <typename T>
+constexpr bool isFlatRecord() {
+  return std::is_trivially_copyable_v<T> && sizeof(T) % 4 == 0 &&
+         alignof(T) <= 4;
+}
+static_assert(isFlatRecord<FileHeader>() && isFlatRecord<SectionEntry>() &&
+                  isFlatRecord<CollisionNameRecord>() &&
+                  isFlatRecord<EnemySpawnRecord>() &&
+                  isFlatRecord<PlayerSpawnRecord>() &&
+                  isFlatRecord<MusicZoneRecord>() &&
+                  isFlatRecord<ObjectiveRecord>(),
+              "Map file records must be flat and 4-byte aligned");
+
+template <typename T>
+void appendRaw(std::vector<uint8_t>& out, const T* items, size_t count) {
+  const auto* bytes = reinterpret_cast<const uint8_t*>(items);
+  out.insert(out.end(), bytes, bytes + sizeof(T) * count);
+}
+
+class FileBuilder {
+ public:
+  StringRef addString(const std::string& value) {
+    auto it = stringRefs.find(value);
+    if (it != stringRefs.end()) return it->second;
+    StringRef ref{static_cast<uint32_t>(strings.size()),
+                  static_cast<uint32_t>(value.size())};
+    strings.insert(strings.end(), value.begin(), value.end());
+    stringRefs.emplace(value, ref);
+    return ref;
+  }
+
+  template <typename T>
+  void addSection(SectionId id, const std::vector<T>& records) {
+    std::vector<uint8_t> bytes;
+    appendRaw(bytes, records.data(), records.size());
+    addSection(id, static_cast<uint32_t>(records.size()), std::move(bytes));
+  }
+
+  void addSection(SectionId id, uint32_t count, std::vector<uint8_t> bytes) {
+    sections.push_back(Section{id, count, std::move(bytes)});
+  }
+
+  std::vector<uint8_t> finish(FileHeader header) {
+    addSection(SectionId::Strings, static_cast<uint32_t>(strings.size()),
+               strings);
+
+    header.sectionCount = static_cast<uint32_t>(sections.size());
+    std::vector<SectionEntry> entries;
+    size_t offset = sizeof(FileHeader) + sizeof(SectionEntry) * sections.size();
+    for (const Section& section : sections) {
+      SectionEntry entry;
+      entry.id = static_cast<uint32_t>(section.id);
+      entry.offset = static_cast<uint32_t>(offset);
+      entry.size = static_cast<uint32_t>(section.bytes.size());
+      entry.count = section.count;
+      entries.push_back(entry);
+      offset += (section.bytes.size() + 3) & ~size_t{3};
+    }
+
+    std::vector<uint8_t> out;
+    out.reserve(offset);
+    appendRaw(out, &header, 1);
+    appendRaw(out, entries.data(), entries.size());
+    for (const Section& section : sections) {
+      out.insert(out.end(), section.bytes.begin(), section.bytes.end());
+      out.resize((out.size() + 3) & ~size_t{3}, 0);
+    }
+    return out;
+  }
+
+ private:
+  struct Section {
+    SectionId id;
+    uint32_t count;
+    std::vector<uint8_t> bytes;
+  };
+
+  std::vector<Section> sections;
+  std::vector<uint8_t> strings;
+  std::unordered_map<std::string, StringRef> stringRefs;
+};
+
+struct SectionView {
+  const uint8_t* data = nullptr;
+  uint32_t size = 0;
+  uint32_t count = 0;
+};
+
+// Typed records of a section; false if its size does not match its count
+template <typename T>
+bool getRecords(const SectionView& section, const T*& records) {
+  if (static_cast<uint64_t>(section.count) * sizeof(T) != section.size) {
+    return false;
+  }
+  records = reinterpret_cast<const T*>(section.data);
+  return true;
+}
+
+class StringTable {
+ public:
+  explicit StringTable(const SectionView& section) : section(section) {}
+
+  bool get(StringRef ref, std::string& out) const {
+    if (static_cast<uint64_t>(ref.offset) + ref.length > section.size) {
+      return false;
+    }
+    out.assign(reinterpret_cast<const char*>(section.data) + ref.offset,
+               ref.length);
+    return true;
+  }
+
+ private:
+  SectionView section;
+};
+
+}  // namespace
+
+std::string CompiledMap::pathFor(const std::string& sourcePath) {
+  std::filesystem::path path(sourcePath);
+  return path.replace_extension(EXTENSION).string();
+}
+
+bool CompiledMap::isCompiledPath(const std::string& path) {
+  return std::filesystem::path(path).extension() == EXTENSION;
+}
+
+bool CompiledMap::isUpToDate(const std::string& compiledPath,
+                             const std::string& sourcePath) {
+  std::error_code error;
+  auto compiledTime = std::filesystem::last_write_time(compiledPath, error);
+  if (error) return false;
+  auto sourceTime = std::filesystem::last_write_time(sourcePath, error);
+  if (error) return true;  // Shipped without its source
+  if (compiledTime < sourceTime) {
+    Logger::info(compiledPath + " is older than " + sourcePath +
+                 ", parsing TMX (rerun MapCompiler)");
+    return false;
+  }
+  return true;
+}
+
+bool CompiledMap::write(const TiledMap& map, const std::string& path) {
+  FileBuilder builder;
+
+  FileHeader header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.mapWidth = map.getWidth();
+  header.mapHeight = map.getHeight();
+  header.tileWidth = map.getTileWidth();
+  header.tileHeight = map.getTileHeight();
+  header.tilesetColumns = map.getTilesetColumns();
+  header.tilesetSpacing = map.getTilesetSpacing();
+  header.shipX = map.getShipX();
+  header.shipY = map.getShipY();
+  header.hasShip = map.hasShipPosition() ? 1 : 0;
+
+  // Keep the tileset reference valid wherever the map directory is moved
+  std::string tileset = map.getTilesetImagePath();
+  if (!tileset.empty()) {
+    std::filesystem::path directory =
+        std::filesystem::absolute(std::filesystem::path(path).parent_path());
+    tileset = std::filesystem::absolute(tileset)
+                  .lexically_relative(directory)
+                  .generic_string();
+  }
+  header.tilesetImage = builder.addString(tileset);
+
+  size_t layerTiles = static_cast<size_t>(map.getWidth()) * map.getHeight();
+  std::vector<uint32_t> layerStarts;
+  std::vector<uint32_t> tiles;
+  for (const uint32_t* layer : map.getTileLayers()) {
+    if (!layer) {
+      layerStarts.push_back(NO_TILES);
+      continue;
+    }
+    layerStarts.push_back(static_cast<uint32_t>(tiles.size()));
+    tiles.insert(tiles.end(), layer, layer + layerTiles);
+  }
+  builder.addSection(SectionId::TileLayers, layerStarts);
+  builder.addSection(SectionId::Tiles, tiles);
+
+  const auto& shapes = map.getCollisionShapes();
+  std::vector<float> xs, ys, widths, heights;
+  std::vector<CollisionNameRecord> shapeNames;
+  for (const CollisionShape& shape : shapes) {
+    xs.push_back(shape.aabb.x);
+    ys.push_back(shape.aabb.y);
+    widths.push_back(shape.aabb.width);
+    heights.push_back(shape.aabb.height);
+    shapeNames.push_back(CollisionNameRecord{
+        builder.addString(shape.name), builder.addString(shape.objectType)});
+  }
+  std::vector<uint8_t> boxes;
+  appendRaw(boxes, xs.data(), xs.size());
+  appendRaw(boxes, ys.data(), ys.size());
+  appendRaw(boxes, widths.data(), widths.size());
+  appendRaw(boxes, heights.data(), heights.size());
+  builder.addSection(SectionId::CollisionBoxes,
+                     static_cast<uint32_t>(shapes.size()), std::move(boxes));
+  builder.addSection(SectionId::CollisionNames, shapeNames);
+
+  std::vector<EnemySpawnRecord> enemySpawns;
+  for (const EnemySpawn& spawn : map.getEnemySpawns()) {
+    enemySpawns.push_back(EnemySpawnRecord{static_cast<uint32_t>(spawn.type),
+                                           spawn.x, spawn.y,
+                                           builder.addString(spawn.name)});
+  }
+  builder.addSection(SectionId::EnemySpawns, enemySpawns);
+
+  std::vector<PlayerSpawnRecord> playerSpawns;
+  for (const PlayerSpawn& spawn : map.getPlayerSpawns()) {
+    playerSpawns.push_back(
+        PlayerSpawnRecord{spawn.x, spawn.y, builder.addString(spawn.name)});
+  }
+  builder.addSection(SectionId::PlayerSpawns, playerSpawns);
+
+  std::vector<MusicZoneRecord> musicZones;
+  for (const MusicZone& zone : map.getMusicZones()) {
+    musicZones.push_back(MusicZoneRecord{
+        builder.addString(zone.name), builder.addString(zone.trackName),
+        zone.x, zone.y, zone.width, zone.height});
+  }
+  builder.addSection(SectionId::MusicZones, musicZones);
+
+  std::vector<ObjectiveRecord> objectives;
+  for (const Objective& objective : map.getObjectives()) {
+    ObjectiveRecord record{};
+    record.id = objective.id;
+    record.type = static_cast<uint32_t>(objective.type);
+    record.name = builder.addString(objective.name);
+    record.description = builder.addString(objective.description);
+    record.x = objective.x;
+    record.y = objective.y;
+    record.radius = objective.radius;
+    record.interactionTime = objective.interactionTime;
+    record.enemiesRequired = objective.enemiesRequired;
+    record.frogsRequired = objective.frogsRequired;
+    record.depositX = objective.depositX;
+    record.depositY = objective.depositY;
+    record.hasDepositPoint = objective.hasDepositPoint ? 1 : 0;
+    objectives.push_back(record);
+  }
+  builder.addSection(SectionId::Objectives, objectives);
+
+  std::vector<uint8_t> bytes = builder.finish(header);
+
+  // Write beside the target and rename, so a server starting meanwhile
+  // never maps a half-written file
+  std::string tempPath = path + ".tmp";
+  {
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(bytes.data()),
+               static_cast<std::streamsize>(bytes.size()));
+    if (!file) {
+      Logger::error("Failed to write compiled map: " + tempPath);
+      return false;
+    }
+  }
+  std::error_code error;
+  std::filesystem::rename(tempPath, path, error);
+  if (error) {
+    Logger::error("Failed to write compiled map: " + path + ": " +
+                  error.message());
+    return false;
+  }
+  return true;
+}
+
+bool CompiledMap::read(const std::string& path, TiledMap& map) {
+  auto file = std::make_shared<MappedFile>();
+  if (!file->open(path)) {
+    Logger::error("Failed to open compiled map: " + path);
+    return false;
+  }
+  auto fail = [&path](const std::string& reason) {
+    Logger::error("Invalid compiled map " + path + ": " + reason);
+    return false;
+  };
+
+  const uint8_t* data = file->getData();
+  const size_t size = file->getSize();
+  if (size < sizeof(FileHeader)) return fail("truncated header");
+  FileHeader header;
+  std::memcpy(&header, data, sizeof(header));
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+    return fail("not a map file");
+  }
+  if (header.version != VERSION) {
+    return fail("version " + std::to_string(header.version) + ", expected " +
+                std::to_string(VERSION));
+  }
+  if (header.mapWidth <= 0 || header.mapHeight <= 0) {
+    return fail("empty map");
+  }
+
+  const uint64_t tableEnd = sizeof(FileHeader) +
+                            uint64_t{header.sectionCount} *
+                                sizeof(SectionEntry);
+  if (tableEnd > size) return fail("truncated section table");
+
+  SectionView sections[SECTION_ID_COUNT];
+  const auto* entries =
+      reinterpret_cast<const SectionEntry*>(data + sizeof(FileHeader));
+  for (uint32_t i = 0; i < header.sectionCount; ++i) {
+    const SectionEntry& entry = entries[i];
+    if (entry.offset % 4 != 0 || entry.offset < tableEnd ||
+        uint64_t{entry.offset} + entry.size > size) {
+      return fail("section " + std::to_string(entry.id) + " out of bounds");
+    }
+    if (entry.id > 0 && entry.id < SECTION_ID_COUNT) {
+      sections[entry.id] = SectionView{data + entry.offset, entry.size,
+                                       entry.count};
+    }
+  }
+  auto section = [&sections](SectionId id) -> const SectionView& {
+    return sections[static_cast<uint32_t>(id)];
+  };
+
+  StringTable strings(section(SectionId::Strings));
+  if (section(SectionId::Strings).size != section(SectionId::Strings).count) {
+    return fail("bad string table");
+  }
+
+  // Tile layers stay in the mapping
+  const uint32_t* layerStarts = nullptr;
+  const uint32_t* tiles = nullptr;
+  if (!getRecords(section(SectionId::TileLayers), layerStarts) ||
+      !getRecords(section(SectionId::Tiles), tiles)) {
+    return fail("bad tile sections");
+  }
+  const uint64_t layerTiles =
+      static_cast<uint64_t>(header.mapWidth) * header.mapHeight;
+  std::vector<const uint32_t*> tileLayers;
+  for (uint32_t i = 0; i < section(SectionId::TileLayers).count; ++i) {
+    if (layerStarts[i] == NO_TILES) {
+      tileLayers.push_back(nullptr);
+    } else if (layerStarts[i] + layerTiles <=
+               section(SectionId::Tiles).count) {
+      tileLayers.push_back(tiles + layerStarts[i]);
+    } else {
+      return fail("tile layer " + std::to_string(i) + " out of bounds");
+    }
+  }
+
+  // Objects are few; copy them into the structs gameplay code uses
+  const SectionView& boxes = section(SectionId::CollisionBoxes);
+  const CollisionNameRecord* shapeNames = nullptr;
+  if (uint64_t{boxes.count} * 4 * sizeof(float) != boxes.size ||
+      !getRecords(section(SectionId::CollisionNames), shapeNames) ||
+      section(SectionId::CollisionNames).count != boxes.count) {
+    return fail("bad collision sections");
+  }
+  const auto* boxX = reinterpret_cast<const float*>(boxes.data);
+  const float* boxY = boxX + boxes.count;
+  const float* boxWidth = boxY + boxes.count;
+  const float* boxHeight = boxWidth + boxes.count;
+  std::vector<CollisionShape> collisionShapes(boxes.count);
+  for (uint32_t i = 0; i < boxes.count; ++i) {
+    CollisionShape& shape = collisionShapes[i];
+    shape.type = CollisionShape::Type::Rectangle;
+    shape.aabb = AABB{boxX[i], boxY[i], boxWidth[i], boxHeight[i]};
+    if (!strings.get(shapeNames[i].name, shape.name) ||
+        !strings.get(shapeNames[i].objectType, shape.objectType)) {
+      return fail("bad collision name");
+    }
+  }
+
+  const EnemySpawnRecord* enemyRecords = nullptr;
+  if (!getRecords(section(SectionId::EnemySpawns), enemyRecords)) {
+    return fail("bad enemy spawns");
+  }
+  std::vector<EnemySpawn> enemySpawns(section(SectionId::EnemySpawns).count);
+  for (size_t i = 0; i < enemySpawns.size(); ++i) {
+    const EnemySpawnRecord& record = enemyRecords[i];
+    if (record.type > static_cast<uint32_t>(EnemyType::Skeleton) ||
+        !strings.get(record.name, enemySpawns[i].name)) {
+      return fail("bad enemy spawn");
+    }
+    enemySpawns[i].type = static_cast<EnemyType>(record.type);
+    enemySpawns[i].x = record.x;
+    enemySpawns[i].y = record.y;
+  }
+
+  const PlayerSpawnRecord* playerRecords = nullptr;
+  if (!getRecords(section(SectionId::PlayerSpawns), playerRecords)) {
+    return fail("bad player spawns");
+  }
+  std::vector<PlayerSpawn> playerSpawns(
+      section(SectionId::PlayerSpawns).count);
+  for (size_t i = 0; i < playerSpawns.size(); ++i) {
+    if (!strings.get(playerRecords[i].name, playerSpawns[i].name)) {
+      return fail("bad player spawn");
+    }
+    playerSpawns[i].x = playerRecords[i].x;
+    playerSpawns[i].y = playerRecords[i].y;
+  }
+
+  const MusicZoneRecord* zoneRecords = nullptr;
+  if (!getRecords(section(SectionId::MusicZones), zoneRecords)) {
+    return fail("bad music zones");
+  }
+  std::vector<MusicZone> musicZones(section(SectionId::MusicZones).count);
+  for (size_t i = 0; i < musicZones.size(); ++i) {
+    const MusicZoneRecord& record = zoneRecords[i];
+    MusicZone& zone = musicZones[i];
+    if (!strings.get(record.name, zone.name) ||
+        !strings.get(record.trackName, zone.trackName)) {
+      return fail("bad music zone");
+    }
+    zone.x = record.x;
+    zone.y = record.y;
+    zone.width = record.width;
+    zone.height = record.height;
+  }
+
+  const ObjectiveRecord* objectiveRecords = nullptr;
+  if (!getRecords(section(SectionId::Objectives), objectiveRecords)) {
+    return fail("bad objectives");
+  }
+  std::vector<Objective> objectives(section(SectionId::Objectives).count);
+  for (size_t i = 0; i < objectives.size(); ++i) {
+    const ObjectiveRecord& record = objectiveRecords[i];
+    Objective& objective = objectives[i];
+    if (record.type > static_cast<uint32_t>(ObjectiveType::DerelictTurret) ||
+        !strings.get(record.name, objective.name) ||
+        !strings.get(record.description, objective.description)) {
+      return fail("bad objective");
+    }
+    objective.id = record.id;
+    objective.type = static_cast<ObjectiveType>(record.type);
+    objective.x = record.x;
+    objective.y = record.y;
+    objective.radius = record.radius;
+    objective.interactionTime = record.interactionTime;
+    objective.enemiesRequired = record.enemiesRequired;
+    objective.frogsRequired = record.frogsRequired;
+    objective.depositX = record.depositX;
+    objective.depositY = record.depositY;
+    objective.hasDepositPoint = record.hasDepositPoint != 0;
+  }
+
+  std::string tileset;
+  if (!strings.get(header.tilesetImage, tileset)) {
+    return fail("bad tileset path");
+  }
+  std::filesystem::path directory = std::filesystem::path(path).parent_path();
+  if (!tileset.empty() && !directory.empty()) {
+    tileset = (directory / tileset).lexically_normal().generic_string();
+  }
+
+  // Everything checked out; only now replace the map's contents
+  map.mapWidth = header.mapWidth;
+  map.mapHeight = header.mapHeight;
+  map.tileWidth = header.tileWidth;
+  map.tileHeight = header.tileHeight;
+  map.tilesetImagePath = std::move(tileset);
+  map.tilesetColumns = header.tilesetColumns;
+  map.tilesetSpacing = header.tilesetSpacing;
+  map.shipX = header.shipX;
+  map.shipY = header.shipY;
+  map.hasShip = header.hasShip != 0;
+  map.tileLayers = std::move(tileLayers);
+  map.tileData.clear();
+  map.mappedFile = std::move(file);
+  map.collisionShapes = std::move(collisionShapes);
+  map.enemySpawns = std::move(enemySpawns);
+  map.playerSpawns = std::move(playerSpawns);
+  map.musicZones = std::move(musicZones);
+  map.objectives = std::move(objectives);
+
+  Logger::info("Loaded compiled map: " + path + " (" +
+               std::to_string(map.mapWidth) + "x" +
+               std::to_string(map.mapHeight) + " tiles, " +
+               std::to_string(map.collisionShapes.size()) +
+               " collision shapes, " + std::to_string(map.enemySpawns.size()) +
+               " enemy spawns, " + std::to_string(map.playerSpawns.size()) +
+               " player spawns)");
+  return true;
+}
@@ -0,0 +1,37 @@
+#include "DamageNumberPool.h"
+
+void DamageNumberPool::spawn(float x, float y, float amount,
+                             DamageNumberType numberType) {
+  if (count == CAPACITY) {
+    // Drop the oldest to make room
+    head = (head + 1) & MASK;
+    count--;
+  }
+
+  size_t slot = (head + count) & MASK;
+  worldX[slot] = x;
+  worldY[slot] = y;
+  age[slot] = 0.0f;
+  alpha[slot] = 1.0f;
+  value[slot] = static_cast<int32_t>(amount);
+  type[slot] = numberType;
+  count++;
+}
+
+void DamageNumberPool::update(float deltaSeconds) {
+  const float rise = RISE_SPEED * deltaSeconds;
+  constexpr float fadeRate = 1.0f / (DISPLAY_DURATION - FADE_START);
+
+  for (size_t i = 0; i < count; ++i) {
+    size_t slot = (head + i) & MASK;
+    float a = age[slot] + deltaSeconds;
+    age[slot] = a;
+    worldY[slot] -= rise;
+    alpha[slot] = a > FADE_START ? 1.0f - (a - FADE_START) * fadeRate : 1.0f;
+  }
+
+  while (count > 0 && age[head] >= DISPLAY_DURATION) {
+    head = (head + 1) & MASK;
+    count--;
+  }
+}
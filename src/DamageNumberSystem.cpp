@@ -1,144 +1,120 @@
 #include "DamageNumberSystem.h"
 
-#include <imgui.h>
-
-#include <cmath>
-#include <string>
+#include <cstdint>
 
 #include "Camera.h"
 #include "Logger.h"
 #include "SpriteRenderer.h"
+#include "Texture.h"
 
 DamageNumberSystem::DamageNumberSystem(Camera* camera,
-                                       SpriteRenderer* spriteRenderer)
-    : camera(camera), spriteRenderer(spriteRenderer), currentTime(0.0f) {
-  EventBus::instance().subscribe<DamageDealtEvent>(
-      [this](const DamageDealtEvent& e) { onDamageDealt(e); });
-  EventBus::instance().subscribe<DamageReceivedEvent>(
-      [this](const DamageReceivedEvent& e) { onDamageReceived(e); });
-  EventBus::instance().subscribe<HealingEvent>(
-      [this](const HealingEvent& e) { onHealing(e); });
-  EventBus::instance().subscribe<UpdateEvent>(
-      [this](const UpdateEvent& e) { onUpdate(e); });
+                                       SpriteRenderer* spriteRenderer,
+                                       EventBus& bus)
+    : camera(camera), spriteRenderer(spriteRenderer) {
+  glyphTexture = std::make_unique<Texture>();
+  glyphTexture->createFromPixels(glyphAtlas.getPixels().data(),
+                                 glyphAtlas.getWidth(),
+                                 glyphAtlas.getHeight());
+
+  subscriptions.push_back(bus.subscribeScoped<DamageDealtEvent>(
+      [this](const DamageDealtEvent& e) { onDamageDealt(e); }));
+  subscriptions.push_back(bus.subscribeScoped<DamageReceivedEvent>(
+      [this](const DamageReceivedEvent& e) { onDamageReceived(e); }));
+  subscriptions.push_back(bus.subscribeScoped<HealingEvent>(
+      [this](const HealingEvent& e) { onHealing(e); }));
+  subscriptions.push_back(bus.subscribeScoped<UpdateEvent>(
+      [this](const UpdateEvent& e) { onUpdate(e); }));
 
   Logger::info("DamageNumberSystem initialized");
 }
 
+DamageNumberSystem::~DamageNumberSystem() = default;
+
 void DamageNumberSystem::onDamageDealt(const DamageDealtEvent& e) {
-  DamageNumber num;
-  num.worldX = e.x;
-  num.worldY = e.y;
-  num.damageAmount = e.damageAmount;
-  num.creationTime = currentTime;
-  num.type =
-      e.isCritical ? DamageNumber::Type::Critical : DamageNumber::Type::Damage;
-
-  activeNumbers.push_back(num);
+  pool.spawn(e.x, e.y, e.damageAmount,
+             e.isCritical ? DamageNumberType::Critical
+                          : DamageNumberType::Damage);
 }
 
 void DamageNumberSystem::onDamageReceived(const DamageReceivedEvent& e) {
-  DamageNumber num;
-  num.worldX = e.x;
-  num.worldY = e.y;
-  num.damageAmount = e.damageAmount;
-  num.creationTime = currentTime;
-  num.type = DamageNumber::Type::PlayerDamage;
-
-  activeNumbers.push_back(num);
+  pool.spawn(e.x, e.y, e.damageAmount, DamageNumberType::PlayerDamage);
 }
 
 void DamageNumberSystem::onHealing(const HealingEvent& e) {
-  DamageNumber num;
-  num.worldX = e.x;
-  num.worldY = e.y;
-  num.damageAmount = e.healAmount;
-  num.creationTime = currentTime;
-  num.type = DamageNumber::Type::Healing;
-
-  activeNumbers.push_back(num);
+  pool.spawn(e.x, e.y, e.healAmount, DamageNumberType::Healing);
 }
 
 void DamageNumberSystem::onUpdate(const UpdateEvent& e) {
-  currentTime += e.deltaTime / 1000.0f;  // Convert ms to seconds
-
-  // Remove old damage numbers
-  while (!activeNumbers.empty()) {
-    float age = currentTime - activeNumbers.front().creationTime;
-    if (age >= DISPLAY_DURATION) {
-      activeNumbers.pop_front();
-    } else {
-      break;  // Rest are newer
-    }
-  }
+  pool.update(e.deltaTime / 1000.0f);  // Convert ms to seconds
 }
 
 void DamageNumberSystem::render() {
-  for (const auto& num : activeNumbers) {
-    renderDamageNumber(num);
-  }
+  if (pool.empty() || !spriteRenderer) return;
+
+  // Every glyph shares the atlas texture: one instanced draw for all numbers
+  spriteRenderer->beginBatch();
+  pool.forEach([this](float worldX, float worldY, float alpha, int32_t value,
+                      DamageNumberType type) {
+    renderNumber(worldX, worldY, alpha, value, type);
+  });
+  spriteRenderer->endBatch();
 }
 
-void DamageNumberSystem::renderDamageNumber(const DamageNumber& num) {
-  float age = currentTime - num.creationTime;
-  if (age >= DISPLAY_DURATION) return;
-
-  // Calculate rise animation (move upward over time)
-  float yOffset = age * RISE_SPEED;
-
-  // Convert world position to screen position
-  int screenX, screenY;
-  camera->worldToScreen(num.worldX, num.worldY - yOffset, screenX, screenY);
-
-  // Calculate fade (fade out in the last part of animation)
-  float alpha = 1.0f;
-  if (age > FADE_START) {
-    alpha = 1.0f - ((age - FADE_START) / (DISPLAY_DURATION - FADE_START));
+void DamageNumberSystem::renderNumber(float worldX, float worldY, float alpha,
+                                      int32_t value, DamageNumberType type) {
+  // Format into a stack buffer, digits written back to front
+  char text[16];
+  int length = 0;
+  char* end = text + sizeof(text);
+  char* cursor = end;
+  if (type == DamageNumberType::Critical) {
+    *--cursor = '!';  // Add exclamation for crits
   }
+  // Unsigned negate: std::abs(INT32_MIN) would overflow
+  uint32_t magnitude = value < 0 ? 0u - static_cast<uint32_t>(value)
+                                 : static_cast<uint32_t>(value);
+  do {
+    *--cursor = static_cast<char>('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude > 0);
+  if (value < 0) {
+    *--cursor = '-';
+  }
+  length = static_cast<int>(end - cursor);
 
   // Color based on type
-  ImVec4 color;
-  switch (num.type) {
-    case DamageNumber::Type::Damage:
-      color = ImVec4(1.0f, 1.0f, 1.0f, alpha);  // White
+  float r = 1.0f, g = 1.0f, b = 1.0f;  // Damage: white
+  switch (type) {
+    case DamageNumberType::Damage:
       break;
-    case DamageNumber::Type::Critical:
-      color = ImVec4(1.0f, 1.0f, 0.0f, alpha);  // Yellow
+    case DamageNumberType::Critical:
+      b = 0.0f;  // Yellow
       break;
-    case DamageNumber::Type::PlayerDamage:
-      color = ImVec4(1.0f, 0.3f, 0.3f, alpha);  // Red
+    case DamageNumberType::PlayerDamage:
+      g = 0.3f;  // Red
+      b = 0.3f;
       break;
-    case DamageNumber::Type::Healing:
-      color = ImVec4(0.3f, 1.0f, 0.3f, alpha);  // Green
+    case DamageNumberType::Healing:
+      r = 0.3f;  // Green
+      b = 0.3f;
       break;
   }
 
-  // Render using ImGui (drawn in screen space, doesn't move with camera)
-  ImGui::SetNextWindowPos(ImVec2(screenX, screenY), ImGuiCond_Always,
-                          ImVec2(0.5f, 0.5f));  // Center on position
-  ImGui::SetNextWindowBgAlpha(0.0f);
-
-  ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
-  ImGui::PushStyleVar(ImGuiStyleVar_WindowBorderSize, 0.0f);
-
-  ImGui::Begin(
-      ("##DamageNum" + std::to_string((uint64_t)&num)).c_str(), nullptr,
-      ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoDecoration |
-          ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoFocusOnAppearing);
-
-  ImGui::PushStyleColor(ImGuiCol_Text, color);
-
-  // Format damage number
-  std::string text = std::to_string((int)num.damageAmount);
-  if (num.type == DamageNumber::Type::Critical) {
-    text += "!";  // Add exclamation for crits
+  // Convert world position to screen position, centered on the text
+  int screenX, screenY;
+  camera->worldToScreen(worldX, worldY, screenX, screenY);
+
+  const float glyphW = GlyphAtlas::GLYPH_WIDTH * GLYPH_SCALE;
+  const float glyphH = GlyphAtlas::GLYPH_HEIGHT * GLYPH_SCALE;
+  const float advance = glyphW + GLYPH_SCALE;  // One font pixel of spacing
+  float x = screenX - (length * advance - GLYPH_SCALE) / 2.0f;
+  float y = screenY - glyphH / 2.0f;
+
+  for (const char* c = cursor; c != end; ++c, x += advance) {
+    int srcX, srcY;
+    if (!glyphAtlas.getGlyph(*c, srcX, srcY)) continue;
+    spriteRenderer->drawRegion(*glyphTexture, x, y, glyphW, glyphH, srcX,
+                               srcY, GlyphAtlas::GLYPH_WIDTH,
+                               GlyphAtlas::GLYPH_HEIGHT, r, g, b, alpha);
   }
-
-  // Larger text for better visibility
-  ImGui::SetWindowFontScale(1.5f);
-  ImGui::Text("%s", text.c_str());
-  ImGui::SetWindowFontScale(1.0f);
-
-  ImGui::PopStyleColor();
-  ImGui::End();
-  ImGui::PopStyleVar(2);
 }
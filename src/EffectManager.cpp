@@ -9,10 +9,18 @@
 #include "EnemySystem.h"
 #include "GlobalModifiers.h"
 #include "Logger.h"
+#include "Metrics.h"
 #include "Player.h"
 #include "config/PlayerConfig.h"
 
-EffectManager::EffectManager() : accumulatedTime(0.0f) {
+EffectManager::EffectManager(uint32_t rngSeed)
+    : accumulatedTime(0.0f),
+      rng(rngSeed),
+      effectsApplied(&MetricsRegistry::instance().counter(
+          "gambit_effects_applied_total",
+          "Effects newly applied (stacking onto an existing one excluded)")),
+      effectsExpired(&MetricsRegistry::instance().counter(
+          "gambit_effects_expired_total", "Effects that ran out")) {
   Logger::info("EffectManager created");
 }
 
@@ -34,8 +42,8 @@ void EffectManager::update(float deltaTime,
       // Check if player died from DoT
       if (player.health <= 0.0f && !player.isDead()) {
         player.health = 0.0f;
-        Logger::info("💀 Player " + std::to_string(playerId) +
-                     " died from DoT");
+        Logger::info(LogSubsystem::Effect, "💀 Player {} died from DoT",
+                     playerId);
       }
     }
   }
@@ -59,10 +67,8 @@ void EffectManager::update(float deltaTime,
         enemy.deathTime = accumulatedTime;
 
         // Set random respawn delay (5-10 seconds)
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
         std::uniform_real_distribution<float> dist(5000.0f, 10000.0f);
-        enemy.respawnDelay = dist(gen);
+        enemy.respawnDelay = dist(rng);
 
         // Find Wound effect to credit the killer
         uint32_t killerId = 0;
@@ -71,10 +77,10 @@ void EffectManager::update(float deltaTime,
           killerId = woundEffect->sourceId;
         }
 
-        Logger::info("💀 Enemy " + std::to_string(enemyId) +
-                     " died from DoT (killed by player " +
-                     std::to_string(killerId) + ", respawn in " +
-                     std::to_string(enemy.respawnDelay / 1000.0f) + "s)");
+        Logger::info(LogSubsystem::Effect,
+                     "💀 Enemy {} died from DoT (killed by player {}, "
+                     "respawn in {:.1f}s)",
+                     enemyId, killerId, enemy.respawnDelay / 1000.0f);
 
         // Record death for broadcasting
         if (enemySystem) {
@@ -109,8 +115,8 @@ void EffectManager::cleanseDebuff(uint32_t playerId, EffectType type) {
     const EffectDefinition& def = EffectRegistry::get(type);
     if (def.category == EffectCategory::Debuff) {
       it->second.removeEffect(type);
-      Logger::debug("Cleansed debuff " + std::string(def.name) +
-                    " from player " + std::to_string(playerId));
+      Logger::debug(LogSubsystem::Effect, "Cleansed debuff {} from player {}",
+                    def.name, playerId);
     }
   }
 }
@@ -121,8 +127,8 @@ void EffectManager::purgeBuff(uint32_t playerId, EffectType type) {
     const EffectDefinition& def = EffectRegistry::get(type);
     if (def.category == EffectCategory::Buff) {
       it->second.removeEffect(type);
-      Logger::debug("Purged buff " + std::string(def.name) + " from player " +
-                    std::to_string(playerId));
+      Logger::debug(LogSubsystem::Effect, "Purged buff {} from player {}",
+                    def.name, playerId);
     }
   }
 }
@@ -214,8 +220,8 @@ void EffectManager::consumeOnDamage(uint32_t targetId, bool isEnemy,
       effects->removeEffect(EffectType::Guard);
     }
 
-    Logger::debug("Guard consumed, damage reduced by " +
-                  std::to_string(totalReduction * 100.0f) + "%");
+    Logger::debug(LogSubsystem::Effect, "Guard consumed, damage reduced by {}%",
+                  totalReduction * 100.0f);
   }
 
   // Expose increases damage (consumed on use)
@@ -232,8 +238,9 @@ void EffectManager::consumeOnDamage(uint32_t targetId, bool isEnemy,
       effects->removeEffect(EffectType::Expose);
     }
 
-    Logger::debug("Expose consumed, damage increased by " +
-                  std::to_string(totalIncrease * 100.0f) + "%");
+    Logger::debug(LogSubsystem::Effect,
+                  "Expose consumed, damage increased by {}%",
+                  totalIncrease * 100.0f);
   }
 
   // Apply Vulnerable/Fortified (NOT consumed - applied via calculateModifiers)
@@ -251,8 +258,8 @@ void EffectManager::applyEffectInternal(ActiveEffects& activeEffects,
 
   // Check if effect can be applied (immunities)
   if (!canApplyEffect(activeEffects, type)) {
-    Logger::debug("Cannot apply effect " + std::string(def.name) +
-                  " (immune or blocked)");
+    Logger::debug(LogSubsystem::Effect,
+                  "Cannot apply effect {} (immune or blocked)", def.name);
     return;
   }
 
@@ -275,31 +282,33 @@ void EffectManager::applyEffectInternal(ActiveEffects& activeEffects,
             static_cast<int>(existing->stacks) + static_cast<int>(stacks),
             static_cast<int>(def.maxStacks)));
         existing->remainingDuration = modifiedDuration;
-        Logger::debug("Stacked effect " + std::string(def.name) + " to " +
-                      std::to_string(existing->stacks) + " stacks");
+        Logger::debug(LogSubsystem::Effect, "Stacked effect {} to {} stacks",
+                      def.name, existing->stacks);
         break;
 
       case StackBehavior::Extends:
         // Add to duration
         existing->remainingDuration += modifiedDuration;
-        Logger::debug("Extended effect " + std::string(def.name) +
-                      " duration to " +
-                      std::to_string(existing->remainingDuration) + "ms");
+        Logger::debug(LogSubsystem::Effect,
+                      "Extended effect {} duration to {}ms", def.name,
+                      existing->remainingDuration);
         break;
 
       case StackBehavior::Overrides:
         // Reset duration
         existing->remainingDuration = modifiedDuration;
-        Logger::debug("Overrode effect " + std::string(def.name) + " duration");
+        Logger::debug(LogSubsystem::Effect, "Overrode effect {} duration",
+                      def.name);
         break;
     }
   } else {
     // New effect
     EffectInstance instance(type, stacks, modifiedDuration, sourceId);
     activeEffects.effects.push_back(instance);
-    Logger::info("✨ Applied new effect " + std::string(def.name) + " with " +
-                 std::to_string(stacks) + " stacks, duration " +
-                 std::to_string(modifiedDuration) + "ms");
+    effectsApplied->add();
+    Logger::info(LogSubsystem::Effect,
+                 "✨ Applied new effect {} with {} stacks, duration {}ms",
+                 def.name, stacks, modifiedDuration);
   }
 
   // Apply secondary effects
@@ -336,9 +345,9 @@ void EffectManager::updateEntityEffects(uint32_t entityId,
   // Remove expired effects
   for (EffectType expiredType : expiredEffects) {
     activeEffects.removeEffect(expiredType);
-    Logger::info("⏱️  Effect " +
-                 std::string(EffectRegistry::getName(expiredType)) +
-                 " expired on entity " + std::to_string(entityId));
+    effectsExpired->add();
+    Logger::info(LogSubsystem::Effect, "⏱️  Effect {} expired on entity {}",
+                 EffectRegistry::getName(expiredType), entityId);
   }
 }
 
@@ -398,12 +407,13 @@ void EffectManager::handleOppositeEffect(ActiveEffects& activeEffects,
       // Remove one stack of opposite effect
       if (oppositeEffect->stacks > 1) {
         oppositeEffect->stacks--;
-        Logger::debug("Removed 1 stack of opposite effect " +
-                      std::string(EffectRegistry::getName(opposite)));
+        Logger::debug(LogSubsystem::Effect,
+                      "Removed 1 stack of opposite effect {}",
+                      EffectRegistry::getName(opposite));
       } else {
         activeEffects.removeEffect(opposite);
-        Logger::debug("Removed opposite effect " +
-                      std::string(EffectRegistry::getName(opposite)));
+        Logger::debug(LogSubsystem::Effect, "Removed opposite effect {}",
+                      EffectRegistry::getName(opposite));
       }
     }
   }
@@ -422,8 +432,8 @@ void EffectManager::applySecondaryEffects(ActiveEffects& activeEffects,
     applyEffectInternal(activeEffects, secondary.type, secondary.stacks,
                         secondaryDef.baseDuration, sourceId, isPlayer);
 
-    Logger::debug("Applied secondary effect " + std::string(secondaryDef.name) +
-                  " from " + std::string(def.name));
+    Logger::debug(LogSubsystem::Effect, "Applied secondary effect {} from {}",
+                  secondaryDef.name, def.name);
   }
 }
 
@@ -444,13 +454,13 @@ void EffectManager::tickWoundMend(EffectInstance& instance, float deltaTime,
     if (instance.type == EffectType::Wound) {
       health -= totalValue;
       health = std::max(0.0f, health);
-      Logger::info("💉 Wound ticked for " + std::to_string(totalValue) +
-                   " damage");
+      Logger::info(LogSubsystem::Effect, "💉 Wound ticked for {} damage",
+                   totalValue);
     } else {  // Mend
       health += totalValue;
       health = std::min(maxHealth, health);
-      Logger::info("💚 Mend ticked for " + std::to_string(totalValue) +
-                   " healing");
+      Logger::info(LogSubsystem::Effect, "💚 Mend ticked for {} healing",
+                   totalValue);
       // Note: Healing events are published client-side when health increase is
       // detected
     }
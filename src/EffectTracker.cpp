@@ -1,15 +1,19 @@
 #include "EffectTracker.h"
 
+#include <algorithm>
+
 #include "Logger.h"
 #include "NetworkProtocol.h"
 
 const std::vector<EffectInstance> EffectTracker::emptyEffects;
 
-EffectTracker::EffectTracker() {
-  EventBus::instance().subscribe<NetworkPacketReceivedEvent>(
+EffectTracker::EffectTracker(EventBus& bus) {
+  subscriptions.push_back(bus.subscribeScoped<NetworkPacketReceivedEvent>(
       [this](const NetworkPacketReceivedEvent& e) {
         onNetworkPacketReceived(e);
-      });
+      }));
+  subscriptions.push_back(bus.subscribeScoped<LocalAttackEvent>(
+      [this](const LocalAttackEvent& e) { targetedEnemy = e.enemyId; }));
 
   Logger::info("EffectTracker initialized");
 }
@@ -37,6 +41,7 @@ void EffectTracker::onNetworkPacketReceived(
     EffectUpdatePacket packet = deserializeEffectUpdate(e.data, e.size);
 
     auto& effectMap = packet.isEnemy ? enemyEffects : playerEffects;
+    auto& affected = packet.isEnemy ? affectedEnemies : affectedPlayers;
     auto& effects = effectMap[packet.targetId];
     effects.clear();
 
@@ -51,9 +56,33 @@ void EffectTracker::onNetworkPacketReceived(
       effects.push_back(instance);
     }
 
-    // If no effects, remove from map
+    // Keep the sorted index in step: drop the entity when its effects
+    // run out, insert it when it first gets some
+    auto pos =
+        std::lower_bound(affected.begin(), affected.end(), packet.targetId);
+    bool indexed = pos != affected.end() && *pos == packet.targetId;
     if (effects.empty()) {
       effectMap.erase(packet.targetId);
+      if (indexed) affected.erase(pos);
+    } else if (!indexed) {
+      affected.insert(pos, packet.targetId);
     }
+  } else if (type == PacketType::EnemyDied) {
+    EnemyDiedPacket packet = deserializeEnemyDied(e.data, e.size);
+    removeEnemy(packet.enemyId);
+  }
+}
+
+void EffectTracker::removeEnemy(uint32_t enemyId) {
+  // The server sends no final EffectUpdate for a dead enemy, and its id may
+  // be reused by a later spawn
+  enemyEffects.erase(enemyId);
+  auto pos =
+      std::lower_bound(affectedEnemies.begin(), affectedEnemies.end(), enemyId);
+  if (pos != affectedEnemies.end() && *pos == enemyId) {
+    affectedEnemies.erase(pos);
+  }
+  if (targetedEnemy == enemyId) {
+    targetedEnemy = 0;
   }
 }
@@ -1,23 +1,29 @@
 #include "EnemyInterpolation.h"
 
-#include <SDL2/SDL.h>
-
 #include "AnimationAssetLoader.h"
 #include "AnimationSystem.h"
 #include "DamageNumberSystem.h"
 #include "Logger.h"
 
-EnemyInterpolation::EnemyInterpolation(AnimationSystem* animSystem)
-    : animationSystem(animSystem) {
+EnemyInterpolation::EnemyInterpolation(AnimationSystem* animSystem,
+                                       EventBus& bus)
+    : animationSystem(animSystem), bus(bus) {
   // Subscribe to network packet events
-  EventBus::instance().subscribe<NetworkPacketReceivedEvent>(
+  subscriptions.push_back(bus.subscribeScoped<NetworkPacketReceivedEvent>(
       [this](const NetworkPacketReceivedEvent& e) {
         onNetworkPacketReceived(e);
-      });
+      }));
 
   Logger::info("EnemyInterpolation initialized");
 }
 
+EnemyInterpolation::~EnemyInterpolation() {
+  if (!animationSystem) return;
+  for (auto& [id, enemy] : enemies) {
+    animationSystem->unregisterEntity(&enemy);
+  }
+}
+
 void EnemyInterpolation::onNetworkPacketReceived(
     const NetworkPacketReceivedEvent& e) {
   if (e.size == 0) return;
@@ -26,9 +32,10 @@ void EnemyInterpolation::onNetworkPacketReceived(
 
   if (type == PacketType::EnemyStateUpdate) {
     EnemyStateUpdatePacket packet = deserializeEnemyStateUpdate(e.data, e.size);
+    serverClock.observe(packet.serverTick, ServerClock::nowMs());
 
     for (const auto& enemyState : packet.enemies) {
-      updateEnemyState(enemyState);
+      updateEnemyState(enemyState, packet.serverTick);
     }
   } else if (type == PacketType::EnemyDied) {
     EnemyDiedPacket packet = deserializeEnemyDied(e.data, e.size);
@@ -39,7 +46,8 @@ void EnemyInterpolation::onNetworkPacketReceived(
   }
 }
 
-void EnemyInterpolation::updateEnemyState(const NetworkEnemyState& state) {
+void EnemyInterpolation::updateEnemyState(const NetworkEnemyState& state,
+                                          uint32_t serverTick) {
   uint32_t enemyId = state.id;
 
   // Create enemy if first time seeing it
@@ -85,7 +93,7 @@ void EnemyInterpolation::updateEnemyState(const NetworkEnemyState& state) {
     damageEvent.y = state.y;
     damageEvent.damageAmount = damageTaken;
     damageEvent.isCritical = false;  // TODO: Add crit system later
-    EventBus::instance().publish(damageEvent);
+    bus.publish(damageEvent);
   } else if (enemy.health > oldHealth && enemy.state != ::EnemyState::Dead) {
     // Enemy was healed - publish event for healing numbers
     float healAmount = enemy.health - oldHealth;
@@ -93,7 +101,7 @@ void EnemyInterpolation::updateEnemyState(const NetworkEnemyState& state) {
     healEvent.x = state.x;
     healEvent.y = state.y;
     healEvent.healAmount = healAmount;
-    EventBus::instance().publish(healEvent);
+    bus.publish(healEvent);
   }
 
   // Add snapshot for interpolation
@@ -104,14 +112,8 @@ void EnemyInterpolation::updateEnemyState(const NetworkEnemyState& state) {
   snapshot.vy = state.vy;
   snapshot.health = state.health;
   snapshot.state = state.state;
-  snapshot.timestamp = SDL_GetTicks64();
-
-  auto& queue = snapshots[enemyId];
-  queue.push_back(snapshot);
-
-  if (queue.size() > MAX_SNAPSHOTS) {
-    queue.pop_front();
-  }
+  snapshot.serverTick = serverTick;
+  snapshots[enemyId].push(snapshot);
 }
 
 void EnemyInterpolation::removeEnemy(uint32_t enemyId) {
@@ -125,37 +127,61 @@ void EnemyInterpolation::removeEnemy(uint32_t enemyId) {
   Logger::info("Removed enemy ID=" + std::to_string(enemyId));
 }
 
+double EnemyInterpolation::getRenderTick() const {
+  return serverClock.getRenderTick(ServerClock::nowMs());
+}
+
+bool EnemyInterpolation::samplePosition(uint32_t enemyId, double renderTick,
+                                        float& x, float& y) const {
+  auto snapIt = snapshots.find(enemyId);
+  if (snapIt == snapshots.end() || snapIt->second.empty()) {
+    return false;
+  }
+
+  double maxExtrapolationTicks =
+      Config::Network::MAX_EXTRAPOLATION_MS / serverClock.getTickMs();
+  auto s = snapIt->second.sample(renderTick, maxExtrapolationTicks);
+  float seconds = s.extrapolateTicks * serverClock.getTickMs() / 1000.0f;
+  x = s.from->x + (s.to->x - s.from->x) * s.t + s.to->vx * seconds;
+  y = s.from->y + (s.to->y - s.from->y) * s.t + s.to->vy * seconds;
+  return true;
+}
+
 bool EnemyInterpolation::getInterpolatedState(uint32_t enemyId,
-                                              float interpolation,
+                                              double renderTick,
                                               Enemy& outEnemy) const {
   auto it = enemies.find(enemyId);
   if (it == enemies.end()) {
     return false;
   }
 
-  const Enemy& enemy = it->second;
-
-  auto snapIt = snapshots.find(enemyId);
-  if (snapIt == snapshots.end() || snapIt->second.size() < 2) {
-    // Not enough snapshots, return current state
-    outEnemy = enemy;
-    return true;
+  // Health and state stay the latest known; only motion is delayed
+  outEnemy = it->second;
+  if (samplePosition(enemyId, renderTick, outEnemy.x, outEnemy.y)) {
+    const EnemySnapshot& newest = snapshots.at(enemyId).newest();
+    outEnemy.vx = newest.vx;
+    outEnemy.vy = newest.vy;
   }
-
-  // Interpolate between last two snapshots
-  const auto& queue = snapIt->second;
-  const EnemySnapshot& prev = queue[queue.size() - 2];
-  const EnemySnapshot& curr = queue[queue.size() - 1];
-
-  outEnemy = enemy;
-  outEnemy.x = prev.x + (curr.x - prev.x) * interpolation;
-  outEnemy.y = prev.y + (curr.y - prev.y) * interpolation;
-  outEnemy.vx = curr.vx;
-  outEnemy.vy = curr.vy;
-
   return true;
 }
 
+void EnemyInterpolation::appendRenderStates(
+    double renderTick, std::vector<EnemyRenderState>& out) const {
+  for (const auto& [id, enemy] : enemies) {
+    EnemyRenderState state;
+    state.id = id;
+    state.x = enemy.x;
+    state.y = enemy.y;
+    state.health = enemy.health;
+    state.maxHealth = enemy.maxHealth;
+    state.state = enemy.state;
+    state.animation = enemy.getAnimationController();
+    samplePosition(id, renderTick, state.x, state.y);
+
+    out.push_back(state);
+  }
+}
+
 std::vector<uint32_t> EnemyInterpolation::getEnemyIds() const {
   std::vector<uint32_t> ids;
   ids.reserve(enemies.size());
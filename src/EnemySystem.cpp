@@ -6,14 +6,33 @@
 
 #include "EffectManager.h"
 #include "Logger.h"
+#include "Metrics.h"
 #include "config/GameplayConfig.h"
 
-EnemySystem::EnemySystem(const std::vector<EnemySpawn>& spawns)
-    : spawns(spawns), nextEnemyId(1), accumulatedTime(0.0f) {
+EnemySystem::EnemySystem(const std::vector<EnemySpawn>& spawns, EventBus& bus,
+                         uint32_t rngSeed)
+    : spawns(spawns),
+      nextEnemyId(1),
+      accumulatedTime(0.0f),
+      bus(bus),
+      rng(rngSeed) {
+  MetricsRegistry& metrics = MetricsRegistry::instance();
+  aliveEnemies = &metrics.gauge("gambit_enemies_alive", "Enemies not dead");
+  enemyDeaths = &metrics.counter("gambit_enemy_deaths_total",
+                                 "Enemies killed by any cause");
+
   Logger::info("EnemySystem initialized with " + std::to_string(spawns.size()) +
                " spawn points");
 }
 
+EnemySystem::~EnemySystem() {
+  size_t alive = 0;
+  for (const auto& [id, enemy] : enemies) {
+    if (enemy.state != EnemyState::Dead) ++alive;
+  }
+  aliveEnemies->add(-static_cast<double>(alive));
+}
+
 void EnemySystem::spawnAllEnemies() {
   for (size_t i = 0; i < spawns.size(); ++i) {
     const auto& spawn = spawns[i];
@@ -38,6 +57,7 @@ void EnemySystem::spawnAllEnemies() {
     }
 
     enemies[enemy.id] = enemy;
+    aliveEnemies->add(1);
 
     Logger::info("Spawned enemy ID=" + std::to_string(enemy.id) +
                  " type=" + std::to_string(static_cast<int>(enemy.type)) +
@@ -49,9 +69,6 @@ void EnemySystem::spawnAllEnemies() {
 void EnemySystem::update(float deltaTime,
                          std::unordered_map<uint32_t, Player>& players,
                          EffectManager* effectManager) {
-  // Clear death events from last frame
-  diedThisFrame.clear();
-
   // Update accumulated time (deltaTime is already in milliseconds)
   accumulatedTime += deltaTime;
 
@@ -78,8 +95,8 @@ void EnemySystem::update(float deltaTime,
           continue;
         }
 
-        Logger::info("Enemy time" + std::to_string(enemy.deathTime) +
-                     " respawn delay " + std::to_string(enemy.respawnDelay));
+        Logger::info(LogSubsystem::Enemy, "Enemy time{} respawn delay {}",
+                     enemy.deathTime, enemy.respawnDelay);
 
         enemy.x = spawn.x;
         enemy.y = spawn.y;
@@ -90,9 +107,10 @@ void EnemySystem::update(float deltaTime,
         enemy.targetPlayerId = 0;
         enemy.deathTime = 0.0f;
         enemy.respawnDelay = 0.0f;
+        aliveEnemies->add(1);
 
-        Logger::info("Enemy " + std::to_string(id) + " respawned at spawn " +
-                     std::to_string(enemy.spawnIndex));
+        Logger::info(LogSubsystem::Enemy, "Enemy {} respawned at spawn {}", id,
+                     enemy.spawnIndex);
       }
 
       continue;  // Don't update AI for dead enemies
@@ -142,8 +160,9 @@ void EnemySystem::updateIdleState(
     enemy.targetPlayerId = nearestPlayer->id;
     enemy.state = EnemyState::Chase;
 
-    Logger::debug("Enemy " + std::to_string(enemy.id) + " detected player " +
-                  std::to_string(nearestPlayer->id) + ", entering Chase state");
+    Logger::debug(LogSubsystem::Enemy,
+                  "Enemy {} detected player {}, entering Chase state", enemy.id,
+                  nearestPlayer->id);
   } else {
     // No targets nearby, stay idle
     enemy.vx = 0.0f;
@@ -270,8 +289,8 @@ void EnemySystem::updateAttackState(
   }
 
   if (!canAct) {
-    Logger::debug("Enemy " + std::to_string(enemy.id) +
-                  " is stunned, cannot attack");
+    Logger::debug(LogSubsystem::Enemy, "Enemy {} is stunned, cannot attack",
+                  enemy.id);
     return;
   }
 
@@ -290,10 +309,9 @@ void EnemySystem::updateAttackState(
       // Apply player's damage taken modifiers and consume Expose/Guard
       effectManager->consumeOnDamage(target.id, false, damage);
 
-      Logger::debug("Enemy attack damage: " + std::to_string(enemy.damage) +
-                    " → modified: " + std::to_string(damage) +
-                    " (enemy mult: " +
-                    std::to_string(enemyMods.damageDealtMultiplier) + ")");
+      Logger::debug(LogSubsystem::Enemy,
+                    "Enemy attack damage: {} → modified: {} (enemy mult: {})",
+                    enemy.damage, damage, enemyMods.damageDealtMultiplier);
     }
 
     // Apply damage
@@ -305,10 +323,9 @@ void EnemySystem::updateAttackState(
     // Update attack timestamp
     enemy.lastAttackTime = accumulatedTime;
 
-    Logger::debug("Enemy " + std::to_string(enemy.id) + " attacked player " +
-                  std::to_string(target.id) + " for " +
-                  std::to_string(enemy.damage) +
-                  " damage, health: " + std::to_string(target.health));
+    Logger::debug(LogSubsystem::Enemy,
+                  "Enemy {} attacked player {} for {} damage, health: {}",
+                  enemy.id, target.id, enemy.damage, target.health);
   }
 
   // Stand still while in attack state
@@ -320,8 +337,8 @@ void EnemySystem::damageEnemy(uint32_t enemyId, float damage,
                               uint32_t attackerId) {
   auto it = enemies.find(enemyId);
   if (it == enemies.end()) {
-    Logger::info("Attempted to damage non-existent enemy ID=" +
-                 std::to_string(enemyId));
+    Logger::info(LogSubsystem::Enemy,
+                 "Attempted to damage non-existent enemy ID={}", enemyId);
     return;
   }
 
@@ -335,10 +352,8 @@ void EnemySystem::damageEnemy(uint32_t enemyId, float damage,
   // Apply damage
   enemy.health -= damage;
 
-  Logger::debug("Enemy " + std::to_string(enemyId) + " took " +
-                std::to_string(damage) + " damage, " +
-                "health: " + std::to_string(enemy.health) + "/" +
-                std::to_string(enemy.maxHealth));
+  Logger::debug(LogSubsystem::Enemy, "Enemy {} took {} damage, health: {}/{}",
+                enemyId, damage, enemy.health, enemy.maxHealth);
 
   // Check if killed
   if (enemy.health <= 0.0f) {
@@ -348,20 +363,28 @@ void EnemySystem::damageEnemy(uint32_t enemyId, float damage,
     enemy.vy = 0.0f;
     enemy.deathTime = accumulatedTime;
 
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
     std::uniform_real_distribution<float> dist(5000.0f, 10000.0f);
-    enemy.respawnDelay = dist(gen);
+    enemy.respawnDelay = dist(rng);
 
-    Logger::info("Enemy " + std::to_string(enemyId) + " killed by player " +
-                 std::to_string(attackerId) + " (respawn in " +
-                 std::to_string(enemy.respawnDelay / 1000.0f) + "s)");
+    Logger::info(LogSubsystem::Enemy,
+                 "Enemy {} killed by player {} (respawn in {:.1f}s)", enemyId,
+                 attackerId, enemy.respawnDelay / 1000.0f);
 
     // Track death for broadcasting
-    diedThisFrame.push_back({enemyId, attackerId});
+    recordDeath(enemyId, attackerId);
   }
 }
 
+void EnemySystem::recordDeath(uint32_t enemyId, uint32_t killerId) {
+  auto it = enemies.find(enemyId);
+  assert(it != enemies.end() && "Recording death of unknown enemy");
+  aliveEnemies->add(-1);
+  enemyDeaths->add();
+
+  bus.enqueue(EnemyDiedEvent{enemyId, killerId, it->second.x, it->second.y},
+              EventPhase::AfterSimulation);
+}
+
 const Player* EnemySystem::findNearestPlayer(
     const Enemy& enemy, const std::unordered_map<uint32_t, Player>& players,
     float maxRange) const {
@@ -404,7 +427,7 @@ void EnemySystem::disableSpawnsInRadius(float x, float y, float radius) {
                    " removed by disabled spawn zone at (" + std::to_string(x) +
                    ", " + std::to_string(y) + ")");
 
-      diedThisFrame.push_back({id, 0});
+      recordDeath(id, 0);
     }
   }
 
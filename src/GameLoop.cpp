@@ -4,10 +4,10 @@
 
 #include <cassert>
 
-#include "EventBus.h"
 #include "Logger.h"
 
-GameLoop::GameLoop() : running(false), frameNumber(0) {}
+GameLoop::GameLoop(EventBus& bus)
+    : bus(bus), running(false), frameNumber(0) {}
 
 void GameLoop::tick() {
   auto currentTime = std::chrono::steady_clock::now();
@@ -28,29 +28,29 @@ void GameLoop::tick() {
 
   while (accumulator >= TARGET_DELTA_MS) {
     UpdateEvent updateEvent{TARGET_DELTA_MS, frameNumber++};
-    EventBus::instance().publish(updateEvent);
+    bus.publish(updateEvent);
     accumulator -= TARGET_DELTA_MS;
   }
 
   // Always render (browser controls vsync via requestAnimationFrame)
   float interpolation = accumulator / TARGET_DELTA_MS;
   RenderEvent renderEvent{interpolation};
-  EventBus::instance().publish(renderEvent);
-  EventBus::instance().publish(SwapBuffersEvent{});
+  bus.publish(renderEvent);
+  bus.publish(SwapBuffersEvent{});
 #else
   // Update loop ALWAYS fires at 60 FPS
   UpdateEvent updateEvent{TARGET_DELTA_MS, frameNumber++};
-  EventBus::instance().publish(updateEvent);
+  bus.publish(updateEvent);
 
   // Render only if we have time
   float interpolation = elapsed / TARGET_DELTA_MS;
   interpolation = std::min(interpolation, 1.0f);
 
   RenderEvent renderEvent{interpolation};
-  EventBus::instance().publish(renderEvent);
+  bus.publish(renderEvent);
 
   // Swap buffers after all rendering is complete
-  EventBus::instance().publish(SwapBuffersEvent{});
+  bus.publish(SwapBuffersEvent{});
 
   // Sleep to maintain 60 FPS
   auto endTime = std::chrono::steady_clock::now();
@@ -23,6 +23,7 @@ GameSession::~GameSession() {
   collisionSystem.reset();
   map.reset();
   channel.reset();
+  serverBus.reset();
 }
 
 std::unique_ptr<GameSession> GameSession::create() {
@@ -30,6 +31,9 @@ std::unique_ptr<GameSession> GameSession::create() {
 
   Logger::info("GameSession: Creating embedded server mode");
 
+  // Server systems get their own bus, separate from the client's
+  session->serverBus = std::make_unique<EventBus>();
+
   // Create shared communication channel
   session->channel = createInMemoryChannel();
 
@@ -51,8 +55,8 @@ std::unique_ptr<GameSession> GameSession::create() {
   // Create server with in-memory transport
   auto serverTransport =
       std::make_unique<InMemoryServerTransport>(session->channel);
-  session->server =
-      std::make_unique<NetworkServer>(std::move(serverTransport));
+  session->server = std::make_unique<NetworkServer>(std::move(serverTransport),
+                                                    *session->serverBus);
 
   // Initialize server (no actual port binding in embedded mode)
   if (!session->server->initialize("embedded", 0)) {
@@ -66,8 +70,8 @@ std::unique_ptr<GameSession> GameSession::create() {
                     session->collisionSystem.get(), session->map.get());
 
   // Create server game state
-  session->serverGameState =
-      std::make_unique<ServerGameState>(session->server.get(), world);
+  session->serverGameState = std::make_unique<ServerGameState>(
+      session->server.get(), world, *session->serverBus);
 
   // Create client with in-memory transport
   auto clientTransport =
@@ -84,7 +88,12 @@ std::unique_ptr<GameSession> GameSession::create() {
   return session;
 }
 
-void GameSession::tick() {
+void GameSession::tick(const UpdateEvent& update) {
+  // Step the server simulation (same order as server_main: update, then poll)
+  if (serverBus) {
+    serverBus->publish(update);
+  }
+
   // Poll server to process client messages and generate responses
   if (server) {
     server->poll();
@@ -1,5 +1,7 @@
 #include "GameStateManager.h"
 
+#include <chrono>
+
 #include "EventBus.h"
 #include "Logger.h"
 
@@ -26,3 +28,22 @@ void GameStateManager::transitionTo(GameState newState) {
   // Publish event
   EventBus::instance().publish(GameStateChangedEvent{previousState, newState});
 }
+
+void GameStateManager::addLoadingFuture(GameState state,
+                                        std::shared_future<void> future) {
+  loadingFutures[state].push_back(std::move(future));
+}
+
+bool GameStateManager::isLoaded(GameState state) const {
+  auto it = loadingFutures.find(state);
+  if (it == loadingFutures.end()) {
+    return true;
+  }
+  for (const auto& future : it->second) {
+    if (future.wait_for(std::chrono::seconds(0)) !=
+        std::future_status::ready) {
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,55 @@
+#include "GlyphAtlas.h"
+
+#include <cstring>
+
+namespace {
+
+constexpr char GLYPH_CHARS[] = "0123456789+-!";
+constexpr int GLYPH_COUNT = sizeof(GLYPH_CHARS) - 1;
+
+// One string per row, '#' = set pixel
+constexpr const char* GLYPH_ROWS[GLYPH_COUNT][GlyphAtlas::GLYPH_HEIGHT] = {
+    {" ### ", "#   #", "#  ##", "# # #", "##  #", "#   #", " ### "},  // 0
+    {"  #  ", " ##  ", "  #  ", "  #  ", "  #  ", "  #  ", " ### "},  // 1
+    {" ### ", "#   #", "    #", "   # ", "  #  ", " #   ", "#####"},  // 2
+    {"#####", "   # ", "  #  ", "   # ", "    #", "#   #", " ### "},  // 3
+    {"   # ", "  ## ", " # # ", "#  # ", "#####", "   # ", "   # "},  // 4
+    {"#####", "#    ", "#### ", "    #", "    #", "#   #", " ### "},  // 5
+    {"  ## ", " #   ", "#    ", "#### ", "#   #", "#   #", " ### "},  // 6
+    {"#####", "    #", "   # ", "  #  ", " #   ", " #   ", " #   "},  // 7
+    {" ### ", "#   #", "#   #", " ### ", "#   #", "#   #", " ### "},  // 8
+    {" ### ", "#   #", "#   #", " ####", "    #", "   # ", " ##  "},  // 9
+    {"     ", "  #  ", "  #  ", "#####", "  #  ", "  #  ", "     "},  // +
+    {"     ", "     ", "     ", "#####", "     ", "     ", "     "},  // -
+    {"  #  ", "  #  ", "  #  ", "  #  ", "  #  ", "     ", "  #  "},  // !
+};
+
+// One transparent pixel between glyphs so filtering never bleeds
+constexpr int CELL_WIDTH = GlyphAtlas::GLYPH_WIDTH + 1;
+
+}  // namespace
+
+GlyphAtlas::GlyphAtlas()
+    : width(GLYPH_COUNT * CELL_WIDTH), height(GLYPH_HEIGHT) {
+  pixels.assign(static_cast<size_t>(width) * height * 4, 0);
+
+  for (int glyph = 0; glyph < GLYPH_COUNT; ++glyph) {
+    for (int row = 0; row < GLYPH_HEIGHT; ++row) {
+      for (int col = 0; col < GLYPH_WIDTH; ++col) {
+        if (GLYPH_ROWS[glyph][row][col] != '#') continue;
+        size_t offset =
+            (static_cast<size_t>(row) * width + glyph * CELL_WIDTH + col) * 4;
+        std::memset(&pixels[offset], 255, 4);
+      }
+    }
+  }
+}
+
+bool GlyphAtlas::getGlyph(char c, int& srcX, int& srcY) const {
+  const char* found = std::strchr(GLYPH_CHARS, c);
+  if (c == '\0' || !found) return false;
+
+  srcX = static_cast<int>(found - GLYPH_CHARS) * CELL_WIDTH;
+  srcY = 0;
+  return true;
+}
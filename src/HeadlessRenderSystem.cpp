@@ -2,9 +2,9 @@
 
 #include "Logger.h"
 
-HeadlessRenderSystem::HeadlessRenderSystem() {
-  EventBus::instance().subscribe<RenderEvent>(
-      [this](const RenderEvent& e) { onRender(e); });
+HeadlessRenderSystem::HeadlessRenderSystem(EventBus& bus) {
+  subscriptions.push_back(bus.subscribeScoped<RenderEvent>(
+      [this](const RenderEvent& e) { onRender(e); }));
 
   Logger::info("HeadlessRenderSystem initialized");
 }
@@ -2,12 +2,12 @@
 
 #include "Logger.h"
 
-HeadlessUISystem::HeadlessUISystem() {
-  EventBus::instance().subscribe<RenderEvent>(
-      [this](const RenderEvent& e) { onRender(e); });
+HeadlessUISystem::HeadlessUISystem(EventBus& bus) {
+  subscriptions.push_back(bus.subscribeScoped<RenderEvent>(
+      [this](const RenderEvent& e) { onRender(e); }));
 
-  EventBus::instance().subscribe<ItemPickedUpEvent>(
-      [this](const ItemPickedUpEvent& e) { onItemPickedUp(e); });
+  subscriptions.push_back(bus.subscribeScoped<ItemPickedUpEvent>(
+      [this](const ItemPickedUpEvent& e) { onItemPickedUp(e); }));
 
   Logger::info("HeadlessUISystem initialized");
 }
@@ -5,7 +5,7 @@
 #include "EventBus.h"
 #include "Logger.h"
 
-InputScript::InputScript() : nextActionIndex(0) {}
+InputScript::InputScript(EventBus& bus) : bus(bus), nextActionIndex(0) {}
 
 InputScript::~InputScript() {}
 
@@ -64,11 +64,11 @@ void InputScript::processFrame(uint64_t currentFrame) {
     const auto& action = actions[nextActionIndex];
 
     if (action.isKeyDown) {
-      EventBus::instance().publish(KeyDownEvent{action.key});
+      bus.publish(KeyDownEvent{action.key});
       Logger::debug("InputScript: KeyDown " + std::to_string(action.key) +
                     " at frame " + std::to_string(currentFrame));
     } else {
-      EventBus::instance().publish(KeyUpEvent{action.key});
+      bus.publish(KeyUpEvent{action.key});
       Logger::debug("InputScript: KeyUp " + std::to_string(action.key) +
                     " at frame " + std::to_string(currentFrame));
     }
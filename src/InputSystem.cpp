@@ -8,7 +8,8 @@
 InputSystem::InputSystem(ClientPrediction* clientPrediction,
                          CollisionDebugRenderer* collisionDebugRenderer,
                          MusicZoneDebugRenderer* musicZoneDebugRenderer,
-                         ObjectiveDebugRenderer* objectiveDebugRenderer)
+                         ObjectiveDebugRenderer* objectiveDebugRenderer,
+                         EventBus& bus)
     : moveLeft(false),
       moveRight(false),
       moveUp(false),
@@ -18,17 +19,18 @@ InputSystem::InputSystem(ClientPrediction* clientPrediction,
       clientPrediction(clientPrediction),
       collisionDebugRenderer(collisionDebugRenderer),
       musicZoneDebugRenderer(musicZoneDebugRenderer),
-      objectiveDebugRenderer(objectiveDebugRenderer) {
+      objectiveDebugRenderer(objectiveDebugRenderer),
+      bus(bus) {
   // Subscribe to key events
-  EventBus::instance().subscribe<KeyDownEvent>(
-      [this](const KeyDownEvent& e) { onKeyDown(e); });
+  subscriptions.push_back(bus.subscribeScoped<KeyDownEvent>(
+      [this](const KeyDownEvent& e) { onKeyDown(e); }));
 
-  EventBus::instance().subscribe<KeyUpEvent>(
-      [this](const KeyUpEvent& e) { onKeyUp(e); });
+  subscriptions.push_back(bus.subscribeScoped<KeyUpEvent>(
+      [this](const KeyUpEvent& e) { onKeyUp(e); }));
 
   // Subscribe to update events to publish input state
-  EventBus::instance().subscribe<UpdateEvent>(
-      [this](const UpdateEvent& e) { onUpdate(e); });
+  subscriptions.push_back(bus.subscribeScoped<UpdateEvent>(
+      [this](const UpdateEvent& e) { onUpdate(e); }));
 }
 
 void InputSystem::onKeyDown(const KeyDownEvent& e) {
@@ -106,7 +108,7 @@ void InputSystem::onKeyDown(const KeyDownEvent& e) {
 
   // Toggle mute with M or F2
   if (e.key == SDLK_m || e.key == SDLK_F2) {
-    EventBus::instance().publish(ToggleMuteEvent{});
+    bus.publish(ToggleMuteEvent{});
   }
 
   // Only process game input during Playing state
@@ -117,7 +119,7 @@ void InputSystem::onKeyDown(const KeyDownEvent& e) {
   // Attack input (Spacebar)
   if (e.key == SDLK_SPACE) {
     Logger::info("InputSystem: SPACEBAR PRESSED - publishing AttackInputEvent");
-    EventBus::instance().publish(AttackInputEvent{});
+    bus.publish(AttackInputEvent{});
   }
 
   // Interact input (E key) - for objectives
@@ -125,7 +127,7 @@ void InputSystem::onKeyDown(const KeyDownEvent& e) {
     if (!interactHeld) {
       interactHeld = true;
       Logger::info("InputSystem: E PRESSED - publishing InteractInputEvent");
-      EventBus::instance().publish(InteractInputEvent{});
+      bus.publish(InteractInputEvent{});
     }
   }
 
@@ -162,5 +164,5 @@ void InputSystem::onUpdate(const UpdateEvent& e) {
   input.moveDown = moveDown;
   input.inputSequence = inputSequence++;
 
-  EventBus::instance().publish(input);
+  bus.publish(input);
 }
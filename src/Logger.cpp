@@ -1,14 +1,173 @@
 #include "Logger.h"
 
+#include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+
+#ifndef __EMSCRIPTEN__
+#include <spdlog/async.h>
+#endif
+
+namespace {
+
+// Lines the writer thread can fall behind by before dropping the oldest
+constexpr size_t QUEUE_SIZE = 8192;
+
+constexpr size_t SUBSYSTEM_COUNT = static_cast<size_t>(LogSubsystem::Count);
+
+const char* const SUBSYSTEM_NAMES[SUBSYSTEM_COUNT] = {
+    "general", "network", "combat", "enemy", "effect", "render", "audio"};
+
+const char* const LEVEL_NAMES[] = {"debug", "info", "error", "off"};
+
+spdlog::level::level_enum toSpdlog(LogLevel level) {
+  switch (level) {
+    case LogLevel::Debug:
+      return spdlog::level::debug;
+    case LogLevel::Info:
+      return spdlog::level::info;
+    case LogLevel::Error:
+      return spdlog::level::err;
+    case LogLevel::Off:
+      break;
+  }
+  return spdlog::level::off;
+}
+
+bool parseLevel(const std::string& name, LogLevel& out) {
+  for (size_t i = 0; i < std::size(LEVEL_NAMES); ++i) {
+    if (name == LEVEL_NAMES[i]) {
+      out = static_cast<LogLevel>(i);
+      return true;
+    }
+  }
+  return false;
+}
+
+std::once_flag initOnce;
+
+}  // namespace
+
+std::atomic<uint8_t> Logger::levels[SUBSYSTEM_COUNT] = {
+    static_cast<uint8_t>(LogLevel::Info), static_cast<uint8_t>(LogLevel::Info),
+    static_cast<uint8_t>(LogLevel::Info), static_cast<uint8_t>(LogLevel::Info),
+    static_cast<uint8_t>(LogLevel::Info), static_cast<uint8_t>(LogLevel::Info),
+    static_cast<uint8_t>(LogLevel::Info)};
+static_assert(SUBSYSTEM_COUNT == 7, "Give the new subsystem a level above");
+
 void Logger::init() {
-  spdlog::set_pattern("[%T] [%^%l%$] %v");
+  std::call_once(initOnce, [] {
+    auto sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+#ifdef __EMSCRIPTEN__
+    auto logger = std::make_shared<spdlog::logger>("gambit", sink);
+#else
+    spdlog::init_thread_pool(QUEUE_SIZE, 1);
+    auto logger = std::make_shared<spdlog::async_logger>(
+        "gambit", sink, spdlog::thread_pool(),
+        spdlog::async_overflow_policy::overrun_oldest);
+    std::atexit(shutdown);
+#endif
+    // Levels are filtered before lines get here
+    logger->set_level(spdlog::level::debug);
+    logger->flush_on(spdlog::level::err);
+    spdlog::set_default_logger(logger);
+    spdlog::set_pattern("[%T] [%^%l%$] %v");
+  });
+
+  if (const char* spec = std::getenv("GAMBIT_LOG")) {
+    configure(spec);
+  }
   spdlog::info("Logger initialized");
 }
 
-void Logger::info(const std::string& message) { spdlog::info(message); }
+void Logger::shutdown() { spdlog::shutdown(); }
 
-void Logger::debug(const std::string& message) { spdlog::debug(message); }
+void Logger::info(const std::string& message) {
+  if (isEnabled(LogSubsystem::General, LogLevel::Info)) {
+    write(LogLevel::Info, LogSubsystem::General, message);
+  }
+}
 
-void Logger::error(const std::string& message) { spdlog::error(message); }
+void Logger::debug(const std::string& message) {
+  if (isEnabled(LogSubsystem::General, LogLevel::Debug)) {
+    write(LogLevel::Debug, LogSubsystem::General, message);
+  }
+}
+
+void Logger::error(const std::string& message) {
+  if (isEnabled(LogSubsystem::General, LogLevel::Error)) {
+    write(LogLevel::Error, LogSubsystem::General, message);
+  }
+}
+
+void Logger::setLevel(LogSubsystem subsystem, LogLevel level) {
+  levels[static_cast<size_t>(subsystem)].store(static_cast<uint8_t>(level),
+                                               std::memory_order_relaxed);
+}
+
+LogLevel Logger::getLevel(LogSubsystem subsystem) {
+  return static_cast<LogLevel>(
+      levels[static_cast<size_t>(subsystem)].load(std::memory_order_relaxed));
+}
+
+bool Logger::configure(const std::string& spec) {
+  bool ok = true;
+  size_t start = 0;
+  while (start <= spec.size()) {
+    size_t end = spec.find(',', start);
+    if (end == std::string::npos) end = spec.size();
+    std::string part = spec.substr(start, end - start);
+    start = end + 1;
+    if (part.empty()) continue;
+
+    LogLevel level;
+    size_t eq = part.find('=');
+    if (eq == std::string::npos) {
+      if (!parseLevel(part, level)) {
+        error("Unknown log level '" + part + "'");
+        ok = false;
+        continue;
+      }
+      for (size_t i = 0; i < SUBSYSTEM_COUNT; ++i) {
+        setLevel(static_cast<LogSubsystem>(i), level);
+      }
+      continue;
+    }
+
+    std::string name = part.substr(0, eq);
+    if (!parseLevel(part.substr(eq + 1), level)) {
+      error("Unknown log level in '" + part + "'");
+      ok = false;
+      continue;
+    }
+    size_t i = 0;
+    while (i < SUBSYSTEM_COUNT && name != SUBSYSTEM_NAMES[i]) ++i;
+    if (i == SUBSYSTEM_COUNT) {
+      error("Unknown log subsystem '" + name + "'");
+      ok = false;
+      continue;
+    }
+    setLevel(static_cast<LogSubsystem>(i), level);
+  }
+  return ok;
+}
+
+const char* Logger::getSubsystemName(LogSubsystem subsystem) {
+  size_t i = static_cast<size_t>(subsystem);
+  return i < SUBSYSTEM_COUNT ? SUBSYSTEM_NAMES[i] : "unknown";
+}
+
+void Logger::write(LogLevel level, LogSubsystem subsystem,
+                   fmt::string_view message) {
+  spdlog::logger* logger = spdlog::default_logger_raw();
+  if (!logger) return;  // Past shutdown (e.g., a static destructor)
+  if (subsystem == LogSubsystem::General) {
+    logger->log(toSpdlog(level), message);
+  } else {
+    logger->log(toSpdlog(level), "[{}] {}", getSubsystemName(subsystem),
+                message);
+  }
+}
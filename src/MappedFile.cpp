@@ -0,0 +1,70 @@
+#include "MappedFile.h"
+
+#include <cassert>
+#include <fstream>
+#include <iterator>
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GAMBIT_HAS_MMAP 1
+#endif
+
+#include "Logger.h"
+
+MappedFile::~MappedFile() { close(); }
+
+bool MappedFile::open(const std::string& path) {
+  assert(!data && "MappedFile already open");
+
+#ifdef GAMBIT_HAS_MMAP
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+    ::close(fd);
+    return false;
+  }
+  void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ,
+                    MAP_PRIVATE, fd, 0);
+  ::close(fd);  // The mapping keeps its own reference
+  if (view == MAP_FAILED) {
+    Logger::error("Failed to map " + path);
+    return false;
+  }
+  data = static_cast<const uint8_t*>(view);
+  size = static_cast<size_t>(info.st_size);
+  mapped = true;
+  return true;
+#else
+  // Emscripten's in-memory filesystem would copy on mmap anyway
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  buffer.assign(std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>());
+  if (buffer.empty()) {
+    return false;
+  }
+  data = buffer.data();
+  size = buffer.size();
+  return true;
+#endif
+}
+
+void MappedFile::close() {
+#ifdef GAMBIT_HAS_MMAP
+  if (mapped) {
+    munmap(const_cast<uint8_t*>(data), size);
+  }
+#endif
+  data = nullptr;
+  size = 0;
+  mapped = false;
+  buffer.clear();
+}
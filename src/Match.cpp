@@ -0,0 +1,58 @@
+#include "Match.h"
+
+#include <cassert>
+
+#include "Logger.h"
+#include "NetworkServer.h"
+#include "ReplayRecorder.h"
+#include "ServerGameState.h"
+#include "config/TimingConfig.h"
+
+Match::Match(uint32_t matchId, std::unique_ptr<IServerTransport> transport,
+             const WorldConfig& world, uint32_t rngSeed)
+    : id(matchId) {
+  server = std::make_unique<NetworkServer>(std::move(transport), bus);
+  gameState =
+      std::make_unique<ServerGameState>(server.get(), world, bus, rngSeed);
+}
+
+Match::~Match() {
+  recorder.reset();
+  // Game state unsubscribes from the bus and may still broadcast on teardown
+  gameState.reset();
+  server.reset();
+}
+
+bool Match::initialize(const std::string& address, uint16_t port) {
+  if (!server->initialize(address, port)) {
+    Logger::error("Match " + std::to_string(id) +
+                  ": Failed to initialize server on port " +
+                  std::to_string(port));
+    return false;
+  }
+  return true;
+}
+
+bool Match::startRecording(const std::string& path,
+                           const std::string& mapPath) {
+  assert(frameNumber == 0 && "Recording must start before the first tick");
+  assert(!recorder && "Match is already recording");
+
+  recorder = std::make_unique<ReplayRecorder>(bus);
+  if (!recorder->start(path, gameState->getRngSeed(), mapPath)) {
+    recorder.reset();
+    return false;
+  }
+  return true;
+}
+
+void Match::tick() {
+  bool wasTicking = ticking.exchange(true, std::memory_order_acquire);
+  assert(!wasTicking && "Match ticked on two threads at once");
+  (void)wasTicking;
+
+  bus.publish(UpdateEvent{Config::Timing::TARGET_DELTA_MS, frameNumber++});
+  server->poll();
+
+  ticking.store(false, std::memory_order_release);
+}
@@ -0,0 +1,127 @@
+#include "MatchScheduler.h"
+
+#include <SDL2/SDL.h>
+
+#include <cassert>
+#include <chrono>
+
+#include "Logger.h"
+#include "Match.h"
+#include "config/TimingConfig.h"
+
+MatchScheduler::MatchScheduler(size_t threadCount) {
+  assert(threadCount > 0 && "MatchScheduler needs at least one thread");
+
+  workers.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; ++i) {
+    workers.emplace_back([this]() { workerLoop(); });
+  }
+  Logger::info("MatchScheduler started with " + std::to_string(threadCount) +
+               " worker threads");
+}
+
+MatchScheduler::~MatchScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  roundStarted.notify_all();
+
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+void MatchScheduler::addMatch(Match* match) {
+  assert(match != nullptr && "Cannot schedule null match");
+  assert(roundNumber == 0 && "Matches must be added before the first round");
+  matches.push_back(match);
+}
+
+void MatchScheduler::tickAll() {
+  if (matches.empty()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    assert(pendingMatches == 0 && "Previous round still running");
+    nextMatch.store(0, std::memory_order_release);
+    pendingMatches = matches.size();
+    roundNumber++;
+  }
+  roundStarted.notify_all();
+
+  std::unique_lock<std::mutex> lock(mutex);
+  roundFinished.wait(lock, [this]() { return pendingMatches == 0; });
+}
+
+void MatchScheduler::run(const volatile bool& running) {
+  auto nextRound = std::chrono::steady_clock::now();
+  const auto roundDuration = std::chrono::duration_cast<
+      std::chrono::steady_clock::duration>(
+      std::chrono::duration<float, std::milli>(
+          Config::Timing::TARGET_DELTA_MS));
+
+  while (running) {
+    auto start = std::chrono::steady_clock::now();
+    tickAll();
+    auto end = std::chrono::steady_clock::now();
+
+    // Tiger Style: Warn if a round overruns the tick budget
+    float roundMs =
+        std::chrono::duration<float, std::milli>(end - start).count();
+    if (roundMs > Config::Timing::MAX_FRAME_TIME_MS) {
+      Logger::debug("Scheduler round " + std::to_string(roundNumber) +
+                    " took " + std::to_string(roundMs) + "ms for " +
+                    std::to_string(matches.size()) + " matches");
+    }
+
+    nextRound += roundDuration;
+    if (nextRound > end) {
+      std::this_thread::sleep_until(nextRound);
+    } else {
+      // Behind schedule: don't try to catch up with a burst of rounds
+      nextRound = end;
+    }
+  }
+}
+
+void MatchScheduler::workerLoop() {
+  uint64_t seenRound = 0;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      roundStarted.wait(
+          lock, [&]() { return stopping || roundNumber != seenRound; });
+      if (stopping) {
+        return;
+      }
+      seenRound = roundNumber;
+    }
+
+    // Claim matches until the cursor passes the end. The round cannot finish
+    // while this worker holds unreported ticks, so every index claimed here
+    // belongs to one round. acq_rel pairs with the cursor reset so the
+    // previous tick of a match (possibly on another worker) is visible.
+    size_t completed = 0;
+    while (true) {
+      size_t index = nextMatch.fetch_add(1, std::memory_order_acq_rel);
+      if (index >= matches.size()) {
+        break;
+      }
+      matches[index]->tick();
+      completed++;
+    }
+
+    if (completed > 0) {
+      std::lock_guard<std::mutex> lock(mutex);
+      assert(pendingMatches >= completed && "Round accounting underflow");
+      pendingMatches -= completed;
+      if (pendingMatches == 0) {
+        roundFinished.notify_one();
+      }
+    }
+  }
+}
@@ -0,0 +1,204 @@
+#include "Metrics.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+
+std::atomic<size_t> nextShard{0};
+
+// Integers print without a fraction; Prometheus parses either
+void appendValue(std::string& out, double v) {
+  char buffer[32];
+  if (std::isinf(v)) {
+    out += v > 0 ? "+Inf" : "-Inf";
+    return;
+  }
+  if (v == std::floor(v) && std::fabs(v) < 1e15) {
+    std::snprintf(buffer, sizeof(buffer), "%.0f", v);
+  } else {
+    std::snprintf(buffer, sizeof(buffer), "%.6g", v);
+  }
+  out += buffer;
+}
+
+void appendSample(std::string& out, const std::string& name,
+                  const std::string& labels, double v) {
+  out += name;
+  if (!labels.empty()) {
+    out += '{';
+    out += labels;
+    out += '}';
+  }
+  out += ' ';
+  appendValue(out, v);
+  out += '\n';
+}
+
+}  // namespace
+
+size_t Counter::shardIndex() {
+  thread_local size_t shard =
+      nextShard.fetch_add(1, std::memory_order_relaxed) % SHARD_COUNT;
+  return shard;
+}
+
+uint64_t Counter::value() const {
+  uint64_t total = 0;
+  for (const Shard& shard : shards) {
+    total += shard.value.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+void Gauge::add(double delta) {
+  double current = bits.load(std::memory_order_relaxed);
+  while (!bits.compare_exchange_weak(current, current + delta,
+                                     std::memory_order_relaxed)) {
+  }
+}
+
+Histogram::Histogram(std::vector<double> bounds)
+    : upperBounds(std::move(bounds)),
+      buckets(new std::atomic<uint64_t>[upperBounds.size() + 1]) {
+  assert(std::is_sorted(upperBounds.begin(), upperBounds.end()) &&
+         "Histogram bounds must ascend");
+  for (size_t i = 0; i <= upperBounds.size(); ++i) {
+    buckets[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+void Histogram::observe(double v) {
+  size_t i = std::lower_bound(upperBounds.begin(), upperBounds.end(), v) -
+             upperBounds.begin();
+  buckets[i].fetch_add(1, std::memory_order_relaxed);
+  total.add(v);
+}
+
+uint64_t Histogram::count() const {
+  uint64_t n = 0;
+  for (size_t i = 0; i <= upperBounds.size(); ++i) {
+    n += bucketCount(i);
+  }
+  return n;
+}
+
+MetricsRegistry& MetricsRegistry::instance() {
+  static MetricsRegistry registry;
+  return registry;
+}
+
+MetricsRegistry::Series& MetricsRegistry::findOrAdd(const std::string& name,
+                                                    const std::string& help,
+                                                    Type type,
+                                                    const std::string& labels) {
+  auto family =
+      std::find_if(families.begin(), families.end(),
+                   [&](const Family& f) { return f.name == name; });
+  if (family == families.end()) {
+    families.push_back({name, help, type, {}});
+    family = families.end() - 1;
+  }
+  assert(family->type == type && "Metric re-registered with another type");
+
+  for (Series& series : family->series) {
+    if (series.labels == labels) return series;
+  }
+  family->series.push_back({labels, nullptr, nullptr, nullptr});
+  return family->series.back();
+}
+
+Counter& MetricsRegistry::counter(const std::string& name,
+                                  const std::string& help,
+                                  const std::string& labels) {
+  std::lock_guard<std::mutex> lock(mutex);
+  Series& series = findOrAdd(name, help, Type::Counter, labels);
+  if (!series.counter) series.counter = std::make_unique<Counter>();
+  return *series.counter;
+}
+
+Gauge& MetricsRegistry::gauge(const std::string& name, const std::string& help,
+                              const std::string& labels) {
+  std::lock_guard<std::mutex> lock(mutex);
+  Series& series = findOrAdd(name, help, Type::Gauge, labels);
+  if (!series.gauge) series.gauge = std::make_unique<Gauge>();
+  return *series.gauge;
+}
+
+Histogram& MetricsRegistry::histogram(const std::string& name,
+                                      const std::string& help,
+                                      const std::vector<double>& upperBounds,
+                                      const std::string& labels) {
+  std::lock_guard<std::mutex> lock(mutex);
+  Series& series = findOrAdd(name, help, Type::Histogram, labels);
+  if (!series.histogram) {
+    series.histogram = std::make_unique<Histogram>(upperBounds);
+  }
+  return *series.histogram;
+}
+
+void MetricsRegistry::remove(const std::string& name,
+                             const std::string& labels) {
+  std::lock_guard<std::mutex> lock(mutex);
+  for (Family& family : families) {
+    if (family.name != name) continue;
+    auto& series = family.series;
+    series.erase(std::remove_if(series.begin(), series.end(),
+                                [&](const Series& s) {
+                                  return s.labels == labels;
+                                }),
+                 series.end());
+    return;
+  }
+}
+
+std::string MetricsRegistry::renderPrometheus() const {
+  static const char* const TYPE_NAMES[] = {"counter", "gauge", "histogram"};
+
+  std::string out;
+  std::lock_guard<std::mutex> lock(mutex);
+  for (const Family& family : families) {
+    out += "# HELP " + family.name + " " + family.help + "\n";
+    out += "# TYPE " + family.name + " " +
+           TYPE_NAMES[static_cast<int>(family.type)] + "\n";
+
+    for (const Series& series : family.series) {
+      switch (family.type) {
+        case Type::Counter:
+          appendSample(out, family.name, series.labels,
+                       static_cast<double>(series.counter->value()));
+          break;
+        case Type::Gauge:
+          appendSample(out, family.name, series.labels,
+                       series.gauge->value());
+          break;
+        case Type::Histogram: {
+          const Histogram& h = *series.histogram;
+          std::string prefix =
+              series.labels.empty() ? "" : series.labels + ",";
+          uint64_t cumulative = 0;
+          const auto& bounds = h.getUpperBounds();
+          for (size_t i = 0; i <= bounds.size(); ++i) {
+            cumulative += h.bucketCount(i);
+            std::string le;
+            if (i < bounds.size()) {
+              appendValue(le, bounds[i]);
+            } else {
+              le = "+Inf";
+            }
+            appendSample(out, family.name + "_bucket",
+                         prefix + "le=\"" + le + "\"",
+                         static_cast<double>(cumulative));
+          }
+          appendSample(out, family.name + "_sum", series.labels, h.sum());
+          appendSample(out, family.name + "_count", series.labels,
+                       static_cast<double>(cumulative));
+          break;
+        }
+      }
+    }
+  }
+  return out;
+}
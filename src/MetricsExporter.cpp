@@ -0,0 +1,181 @@
+#include "MetricsExporter.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include "Logger.h"
+#include "Metrics.h"
+
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr const char* SOCKET_PREFIX = "unix:";
+
+// How often the socket loop checks for stop() between connections
+constexpr int SOCKET_POLL_MS = 100;
+
+#ifdef MSG_NOSIGNAL
+constexpr int SEND_FLAGS = MSG_NOSIGNAL;  // A scraper hanging up early
+#else
+constexpr int SEND_FLAGS = 0;  // macOS: SO_NOSIGPIPE is set per socket
+#endif
+
+}  // namespace
+
+MetricsExporter::MetricsExporter(MetricsRegistry& registry,
+                                 std::string target, int intervalMs)
+    : registry(registry), target(std::move(target)), intervalMs(intervalMs) {}
+
+MetricsExporter::~MetricsExporter() { stop(); }
+
+bool MetricsExporter::isSocket() const {
+  return target.rfind(SOCKET_PREFIX, 0) == 0;
+}
+
+std::string MetricsExporter::socketPath() const {
+  return target.substr(std::strlen(SOCKET_PREFIX));
+}
+
+bool MetricsExporter::start() {
+  if (thread.joinable()) return true;
+  stopping = false;
+
+  if (!isSocket()) {
+    thread = std::thread([this]() { fileLoop(); });
+    Logger::info("Exporting metrics to " + target + " every " +
+                 std::to_string(intervalMs) + "ms");
+    return true;
+  }
+
+#ifdef _WIN32
+  Logger::error("Metrics sockets are not supported on this platform");
+  return false;
+#else
+  std::string path = socketPath();
+  sockaddr_un addr{};
+  if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+    Logger::error("Invalid metrics socket path: " + path);
+    return false;
+  }
+  addr.sun_family = AF_UNIX;
+  std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+
+  listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listenFd < 0) {
+    Logger::error("Failed to create metrics socket");
+    return false;
+  }
+  unlink(path.c_str());  // Left over from a previous run
+  if (bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+      listen(listenFd, 8) != 0) {
+    Logger::error("Failed to bind metrics socket " + path + ": " +
+                  std::strerror(errno));
+    close(listenFd);
+    listenFd = -1;
+    return false;
+  }
+
+  thread = std::thread([this]() { socketLoop(); });
+  Logger::info("Serving metrics on unix socket " + path);
+  return true;
+#endif
+}
+
+void MetricsExporter::stop() {
+  if (!thread.joinable()) return;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  wake.notify_all();
+  thread.join();
+
+#ifndef _WIN32
+  if (listenFd >= 0) {
+    close(listenFd);
+    listenFd = -1;
+    unlink(socketPath().c_str());
+  }
+#endif
+}
+
+bool MetricsExporter::writeFile() const {
+  std::string text = registry.renderPrometheus();
+  std::string temp = target + ".tmp";
+
+  FILE* file = std::fopen(temp.c_str(), "wb");
+  if (!file) return false;
+  bool ok = std::fwrite(text.data(), 1, text.size(), file) == text.size();
+  ok = std::fclose(file) == 0 && ok;
+  return ok && std::rename(temp.c_str(), target.c_str()) == 0;
+}
+
+void MetricsExporter::fileLoop() {
+  bool reportedFailure = false;
+  std::unique_lock<std::mutex> lock(mutex);
+  while (!stopping) {
+    lock.unlock();
+    bool ok = writeFile();
+    if (!ok && !reportedFailure) {
+      Logger::error("Failed to write metrics to " + target);
+    }
+    reportedFailure = !ok;
+    lock.lock();
+
+    wake.wait_for(lock, std::chrono::milliseconds(intervalMs),
+                  [this]() { return stopping.load(); });
+  }
+  lock.unlock();
+
+  writeFile();  // Final values on shutdown
+}
+
+void MetricsExporter::socketLoop() {
+#ifndef _WIN32
+  while (!stopping) {
+    pollfd pfd{listenFd, POLLIN, 0};
+    if (poll(&pfd, 1, SOCKET_POLL_MS) <= 0) continue;
+
+    int client = accept(listenFd, nullptr, nullptr);
+    if (client < 0) continue;
+#ifdef SO_NOSIGPIPE
+    int one = 1;
+    setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+
+    // Take whatever request was sent (closing with it unread would reset
+    // the connection), then answer with a bare HTTP/1.0 response so curl
+    // and Prometheus can read it; `nc -U` shows headers and text
+    char request[1024];
+    pollfd readable{client, POLLIN, 0};
+    if (poll(&readable, 1, SOCKET_POLL_MS) > 0) {
+      recv(client, request, sizeof(request), 0);
+    }
+
+    std::string body = registry.renderPrometheus();
+    std::string response =
+        "HTTP/1.0 200 OK\r\n"
+        "Content-Type: text/plain; version=0.0.4\r\n"
+        "Content-Length: " +
+        std::to_string(body.size()) + "\r\n\r\n" + body;
+
+    size_t sent = 0;
+    while (sent < response.size()) {
+      ssize_t n = ::send(client, response.data() + sent,
+                         response.size() - sent, SEND_FLAGS);
+      if (n <= 0) break;
+      sent += static_cast<size_t>(n);
+    }
+    close(client);
+  }
+#endif
+}
@@ -0,0 +1,188 @@
+#include "MinimapRaster.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace {
+
+constexpr uint32_t rgba(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+  return (uint32_t(r) << 24) | (uint32_t(g) << 16) | (uint32_t(b) << 8) | a;
+}
+
+constexpr uint32_t GROUND_COLOR = rgba(60, 72, 60, 200);
+constexpr uint32_t COLLISION_COLOR = rgba(140, 70, 60, 220);
+constexpr uint32_t DEPOSIT_COLOR = rgba(255, 200, 50, 230);
+constexpr uint32_t DEPOSIT_OUTLINE_COLOR = rgba(255, 255, 255, 180);
+
+// Each extra tile layer at a spot lightens the ground a little
+constexpr uint8_t LAYER_SHADE_STEP = 14;
+
+uint32_t objectiveColor(ObjectiveState state) {
+  switch (state) {
+    case ObjectiveState::Inactive:
+      return rgba(180, 180, 60, 200);
+    case ObjectiveState::InProgress:
+      return rgba(60, 120, 255, 220);
+    case ObjectiveState::ReadyToDeposit:
+      return rgba(255, 140, 0, 220);
+    case ObjectiveState::Completed:
+      return rgba(60, 220, 60, 200);
+  }
+  return rgba(180, 180, 180, 180);
+}
+
+}  // namespace
+
+MinimapRaster::MinimapRaster(int width, int height)
+    : width(width),
+      height(height),
+      terrain(static_cast<size_t>(width) * height * 4, 0),
+      pixels(terrain) {
+  assert(width > 0 && height > 0 && "Minimap must have pixels");
+}
+
+void MinimapRaster::bakeTerrain(
+    int mapWidth, int mapHeight, int tileWidth, int tileHeight,
+    const std::vector<const uint32_t*>& tileLayers,
+    const std::vector<CollisionShape>& collisionShapes, float newWorldWidth,
+    float newWorldHeight) {
+  worldWidth = std::max(newWorldWidth, 1.0f);
+  worldHeight = std::max(newWorldHeight, 1.0f);
+  std::fill(pixels.begin(), pixels.end(), 0);
+
+  // Same centering as TileChunkGrid::gridToWorld, inverted: each pixel
+  // center goes back to the grid cell whose diamond contains it
+  float centerTileX = (mapWidth - 1) / 2.0f;
+  float centerTileY = (mapHeight - 1) / 2.0f;
+  float centerWorldX = (centerTileX - centerTileY) * tileWidth / 2.0f;
+  float centerWorldY = (centerTileX + centerTileY) * tileHeight / 4.0f;
+  float halfTileW = std::max(tileWidth / 2.0f, 1.0f);
+  float quarterTileH = std::max(tileHeight / 4.0f, 1.0f);
+
+  for (int py = 0; py < height; ++py) {
+    float wy = (py + 0.5f) / height * worldHeight - worldHeight / 2.0f;
+    float v = (wy + centerWorldY) / quarterTileH;
+    for (int px = 0; px < width; ++px) {
+      float wx = (px + 0.5f) / width * worldWidth - worldWidth / 2.0f;
+      float u = (wx + centerWorldX) / halfTileW;
+      int tileX = static_cast<int>(std::lround((u + v) / 2.0f));
+      int tileY = static_cast<int>(std::lround((v - u) / 2.0f));
+      if (tileX < 0 || tileY < 0 || tileX >= mapWidth || tileY >= mapHeight) {
+        continue;
+      }
+
+      size_t index = static_cast<size_t>(tileY) * mapWidth + tileX;
+      int layers = 0;
+      for (const uint32_t* gids : tileLayers) {
+        if (gids && gids[index] != 0) ++layers;
+      }
+      if (layers == 0) continue;
+
+      int shade = std::min((layers - 1) * LAYER_SHADE_STEP, 120);
+      setPixel(px, py, GROUND_COLOR + rgba(shade, shade, shade, 0));
+    }
+  }
+
+  for (const CollisionShape& shape : collisionShapes) {
+    float x0, y0, x1, y1;
+    worldToPixel(shape.aabb.x, shape.aabb.y, x0, y0);
+    worldToPixel(shape.aabb.x + shape.aabb.width,
+                 shape.aabb.y + shape.aabb.height, x1, y1);
+    // At least one pixel, so thin walls still show
+    int left = static_cast<int>(std::floor(x0));
+    int top = static_cast<int>(std::floor(y0));
+    int right = std::max(static_cast<int>(std::ceil(x1)), left + 1);
+    int bottom = std::max(static_cast<int>(std::ceil(y1)), top + 1);
+    for (int py = top; py < bottom; ++py) {
+      for (int px = left; px < right; ++px) {
+        setPixel(px, py, COLLISION_COLOR);
+      }
+    }
+  }
+
+  terrain = pixels;
+}
+
+void MinimapRaster::clearOverlay() { pixels = terrain; }
+
+void MinimapRaster::drawObjective(float x, float y, float radius,
+                                  ObjectiveState state, float depositX,
+                                  float depositY) {
+  float cx, cy;
+  worldToPixel(x, y, cx, cy);
+  // Scale the zone radius to minimap space, kept readable
+  float ringRadius =
+      (radius / worldWidth * width + radius / worldHeight * height) * 0.5f;
+  ringRadius = std::max(3.0f, std::min(ringRadius, 20.0f));
+
+  uint32_t color = objectiveColor(state);
+  strokeCircle(cx, cy, ringRadius, color);
+  fillCircle(cx, cy, 2.0f, color);
+
+  if (state != ObjectiveState::Completed) {
+    float dx, dy;
+    worldToPixel(depositX, depositY, dx, dy);
+    fillDiamond(dx, dy, 6.0f, DEPOSIT_OUTLINE_COLOR);
+    fillDiamond(dx, dy, 5.0f, DEPOSIT_COLOR);
+  }
+}
+
+void MinimapRaster::worldToPixel(float wx, float wy, float& px,
+                                 float& py) const {
+  px = (wx + worldWidth / 2.0f) / worldWidth * width;
+  py = (wy + worldHeight / 2.0f) / worldHeight * height;
+}
+
+void MinimapRaster::setPixel(int px, int py, uint32_t color) {
+  if (px < 0 || py < 0 || px >= width || py >= height) return;
+  uint8_t* p = &pixels[(static_cast<size_t>(py) * width + px) * 4];
+  p[0] = static_cast<uint8_t>(color >> 24);
+  p[1] = static_cast<uint8_t>(color >> 16);
+  p[2] = static_cast<uint8_t>(color >> 8);
+  p[3] = static_cast<uint8_t>(color);
+}
+
+void MinimapRaster::fillCircle(float cx, float cy, float radius,
+                               uint32_t color) {
+  int r = static_cast<int>(std::ceil(radius));
+  for (int py = static_cast<int>(cy) - r; py <= static_cast<int>(cy) + r;
+       ++py) {
+    for (int px = static_cast<int>(cx) - r; px <= static_cast<int>(cx) + r;
+         ++px) {
+      float dx = px + 0.5f - cx;
+      float dy = py + 0.5f - cy;
+      if (dx * dx + dy * dy <= radius * radius) setPixel(px, py, color);
+    }
+  }
+}
+
+void MinimapRaster::strokeCircle(float cx, float cy, float radius,
+                                 uint32_t color) {
+  // A ring about 1.5px thick, like the draw-list outline it replaces
+  int r = static_cast<int>(std::ceil(radius + 1.0f));
+  for (int py = static_cast<int>(cy) - r; py <= static_cast<int>(cy) + r;
+       ++py) {
+    for (int px = static_cast<int>(cx) - r; px <= static_cast<int>(cx) + r;
+         ++px) {
+      float dx = px + 0.5f - cx;
+      float dy = py + 0.5f - cy;
+      float d = std::sqrt(dx * dx + dy * dy);
+      if (std::fabs(d - radius) <= 0.75f) setPixel(px, py, color);
+    }
+  }
+}
+
+void MinimapRaster::fillDiamond(float cx, float cy, float halfSize,
+                                uint32_t color) {
+  int r = static_cast<int>(std::ceil(halfSize));
+  for (int py = static_cast<int>(cy) - r; py <= static_cast<int>(cy) + r;
+       ++py) {
+    for (int px = static_cast<int>(cx) - r; px <= static_cast<int>(cx) + r;
+         ++px) {
+      float dx = px + 0.5f - cx;
+      float dy = py + 0.5f - cy;
+      if (std::fabs(dx) + std::fabs(dy) <= halfSize) setPixel(px, py, color);
+    }
+  }
+}
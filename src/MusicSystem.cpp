@@ -2,6 +2,7 @@
 
 #include <cassert>
 
+#include "AssetLoader.h"
 #include "ClientPrediction.h"
 #include "EventBus.h"
 #include "GameStateManager.h"
@@ -10,7 +11,7 @@
 #include "TiledMap.h"
 
 MusicSystem::MusicSystem(const ClientPrediction* prediction,
-                         const TiledMap* map)
+                         const TiledMap* map, EventBus& bus)
     : clientPrediction(prediction),
       tiledMap(map),
       volume(DEFAULT_VOLUME),
@@ -26,17 +27,26 @@ MusicSystem::MusicSystem(const ClientPrediction* prediction,
 
   Logger::info("MusicSystem initialized");
 
+  prefetchZoneTracks();
+
   // Subscribe to UpdateEvent
-  EventBus::instance().subscribe<UpdateEvent>(
-      [this](const UpdateEvent& e) { onUpdate(e); });
+  subscriptions.push_back(bus.subscribeScoped<UpdateEvent>(
+      [this](const UpdateEvent& e) { onUpdate(e); }));
 
   // Subscribe to ToggleMuteEvent
-  EventBus::instance().subscribe<ToggleMuteEvent>(
-      [this](const ToggleMuteEvent& e) { onToggleMute(e); });
+  subscriptions.push_back(bus.subscribeScoped<ToggleMuteEvent>(
+      [this](const ToggleMuteEvent& e) { onToggleMute(e); }));
 }
 
 MusicSystem::~MusicSystem() {
-  // Free all loaded music
+  // Wait out prefetches still opening, then free all loaded music
+  for (auto& [name, pending] : pendingTracks) {
+    if (Mix_Music* music = pending.get()) {
+      Mix_FreeMusic(music);
+    }
+  }
+  pendingTracks.clear();
+
   for (auto& [name, music] : loadedTracks) {
     if (music) {
       Mix_FreeMusic(music);
@@ -129,6 +139,23 @@ void MusicSystem::setVolume(float vol) {
   Mix_VolumeMusic(static_cast<int>(volume * SDL_MIXER_MAX_VOLUME));
 }
 
+void MusicSystem::prefetchZoneTracks() {
+  if (!tiledMap) return;
+
+  // Open every zone's track in the background so crossing into a zone
+  // never stalls a frame on file I/O and decoder setup
+  for (const auto& zone : tiledMap->getMusicZones()) {
+    if (zone.trackName.empty() || pendingTracks.count(zone.trackName)) {
+      continue;
+    }
+    std::string filepath = "assets/music/" + zone.trackName;
+    pendingTracks.emplace(zone.trackName,
+                          AssetLoader::instance().submit([filepath]() {
+                            return Mix_LoadMUS(filepath.c_str());
+                          }));
+  }
+}
+
 Mix_Music* MusicSystem::loadMusic(const std::string& filename) {
   assert(!filename.empty() && "Music filename is empty");
 
@@ -140,7 +167,14 @@ Mix_Music* MusicSystem::loadMusic(const std::string& filename) {
 
   // Load from assets/music/
   std::string filepath = "assets/music/" + filename;
-  Mix_Music* music = Mix_LoadMUS(filepath.c_str());
+  Mix_Music* music = nullptr;
+  auto pending = pendingTracks.find(filename);
+  if (pending != pendingTracks.end()) {
+    music = pending->second.get();  // Normally finished long ago
+    pendingTracks.erase(pending);
+  } else {
+    music = Mix_LoadMUS(filepath.c_str());
+  }
 
   if (!music) {
     Logger::error("Mix_LoadMUS failed for " + filepath + ": " +
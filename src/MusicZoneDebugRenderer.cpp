@@ -150,6 +150,7 @@ void MusicZoneDebugRenderer::renderZone(const MusicZone& zone, size_t index) {
 void MusicZoneDebugRenderer::renderFilledRect(float x, float y, float w,
                                               float h, uint8_t r, uint8_t g,
                                               uint8_t b, uint8_t a) {
+  OpenGLUtils::markCallSite("MusicZoneDebugRenderer::renderFilledRect");
   // Convert world corners to screen coordinates
   int screenX1, screenY1, screenX2, screenY2, screenX3, screenY3, screenX4,
       screenY4;
@@ -188,6 +189,4 @@ void MusicZoneDebugRenderer::renderFilledRect(float x, float y, float w,
   glBindVertexArray(VAO);
   glDrawArrays(GL_TRIANGLE_FAN, 0, 4);  // 4 vertices = 1 quad
   glBindVertexArray(0);
-
-  OpenGLUtils::checkGLError("MusicZoneDebugRenderer::renderFilledRect");
 }
@@ -1,10 +1,10 @@
 #include "NetworkClient.h"
 
-#include "EventBus.h"
 #include "Logger.h"
 
-NetworkClient::NetworkClient(std::unique_ptr<INetworkTransport> transport)
-    : transport(std::move(transport)) {}
+NetworkClient::NetworkClient(std::unique_ptr<INetworkTransport> transport,
+                             EventBus& bus)
+    : transport(std::move(transport)), bus(bus) {}
 
 NetworkClient::~NetworkClient() {
   if (transport && transport->isConnected()) {
@@ -25,13 +25,13 @@ void NetworkClient::disconnect() {
 void NetworkClient::run() {
   if (!transport || !transport->isConnected()) return;
 
-  TransportEvent event;
-  while (transport->poll(event)) {
-    if (event.type == TransportEventType::RECEIVE) {
-      EventBus::instance().publish(NetworkPacketReceivedEvent{
-          0, event.data.data(), event.data.size()});
+  while (transport->poll(incoming)) {
+    if (incoming.type == TransportEventType::RECEIVE) {
+      bus.publish(NetworkPacketReceivedEvent{
+          0, incoming.data.data(), incoming.data.size()});
     }
   }
+  incoming.clear();
 }
 
 void NetworkClient::send(const std::string& message) {
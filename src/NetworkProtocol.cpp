@@ -2,6 +2,58 @@
 
 #include <cstring>
 
+const char* packetTypeName(uint8_t type) {
+  switch (static_cast<PacketType>(type)) {
+    case PacketType::ClientInput:
+      return "ClientInput";
+    case PacketType::StateUpdate:
+      return "StateUpdate";
+    case PacketType::PlayerJoined:
+      return "PlayerJoined";
+    case PacketType::PlayerLeft:
+      return "PlayerLeft";
+    case PacketType::EnemyStateUpdate:
+      return "EnemyStateUpdate";
+    case PacketType::EnemyDamaged:
+      return "EnemyDamaged";
+    case PacketType::EnemyDied:
+      return "EnemyDied";
+    case PacketType::AttackEnemy:
+      return "AttackEnemy";
+    case PacketType::PlayerDied:
+      return "PlayerDied";
+    case PacketType::PlayerRespawned:
+      return "PlayerRespawned";
+    case PacketType::InventoryUpdate:
+      return "InventoryUpdate";
+    case PacketType::UseItem:
+      return "UseItem";
+    case PacketType::EquipItem:
+      return "EquipItem";
+    case PacketType::ItemSpawned:
+      return "ItemSpawned";
+    case PacketType::ItemPickupRequest:
+      return "ItemPickupRequest";
+    case PacketType::ItemPickedUp:
+      return "ItemPickedUp";
+    case PacketType::EffectApplied:
+      return "EffectApplied";
+    case PacketType::EffectRemoved:
+      return "EffectRemoved";
+    case PacketType::EffectUpdate:
+      return "EffectUpdate";
+    case PacketType::CharacterSelected:
+      return "CharacterSelected";
+    case PacketType::ObjectiveState:
+      return "ObjectiveState";
+    case PacketType::ObjectiveInteract:
+      return "ObjectiveInteract";
+    case PacketType::ShipLocation:
+      return "ShipLocation";
+  }
+  return "Unknown";
+}
+
 // Helper functions for binary I/O (little-endian)
 
 void writeUint32(std::vector<uint8_t>& buffer, uint32_t value) {
@@ -258,6 +310,7 @@ std::vector<uint8_t> serialize(const EnemyStateUpdatePacket& packet) {
   std::vector<uint8_t> buffer;
 
   writeUint8(buffer, static_cast<uint8_t>(packet.type));
+  writeUint32(buffer, packet.serverTick);
   writeUint16(buffer, static_cast<uint16_t>(packet.enemies.size()));
 
   for (const auto& enemy : packet.enemies) {
@@ -272,7 +325,7 @@ std::vector<uint8_t> serialize(const EnemyStateUpdatePacket& packet) {
     writeFloat(buffer, enemy.maxHealth);
   }
 
-  // 1 + 2 + (enemyCount * 30) bytes
+  // 1 + 4 + 2 + (enemyCount * 30) bytes
   // Per enemy: 4 + 1 + 1 + 4 + 4 + 4 + 4 + 4 + 4 = 30 bytes
   return buffer;
 }
@@ -317,15 +370,16 @@ std::vector<uint8_t> serialize(const EnemyDiedPacket& packet) {
 
 EnemyStateUpdatePacket deserializeEnemyStateUpdate(const uint8_t* data,
                                                    size_t size) {
-  assert(size >= 3);  // 1 + 2 = 3 bytes minimum
+  assert(size >= 7);  // 1 + 4 + 2 = 7 bytes minimum
   assert(data[0] == static_cast<uint8_t>(PacketType::EnemyStateUpdate));
 
   EnemyStateUpdatePacket packet;
-  uint16_t enemyCount = readUint16(data + 1);
+  packet.serverTick = readUint32(data + 1);
+  uint16_t enemyCount = readUint16(data + 5);
 
-  assert(size >= 3 + (enemyCount * 30));
+  assert(size >= 7 + (enemyCount * 30));
 
-  size_t offset = 3;
+  size_t offset = 7;
   for (uint16_t i = 0; i < enemyCount; ++i) {
     NetworkEnemyState enemy;
     enemy.id = readUint32(data + offset);
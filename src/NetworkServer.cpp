@@ -2,11 +2,44 @@
 
 #include <SDL2/SDL.h>
 
-#include "EventBus.h"
 #include "Logger.h"
+#include "Metrics.h"
+#include "NetworkProtocol.h"
 
-NetworkServer::NetworkServer(std::unique_ptr<IServerTransport> transport)
-    : transport(std::move(transport)), running(false) {}
+NetworkServer::NetworkServer(std::unique_ptr<IServerTransport> transport,
+                             EventBus& bus)
+    : transport(std::move(transport)), bus(bus), running(false) {
+  registerTraffic(sent, "sent");
+  registerTraffic(received, "received");
+}
+
+void NetworkServer::registerTraffic(Traffic& traffic, const char* direction) {
+  MetricsRegistry& metrics = MetricsRegistry::instance();
+  std::string packetsName = std::string("gambit_packets_") + direction;
+  std::string bytesName = std::string("gambit_bytes_") + direction;
+  for (size_t type = 0; type < traffic.size(); ++type) {
+    // Unassigned type bytes all share the "Unknown" series
+    std::string labels = std::string("type=\"") +
+                         packetTypeName(static_cast<uint8_t>(type)) + "\"";
+    traffic[type].packets = &metrics.counter(
+        packetsName + "_total",
+        std::string("Packets ") + direction +
+            " by packet type (a broadcast counts once)",
+        labels);
+    traffic[type].bytes = &metrics.counter(
+        bytesName + "_total",
+        std::string("Payload bytes ") + direction + " by packet type",
+        labels);
+  }
+}
+
+void NetworkServer::count(Traffic& traffic, const uint8_t* data,
+                          size_t size) {
+  if (size == 0) return;
+  TrafficCounters& counters = traffic[data[0]];
+  counters.packets->add();
+  counters.bytes->add(size);
+}
 
 NetworkServer::~NetworkServer() {
   if (transport) {
@@ -38,36 +71,44 @@ void NetworkServer::run() {
 void NetworkServer::poll() {
   if (!transport) return;
 
-  TransportEvent event;
-  while (transport->poll(event)) {
-    switch (event.type) {
+  // Handlers read the packet in place; it stays valid only while they run
+  while (transport->poll(incoming)) {
+    switch (incoming.type) {
       case TransportEventType::CONNECT:
-        EventBus::instance().publish(ClientConnectedEvent{event.clientId});
+        bus.publish(ClientConnectedEvent{incoming.clientId});
         break;
 
       case TransportEventType::RECEIVE:
-        EventBus::instance().publish(NetworkPacketReceivedEvent{
-            event.clientId, event.data.data(), event.data.size()});
+        count(received, incoming.data.data(), incoming.data.size());
+        bus.publish(NetworkPacketReceivedEvent{
+            incoming.clientId, incoming.data.data(), incoming.data.size()});
         break;
 
       case TransportEventType::DISCONNECT:
-        EventBus::instance().publish(ClientDisconnectedEvent{event.clientId});
+        bus.publish(ClientDisconnectedEvent{incoming.clientId});
         break;
 
       default:
         break;
     }
   }
+  incoming.clear();
+
+  bus.flush(EventPhase::AfterNetworkReceive);
 }
 
 void NetworkServer::stop() { running = false; }
 
 void NetworkServer::broadcastPacket(const std::vector<uint8_t>& data) {
   if (!transport) return;
+  count(sent, data.data(), data.size());
+  bytesSent += data.size();
   transport->broadcast(data.data(), data.size());
 }
 
 void NetworkServer::send(uint32_t clientId, const std::vector<uint8_t>& data) {
   if (!transport) return;
+  count(sent, data.data(), data.size());
+  bytesSent += data.size();
   transport->send(clientId, data.data(), data.size());
 }
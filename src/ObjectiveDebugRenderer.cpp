@@ -92,6 +92,7 @@ void ObjectiveDebugRenderer::initRenderData() {
 }
 
 void ObjectiveDebugRenderer::render() {
+  OpenGLUtils::markCallSite("ObjectiveDebugRenderer::render");
   if (!enabled || !clientPrediction) {
     return;
   }
@@ -118,8 +119,6 @@ void ObjectiveDebugRenderer::render() {
   for (const auto& [id, objective] : objectives) {
     renderObjective(objective);
   }
-
-  OpenGLUtils::checkGLError("ObjectiveDebugRenderer::render");
 }
 
 void ObjectiveDebugRenderer::renderObjective(const ClientObjective& objective) {
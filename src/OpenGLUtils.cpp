@@ -6,11 +6,88 @@
 #include <glad/glad.h>
 #endif
 
+#include <cstdio>
+#include <cstring>
 #include <stdexcept>
 #include <vector>
 
 #include "Logger.h"
 
+// KHR_debug tokens and entry point, declared here so the layer does not
+// depend on which extensions the GL loader was generated with
+#ifndef GL_DEBUG_OUTPUT
+#define GL_DEBUG_OUTPUT 0x92E0
+#endif
+#ifndef GL_DEBUG_OUTPUT_SYNCHRONOUS
+#define GL_DEBUG_OUTPUT_SYNCHRONOUS 0x8242
+#endif
+#ifndef GL_DEBUG_TYPE_ERROR
+#define GL_DEBUG_TYPE_ERROR 0x824C
+#endif
+#ifndef GL_DEBUG_SEVERITY_HIGH
+#define GL_DEBUG_SEVERITY_HIGH 0x9146
+#endif
+#ifndef GL_DEBUG_SEVERITY_NOTIFICATION
+#define GL_DEBUG_SEVERITY_NOTIFICATION 0x826B
+#endif
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+namespace {
+
+OpenGLUtils::DebugMode debugMode = OpenGLUtils::DebugMode::Off;
+
+// Callback mode: the site whose GL calls are currently running
+const char* currentSite = "(unmarked)";
+
+// FrameCheck mode: distinct sites reached since the last check
+constexpr size_t MAX_FRAME_SITES = 32;
+std::vector<const char*> frameSites;
+
+std::string hexCode(unsigned value) {
+  char buffer[16];
+  std::snprintf(buffer, sizeof(buffer), "0x%04X", value);
+  return buffer;
+}
+
+#ifndef __EMSCRIPTEN__
+using DebugCallback = void(APIENTRY*)(GLenum source, GLenum type, GLuint id,
+                                      GLenum severity, GLsizei length,
+                                      const GLchar* message,
+                                      const void* userParam);
+using DebugMessageCallbackFn = void(APIENTRY*)(DebugCallback callback,
+                                               const void* userParam);
+
+void APIENTRY onDebugMessage(GLenum source, GLenum type, GLuint id,
+                             GLenum severity, GLsizei length,
+                             const GLchar* message, const void* userParam) {
+  if (severity == GL_DEBUG_SEVERITY_NOTIFICATION) return;
+
+  std::string report = "OpenGL " + hexCode(id) + " in " +
+                       std::string(currentSite) + ": " +
+                       std::string(message, length);
+  if (type == GL_DEBUG_TYPE_ERROR || severity == GL_DEBUG_SEVERITY_HIGH) {
+    Logger::error(report);
+  } else {
+    Logger::info(report);
+  }
+}
+
+bool hasExtension(const char* name) {
+  GLint count = 0;
+  glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+  for (GLint i = 0; i < count; ++i) {
+    const char* ext = reinterpret_cast<const char*>(
+        glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+    if (ext && std::strcmp(ext, name) == 0) return true;
+  }
+  return false;
+}
+#endif
+
+}  // namespace
+
 namespace OpenGLUtils {
 
 GLuint compileShader(GLenum type, const char* source) {
@@ -66,12 +143,73 @@ GLuint createShaderProgram(const char* vertexSource,
   return program;
 }
 
-void checkGLError(const char* operation) {
-  GLenum error = glGetError();
-  if (error != GL_NO_ERROR) {
-    Logger::error("OpenGL error after " + std::string(operation) + ": " +
-                  std::to_string(error));
+DebugMode enableDebugLayer(void* (*getProcAddress)(const char*)) {
+  // Discard anything raised before the layer existed
+  while (glGetError() != GL_NO_ERROR) {
+  }
+
+#ifndef __EMSCRIPTEN__
+  auto debugMessageCallback = reinterpret_cast<DebugMessageCallbackFn>(
+      getProcAddress("glDebugMessageCallback"));
+  if (hasExtension("GL_KHR_debug") && debugMessageCallback) {
+    glEnable(GL_DEBUG_OUTPUT);
+    // Synchronous, so the callback runs inside the offending call and
+    // currentSite is accurate
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    debugMessageCallback(onDebugMessage, nullptr);
+    debugMode = DebugMode::Callback;
+    Logger::info("GL debug layer: KHR_debug callback");
+    return debugMode;
+  }
+#endif
+
+  frameSites.reserve(MAX_FRAME_SITES);
+  debugMode = DebugMode::FrameCheck;
+  Logger::info("GL debug layer: per-frame error checks");
+  return debugMode;
+}
+
+DebugMode getDebugMode() { return debugMode; }
+
+void markCallSite(const char* site) {
+  switch (debugMode) {
+    case DebugMode::Off:
+      return;
+    case DebugMode::Callback:
+      currentSite = site;
+      return;
+    case DebugMode::FrameCheck:
+      for (const char* seen : frameSites) {
+        if (seen == site) return;
+      }
+      if (frameSites.size() < MAX_FRAME_SITES) {
+        frameSites.push_back(site);
+      }
+      return;
+  }
+}
+
+void checkFrameErrors() {
+  if (debugMode != DebugMode::FrameCheck) return;
+
+  // Errors are sticky flags; drain them all (bounded in case of a lost
+  // context, which reports forever)
+  std::string codes;
+  for (int i = 0; i < 8; ++i) {
+    GLenum error = glGetError();
+    if (error == GL_NO_ERROR) break;
+    codes += (codes.empty() ? "" : ", ") + hexCode(error);
+  }
+
+  if (!codes.empty()) {
+    std::string sites;
+    for (const char* site : frameSites) {
+      sites += (sites.empty() ? "" : ", ") + std::string(site);
+    }
+    Logger::error("OpenGL error " + codes + " this frame, raised in one of: " +
+                  (sites.empty() ? std::string("(unmarked)") : sites));
   }
+  frameSites.clear();
 }
 
 }  // namespace OpenGLUtils
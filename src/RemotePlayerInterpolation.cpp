@@ -5,15 +5,23 @@
 #include "Logger.h"
 
 RemotePlayerInterpolation::RemotePlayerInterpolation(
-    uint32_t localPlayerId, AnimationSystem* animationSystem)
+    uint32_t localPlayerId, AnimationSystem* animationSystem, EventBus& bus)
     : localPlayerId(localPlayerId),
       localPlayerIdConfirmed(false),
-      animationSystem(animationSystem) {
+      animationSystem(animationSystem),
+      bus(bus) {
   // Subscribe to network packet events
-  EventBus::instance().subscribe<NetworkPacketReceivedEvent>(
+  subscriptions.push_back(bus.subscribeScoped<NetworkPacketReceivedEvent>(
       [this](const NetworkPacketReceivedEvent& e) {
         onNetworkPacketReceived(e);
-      });
+      }));
+}
+
+RemotePlayerInterpolation::~RemotePlayerInterpolation() {
+  if (!animationSystem) return;
+  for (auto& [id, player] : remotePlayers) {
+    animationSystem->unregisterEntity(&player);
+  }
 }
 
 void RemotePlayerInterpolation::onNetworkPacketReceived(
@@ -24,7 +32,7 @@ void RemotePlayerInterpolation::onNetworkPacketReceived(
 
   if (type == PacketType::StateUpdate) {
     StateUpdatePacket stateUpdate = deserializeStateUpdate(e.data, e.size);
-    auto now = std::chrono::steady_clock::now();
+    serverClock.observe(stateUpdate.serverTick, ServerClock::nowMs());
 
     // Store snapshots for all remote players (not local player)
     for (const auto& playerState : stateUpdate.players) {
@@ -52,16 +60,7 @@ void RemotePlayerInterpolation::onNetworkPacketReceived(
       snapshot.vy = playerState.vy;
       snapshot.health = playerState.health;
       snapshot.serverTick = stateUpdate.serverTick;
-      snapshot.receivedTime = now;
-
-      // Add to buffer
-      auto& buffer = snapshotBuffers[playerState.playerId];
-      buffer.push_back(snapshot);
-
-      // Keep only last MAX_SNAPSHOTS
-      if (buffer.size() > MAX_SNAPSHOTS) {
-        buffer.pop_front();
-      }
+      snapshotBuffers[playerState.playerId].push(snapshot);
 
       // Update latest known state
       Player& remotePlayer = playerIt->second;
@@ -77,24 +76,16 @@ void RemotePlayerInterpolation::onNetworkPacketReceived(
       remotePlayer.b = playerState.b;
 
       // Update animation state based on velocity
-      if (remotePlayer.animationController) {
-        std::string prevAnim =
-            remotePlayer.animationController->getCurrentAnimationName();
-        remotePlayer.animationController->updateAnimationState(remotePlayer.vx,
-                                                               remotePlayer.vy);
-        std::string newAnim =
-            remotePlayer.animationController->getCurrentAnimationName();
-
-        // Log when animation changes (throttled)
-        static std::unordered_map<uint32_t, std::string> lastLoggedAnim;
-        if (lastLoggedAnim[playerState.playerId] != newAnim) {
-          Logger::debug("Remote player " +
-                        std::to_string(playerState.playerId) +
-                        " anim: " + prevAnim + " -> " + newAnim +
-                        " (vx=" + std::to_string(remotePlayer.vx) +
-                        ", vy=" + std::to_string(remotePlayer.vy) + ")");
-          lastLoggedAnim[playerState.playerId] = newAnim;
-        }
+      AnimationController& animation = remotePlayer.animationController;
+      AnimationClipId prevClip = animation.getCurrentClipId();
+      animation.updateAnimationState(remotePlayer.vx, remotePlayer.vy);
+
+      // Log when animation changes
+      if (animation.getCurrentClipId() != prevClip) {
+        Logger::debug("Remote player " + std::to_string(playerState.playerId) +
+                      " anim: " + animation.getCurrentAnimationName() +
+                      " (vx=" + std::to_string(remotePlayer.vx) +
+                      ", vy=" + std::to_string(remotePlayer.vy) + ")");
       }
     }
   } else if (type == PacketType::PlayerJoined) {
@@ -180,8 +171,40 @@ void RemotePlayerInterpolation::onPlayerLeft(uint32_t playerId) {
   Logger::info("Remote player " + std::to_string(playerId) + " left");
 }
 
+double RemotePlayerInterpolation::getRenderTick() const {
+  return serverClock.getRenderTick(ServerClock::nowMs());
+}
+
+bool RemotePlayerInterpolation::sample(uint32_t playerId, double renderTick,
+                                       PlayerSnapshot& out) const {
+  auto bufferIt = snapshotBuffers.find(playerId);
+  if (bufferIt == snapshotBuffers.end() || bufferIt->second.empty()) {
+    return false;
+  }
+
+  double maxExtrapolationTicks =
+      Config::Network::MAX_EXTRAPOLATION_MS / serverClock.getTickMs();
+  auto s = bufferIt->second.sample(renderTick, maxExtrapolationTicks);
+  const PlayerSnapshot& from = *s.from;
+  const PlayerSnapshot& to = *s.to;
+
+  out = to;
+  out.x = from.x + (to.x - from.x) * s.t;
+  out.y = from.y + (to.y - from.y) * s.t;
+  out.vx = from.vx + (to.vx - from.vx) * s.t;
+  out.vy = from.vy + (to.vy - from.vy) * s.t;
+  out.health = from.health + (to.health - from.health) * s.t;
+
+  if (s.extrapolateTicks > 0.0f) {
+    float seconds = s.extrapolateTicks * serverClock.getTickMs() / 1000.0f;
+    out.x += to.vx * seconds;
+    out.y += to.vy * seconds;
+  }
+  return true;
+}
+
 bool RemotePlayerInterpolation::getInterpolatedState(uint32_t playerId,
-                                                     float interpolation,
+                                                     double renderTick,
                                                      Player& outPlayer) const {
   // Check if we know about this player
   auto playerIt = remotePlayers.find(playerId);
@@ -189,45 +212,41 @@ bool RemotePlayerInterpolation::getInterpolatedState(uint32_t playerId,
     return false;  // Unknown player
   }
 
-  // Get snapshot buffer
-  auto bufferIt = snapshotBuffers.find(playerId);
-  if (bufferIt == snapshotBuffers.end() || bufferIt->second.empty()) {
-    // No snapshots yet, use latest known state
-    outPlayer = playerIt->second;
-    return true;
-  }
-
-  const auto& buffer = bufferIt->second;
-
-  // If we only have one snapshot, use it directly
-  if (buffer.size() == 1) {
-    const PlayerSnapshot& snapshot = buffer.front();
-    outPlayer = playerIt->second;
+  // With no snapshots yet, the latest known state is all there is
+  outPlayer = playerIt->second;
+  PlayerSnapshot snapshot;
+  if (sample(playerId, renderTick, snapshot)) {
     outPlayer.x = snapshot.x;
     outPlayer.y = snapshot.y;
     outPlayer.vx = snapshot.vx;
     outPlayer.vy = snapshot.vy;
     outPlayer.health = snapshot.health;
-    return true;
   }
+  return true;
+}
 
-  // Interpolate between last two snapshots
-  const PlayerSnapshot& from = buffer[buffer.size() - 2];
-  const PlayerSnapshot& to = buffer[buffer.size() - 1];
-
-  // Linear interpolation (lerp)
-  // Note: interpolation comes from RenderEvent (0.0-1.0 sub-frame position)
-  float t = interpolation;
-  t = std::clamp(t, 0.0f, 1.0f);
-
-  outPlayer = playerIt->second;
-  outPlayer.x = from.x + (to.x - from.x) * t;
-  outPlayer.y = from.y + (to.y - from.y) * t;
-  outPlayer.vx = from.vx + (to.vx - from.vx) * t;
-  outPlayer.vy = from.vy + (to.vy - from.vy) * t;
-  outPlayer.health = from.health + (to.health - from.health) * t;
+void RemotePlayerInterpolation::appendRenderStates(
+    double renderTick, std::vector<RemotePlayerRenderState>& out) const {
+  for (const auto& [id, player] : remotePlayers) {
+    RemotePlayerRenderState state;
+    state.id = id;
+    state.x = player.x;
+    state.y = player.y;
+    state.health = player.health;
+    state.r = player.r;
+    state.g = player.g;
+    state.b = player.b;
+    state.animation = player.getAnimationController();
+
+    PlayerSnapshot snapshot;
+    if (sample(id, renderTick, snapshot)) {
+      state.x = snapshot.x;
+      state.y = snapshot.y;
+      state.health = snapshot.health;
+    }
 
-  return true;
+    out.push_back(state);
+  }
 }
 
 std::vector<uint32_t> RemotePlayerInterpolation::getRemotePlayerIds() const {
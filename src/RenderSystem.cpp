@@ -17,6 +17,7 @@
 #include "GameStateManager.h"
 #include "Logger.h"
 #include "OpenGLUtils.h"
+#include "RadixSort.h"
 #include "Texture.h"
 #include "TextureManager.h"
 #include "config/PlayerConfig.h"
@@ -28,7 +29,8 @@ RenderSystem::RenderSystem(Window* window, ClientPrediction* clientPrediction,
                            Camera* camera, TiledMap* tiledMap,
                            CollisionDebugRenderer* collisionDebugRenderer,
                            MusicZoneDebugRenderer* musicZoneDebugRenderer,
-                           ObjectiveDebugRenderer* objectiveDebugRenderer)
+                           ObjectiveDebugRenderer* objectiveDebugRenderer,
+                           EventBus& bus)
     : window(window),
       clientPrediction(clientPrediction),
       remoteInterpolation(remoteInterpolation),
@@ -62,25 +64,34 @@ RenderSystem::RenderSystem(Window* window, ClientPrediction* clientPrediction,
 
   // Try to load animated player sprite sheet (fallback to colored rectangle if
   // not found)
-  playerTexture = TextureManager::instance().get("assets/player_animated.png");
-  if (!playerTexture) {
+  const TextureRegion* sheet =
+      TextureManager::instance().getRegion("assets/player_animated.png");
+  if (sheet) {
+    playerSprite = *sheet;
+  } else {
     Logger::info("Player sprite sheet not found, using colored rectangles");
-    playerTexture = whitePixelTexture.get();
+    playerSprite.texture = whitePixelTexture.get();
+    playerSprite.width = playerSprite.height = 1;
   }
 
   // Load ship sprite
-  shipTexture = TextureManager::instance().get("assets/ship.png");
-  if (!shipTexture) {
+  const TextureRegion* ship =
+      TextureManager::instance().getRegion("assets/ship.png");
+  if (ship) {
+    shipSprite = *ship;
+  } else {
     Logger::info("Ship sprite not found");
   }
 
   Logger::info("RenderSystem initialized with OpenGL");
 
-  EventBus::instance().subscribe<RenderEvent>(
-      [this](const RenderEvent& e) { onRender(e); });
+  subscriptions.push_back(bus.subscribeScoped<RenderEvent>(
+      [this](const RenderEvent& e) { onRender(e); }));
 }
 
 void RenderSystem::onRender(const RenderEvent& e) {
+  OpenGLUtils::markCallSite("RenderSystem::onRender");
+
   // Skip game world rendering during title screen and character select
   GameState currentState = GameStateManager::instance().getCurrentState();
   if (currentState == GameState::TitleScreen ||
@@ -91,148 +102,74 @@ void RenderSystem::onRender(const RenderEvent& e) {
   }
 
   SDL_Window* sdlWindow = window->getWindow();
+  spriteRenderer->resetStats();
 
   const Player& localPlayer = clientPrediction->getLocalPlayer();
-  camera->follow(localPlayer.x, localPlayer.y);
+  camera->follow(clientPrediction->getRenderX(),
+                 clientPrediction->getRenderY());
 
   // Clear the screen with OpenGL
   glClearColor(0.0f, 0.0f, 0.0f, 1.0f);  // Black background
   glClear(GL_COLOR_BUFFER_BIT);
 
-  // Gather all players
-  std::vector<Player> allPlayers;
-
-  // Add local player if alive
-  if (localPlayer.isAlive()) {
-    allPlayers.push_back(localPlayer);
-  }
-
-  auto remotePlayerIds = remoteInterpolation->getRemotePlayerIds();
-  for (uint32_t playerId : remotePlayerIds) {
-    Player remotePlayer;
-    if (remoteInterpolation->getInterpolatedState(playerId, e.interpolation,
-                                                  remotePlayer)) {
-      // Skip dead players
-      if (remotePlayer.isDead()) {
-        continue;
-      }
-      allPlayers.push_back(remotePlayer);
-    }
-  }
-
-  // Gather all enemies (with frustum culling for performance)
-  std::vector<Enemy> allEnemies;
-  if (enemyInterpolation) {
-    auto enemyIds = enemyInterpolation->getEnemyIds();
-
-    for (uint32_t enemyId : enemyIds) {
-      Enemy enemy;
-      if (enemyInterpolation->getInterpolatedState(enemyId, e.interpolation,
-                                                   enemy)) {
-        // Skip dead enemies
-        if (enemy.state == ::EnemyState::Dead) {
-          continue;
-        }
-
-        // Frustum culling: Check if enemy is potentially visible on screen
-        // Use generous bounds to account for isometric projection
-        int screenX, screenY;
-        camera->worldToScreen(enemy.x, enemy.y, screenX, screenY);
-
-        // Cull enemies far off-screen (beyond 200px margin)
-        if (screenX < -200 || screenX > Config::Screen::WIDTH + 200 ||
-            screenY < -200 || screenY > Config::Screen::HEIGHT + 200) {
-          continue;
-        }
-
-        allEnemies.push_back(enemy);
-      }
-    }
-  }
+  gatherRenderItems(localPlayer);
 
   // Fixed world position for the ship
   constexpr float SHIP_WORLD_X = 400.0f;
   constexpr float SHIP_WORLD_Y = 300.0f;
-
-  // Collect all entities with their depths for sorting
-  struct EntityToRender {
-    float depth;
-    enum Type { Player, Enemy, WorldItem, Ship } type;
-    union {
-      const ::Player* player;
-      const ::Enemy* enemy;
-      const ::WorldItem* worldItem;
-      struct {
-        float x, y;
-      } shipPos;
-    };
-  };
-
-  // Get world items from client prediction
-  const auto& worldItems = clientPrediction->getWorldItems();
-
-  std::vector<EntityToRender> entitiesToRender;
-  entitiesToRender.reserve(allPlayers.size() + allEnemies.size() +
-                           worldItems.size() + 1);
-
-  for (const Player& player : allPlayers) {
-    EntityToRender entity;
-    entity.depth = player.x + player.y;
-    entity.type = EntityToRender::Player;
-    entity.player = &player;
-    entitiesToRender.push_back(entity);
-  }
-
-  for (const Enemy& enemy : allEnemies) {
-    EntityToRender entity;
-    entity.depth = enemy.x + enemy.y;
-    entity.type = EntityToRender::Enemy;
-    entity.enemy = &enemy;
-    entitiesToRender.push_back(entity);
-  }
-
-  for (const auto& [id, worldItem] : worldItems) {
-    EntityToRender entity;
-    entity.depth = worldItem.x + worldItem.y;
-    entity.type = EntityToRender::WorldItem;
-    entity.worldItem = &worldItem;
-    entitiesToRender.push_back(entity);
-  }
-
   {
-    EntityToRender entity;
-    entity.depth = SHIP_WORLD_X + SHIP_WORLD_Y;
-    entity.type = EntityToRender::Ship;
-    entity.shipPos = {SHIP_WORLD_X, SHIP_WORLD_Y};
-    entitiesToRender.push_back(entity);
+    RenderItem ship{};
+    ship.depth = SHIP_WORLD_X + SHIP_WORLD_Y;
+    ship.kind = RenderItem::Ship;
+    camera->worldToScreen(SHIP_WORLD_X, SHIP_WORLD_Y, ship.screenX,
+                          ship.screenY);
+    renderItems.push_back(ship);
   }
 
   // Sort by depth (back to front for painter's algorithm)
-  std::sort(entitiesToRender.begin(), entitiesToRender.end(),
-            [](const EntityToRender& a, const EntityToRender& b) {
-              return a.depth < b.depth;
-            });
+  radixSort(renderItems, sortScratch,
+            [](const RenderItem& item) { return radixKeyFromFloat(item.depth); });
 
-  // Render tiles first, then all entities in depth order (single callback)
+  // Get world items from client prediction
+  const auto& worldItems = clientPrediction->getWorldItems();
+
+  // Sprites are batched into depth bands and drawn as a handful of instanced
+  // draws, however many entities are on screen
   tileRenderer->render(*tiledMap, [&](float minDepth, float maxDepth) {
-    // Draw objective zones first (as ground markers)
+    spriteRenderer->beginBatch();
+
+    // Ground band: objective zones and dropped items
     const auto& objectives = clientPrediction->getObjectives();
     for (const auto& [id, objective] : objectives) {
       drawObjective(objective);
     }
+    for (const auto& [id, worldItem] : worldItems) {
+      drawWorldItem(worldItem);
+    }
+
+    // Character band in sorted order. Players and enemies share one sprite
+    // sheet; the ship gets a band of its own so it occludes correctly.
+    spriteRenderer->nextBand();
+    for (const RenderItem& item : renderItems) {
+      if (item.kind == RenderItem::Ship) {
+        spriteRenderer->nextBand();
+        drawShip(item);
+        spriteRenderer->nextBand();
+      } else {
+        drawCharacter(item);
+      }
+    }
 
-    // Render all entities in sorted order
-    for (const auto& entity : entitiesToRender) {
-      if (entity.type == EntityToRender::Player) {
-        drawPlayer(*entity.player);
-      } else if (entity.type == EntityToRender::Enemy) {
-        drawEnemy(*entity.enemy);
-      } else if (entity.type == EntityToRender::WorldItem) {
-        drawWorldItem(*entity.worldItem);
-      } else if (entity.type == EntityToRender::Ship) {
-        drawShip(entity.shipPos.x, entity.shipPos.y);
+    // Overlay band: health bars stay readable over every sprite
+    spriteRenderer->nextBand();
+    for (const RenderItem& item : renderItems) {
+      if (item.kind != RenderItem::Ship) {
+        drawHealthBar(item.screenX, item.screenY + item.healthBarOffsetY,
+                      item.health, item.maxHealth);
       }
     }
+
+    spriteRenderer->endBatch();
   });
 
   // Render music zone debug overlay (if enabled)
@@ -256,67 +193,104 @@ void RenderSystem::onRender(const RenderEvent& e) {
   }
 
   // NOTE: Buffer swap moved to GameLoop to ensure UI renders after game world
-  OpenGLUtils::checkGLError("RenderSystem::onRender");
 }
 
-void RenderSystem::drawPlayer(const Player& player) {
-  int screenX, screenY;
-  camera->worldToScreen(player.x, player.y, screenX, screenY);
-
-  if (playerTexture) {
-    // If using actual sprite, render without color tint
-    // If using white pixel fallback, tint with player color
-    bool isPlaceholder = (playerTexture == whitePixelTexture.get());
-
-    float r = isPlaceholder ? player.r / 255.0f : 1.0f;
-    float g = isPlaceholder ? player.g / 255.0f : 1.0f;
-    float b = isPlaceholder ? player.b / 255.0f : 1.0f;
-
-    // Use animation frame if animation controller exists
-    const AnimationController* controller = player.getAnimationController();
-    if (controller && !isPlaceholder) {
-      int srcX, srcY, srcW, srcH;
-      controller->getCurrentFrame(srcX, srcY, srcW, srcH);
-
-      spriteRenderer->drawRegion(
-          *playerTexture, screenX - Config::Player::SIZE / 2.0f,
-          screenY - Config::Player::SIZE / 2.0f, Config::Player::SIZE,
-          Config::Player::SIZE, srcX, srcY, srcW, srcH, r, g, b, 1.0f);
+void RenderSystem::gatherRenderItems(const Player& localPlayer) {
+  renderItems.clear();
+  bool isPlaceholder = (playerSprite.texture == whitePixelTexture.get());
+
+  // Players: sprite sheet frame, or a tinted square for the placeholder
+  auto addPlayer = [&](float x, float y, float health, uint8_t r, uint8_t g,
+                       uint8_t b, const AnimationController* animation) {
+    RenderItem item{};
+    item.kind = RenderItem::Character;
+    item.depth = x + y;
+    camera->worldToScreen(x, y, item.screenX, item.screenY);
+    if (isPlaceholder) {
+      item.r = r / 255.0f;
+      item.g = g / 255.0f;
+      item.b = b / 255.0f;
     } else {
-      // Fallback to full sprite (for placeholder or if no animation)
-      spriteRenderer->draw(
-          *playerTexture, screenX - Config::Player::SIZE / 2.0f,
-          screenY - Config::Player::SIZE / 2.0f, Config::Player::SIZE,
-          Config::Player::SIZE, r, g, b, 1.0f);
+      item.r = item.g = item.b = 1.0f;
+      if (animation) {
+        animation->getCurrentFrame(item.srcX, item.srcY, item.srcW,
+                                   item.srcH);
+      }
     }
+    item.health = health;
+    item.maxHealth = Config::Player::MAX_HEALTH;
+    item.healthBarOffsetY = -Config::Player::SIZE / 2.0f - 10;
+    renderItems.push_back(item);
+  };
+
+  if (localPlayer.isAlive()) {
+    addPlayer(clientPrediction->getRenderX(), clientPrediction->getRenderY(),
+              localPlayer.health, localPlayer.r, localPlayer.g, localPlayer.b,
+              localPlayer.getAnimationController());
   }
 
-  // Render health bar above player
-  drawHealthBar(screenX, screenY - Config::Player::SIZE / 2.0f - 10,
-                player.health, Config::Player::MAX_HEALTH);
-}
+  remoteStates.clear();
+  remoteInterpolation->appendRenderStates(remoteInterpolation->getRenderTick(),
+                                         remoteStates);
+  for (const RemotePlayerRenderState& remote : remoteStates) {
+    // Skip dead players
+    if (remote.health <= 0.0f) continue;
+    addPlayer(remote.x, remote.y, remote.health, remote.r, remote.g, remote.b,
+              remote.animation);
+  }
 
-void RenderSystem::drawEnemy(const Enemy& enemy) {
-  int screenX, screenY;
-  camera->worldToScreen(enemy.x, enemy.y, screenX, screenY);
-
-  // Render enemy sprite (POC: use player sprite with red tint)
-  const AnimationController* controller = enemy.getAnimationController();
-  if (controller && playerTexture) {
-    int srcX, srcY, srcW, srcH;
-    controller->getCurrentFrame(srcX, srcY, srcW, srcH);
-
-    // Red tint for enemies
-    spriteRenderer->drawRegion(
-        *playerTexture, screenX - Config::Player::SIZE / 2.0f,
-        screenY - Config::Player::SIZE / 2.0f, Config::Player::SIZE,
-        Config::Player::SIZE, srcX, srcY, srcW, srcH, 1.0f, 0.3f, 0.3f,
-        1.0f  // Red tint (R=1.0, G=0.3, B=0.3)
-    );
+  if (!enemyInterpolation) return;
+
+  enemyStates.clear();
+  enemyInterpolation->appendRenderStates(enemyInterpolation->getRenderTick(),
+                                        enemyStates);
+  for (const EnemyRenderState& enemy : enemyStates) {
+    // Skip dead enemies, and enemies without a sprite to draw
+    if (enemy.state == ::EnemyState::Dead || !enemy.animation) continue;
+
+    RenderItem item{};
+    item.kind = RenderItem::Character;
+    item.depth = enemy.x + enemy.y;
+    camera->worldToScreen(enemy.x, enemy.y, item.screenX, item.screenY);
+
+    // Frustum culling: cull enemies far off-screen (beyond 200px margin)
+    if (item.screenX < -200 || item.screenX > Config::Screen::WIDTH + 200 ||
+        item.screenY < -200 || item.screenY > Config::Screen::HEIGHT + 200) {
+      continue;
+    }
+
+    // POC: enemies use the player sprite with a red tint
+    enemy.animation->getCurrentFrame(item.srcX, item.srcY, item.srcW,
+                                     item.srcH);
+    item.r = 1.0f;
+    item.g = 0.3f;
+    item.b = 0.3f;
+    item.health = enemy.health;
+    item.maxHealth = enemy.maxHealth;
+    item.healthBarOffsetY = -20.0f;
+    renderItems.push_back(item);
   }
+}
 
-  // Render health bar
-  drawHealthBar(screenX, screenY - 20, enemy.health, enemy.maxHealth);
+void RenderSystem::drawCharacter(const RenderItem& item) {
+  float x = item.screenX - Config::Player::SIZE / 2.0f;
+  float y = item.screenY - Config::Player::SIZE / 2.0f;
+
+  if (item.srcW > 0) {
+    // Animation frames are relative to the sheet's slot in the atlas
+    spriteRenderer->drawRegion(*playerSprite.texture, x, y,
+                               Config::Player::SIZE, Config::Player::SIZE,
+                               playerSprite.x + item.srcX,
+                               playerSprite.y + item.srcY, item.srcW,
+                               item.srcH, item.r, item.g, item.b, 1.0f);
+  } else {
+    // Placeholder texture or no animation: whole sheet
+    spriteRenderer->drawRegion(*playerSprite.texture, x, y,
+                               Config::Player::SIZE, Config::Player::SIZE,
+                               playerSprite.x, playerSprite.y,
+                               playerSprite.width, playerSprite.height, item.r,
+                               item.g, item.b, 1.0f);
+  }
 }
 
 void RenderSystem::drawWorldItem(const WorldItem& worldItem) {
@@ -333,18 +307,17 @@ void RenderSystem::drawWorldItem(const WorldItem& worldItem) {
                        ITEM_SIZE, color.r, color.g, color.b, color.a);
 }
 
-void RenderSystem::drawShip(float worldX, float worldY) {
-  if (!shipTexture) return;
-
-  int screenX, screenY;
-  camera->worldToScreen(worldX, worldY, screenX, screenY);
+void RenderSystem::drawShip(const RenderItem& item) {
+  if (!shipSprite.texture) return;
 
   constexpr float SHIP_W = 96.0f;
   constexpr float SHIP_H = 96.0f;
 
-  spriteRenderer->draw(*shipTexture, static_cast<float>(screenX) - SHIP_W / 2,
-                       static_cast<float>(screenY) - SHIP_H / 2, SHIP_W,
-                       SHIP_H, 1.0f, 1.0f, 1.0f, 1.0f);
+  spriteRenderer->drawRegion(
+      *shipSprite.texture, static_cast<float>(item.screenX) - SHIP_W / 2,
+      static_cast<float>(item.screenY) - SHIP_H / 2, SHIP_W, SHIP_H,
+      shipSprite.x, shipSprite.y, shipSprite.width, shipSprite.height, 1.0f,
+      1.0f, 1.0f, 1.0f);
 }
 
 void RenderSystem::drawHealthBar(int x, int y, float health, float maxHealth) {
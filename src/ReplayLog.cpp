@@ -0,0 +1,246 @@
+#include "ReplayLog.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iterator>
+
+#include "Logger.h"
+
+namespace {
+
+constexpr char MAGIC[4] = {'G', 'R', 'P', 'L'};
+constexpr uint16_t VERSION = 1;
+
+void putU16(std::vector<uint8_t>& out, uint16_t value) {
+  out.push_back(static_cast<uint8_t>(value));
+  out.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+void putU32(std::vector<uint8_t>& out, uint32_t value) {
+  for (int i = 0; i < 4; ++i) {
+    out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+void putVarint(std::vector<uint8_t>& out, uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+bool getVarint(const std::vector<uint8_t>& in, size_t& offset,
+               uint64_t& value) {
+  value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    if (offset >= in.size()) return false;
+    uint8_t byte = in[offset++];
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+ReplayWriter::~ReplayWriter() {
+  // A writer dropped without close() still leaves a readable log
+  if (isOpen()) {
+    flush();
+    file.close();
+  }
+}
+
+bool ReplayWriter::open(const std::string& path, uint32_t rngSeed,
+                        const std::string& mapPath) {
+  assert(!isOpen() && "ReplayWriter already open");
+  assert(mapPath.size() <= UINT16_MAX && "Map path too long for replay log");
+
+  file.open(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    Logger::error("ReplayWriter: Failed to open " + path);
+    return false;
+  }
+
+  buffer.clear();
+  buffer.reserve(FLUSH_THRESHOLD * 2);
+  buffer.insert(buffer.end(), std::begin(MAGIC), std::end(MAGIC));
+  putU16(buffer, VERSION);
+  putU32(buffer, rngSeed);
+  putU16(buffer, static_cast<uint16_t>(mapPath.size()));
+  buffer.insert(buffer.end(), mapPath.begin(), mapPath.end());
+
+  lastTick = 0;
+  bytesWritten = 0;
+  return true;
+}
+
+void ReplayWriter::write(ReplayRecordKind kind, uint64_t tick,
+                         uint32_t clientId, const uint8_t* data,
+                         size_t size) {
+  assert(isOpen() && "ReplayWriter::write before open");
+  assert(tick >= lastTick && "Replay records must be in tick order");
+
+  buffer.push_back(static_cast<uint8_t>(kind));
+  putVarint(buffer, tick - lastTick);
+  putVarint(buffer, clientId);
+  if (kind == ReplayRecordKind::Packet) {
+    putVarint(buffer, size);
+    buffer.insert(buffer.end(), data, data + size);
+  }
+  lastTick = tick;
+
+  if (buffer.size() >= FLUSH_THRESHOLD) {
+    flush();
+  }
+}
+
+void ReplayWriter::close(uint64_t tickCount) {
+  if (!isOpen()) return;
+
+  write(ReplayRecordKind::End, std::max(tickCount, lastTick), 0);
+  flush();
+  file.close();
+}
+
+void ReplayWriter::flush() {
+  if (buffer.empty()) return;
+  file.write(reinterpret_cast<const char*>(buffer.data()),
+             static_cast<std::streamsize>(buffer.size()));
+  bytesWritten += buffer.size();
+  buffer.clear();
+}
+
+bool ReplayReader::open(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    Logger::error("ReplayReader: Failed to open " + path);
+    return false;
+  }
+  std::vector<uint8_t> contents((std::istreambuf_iterator<char>(file)),
+                                std::istreambuf_iterator<char>());
+  return openFromMemory(std::move(contents));
+}
+
+bool ReplayReader::openFromMemory(std::vector<uint8_t> contents) {
+  bytes = std::move(contents);
+  tickCount = 0;
+  recordCount = 0;
+
+  if (!parseHeader()) {
+    Logger::error("ReplayReader: Not a replay log (bad header)");
+    return false;
+  }
+
+  // Validate every record now so playback never meets a torn log midway
+  size_t offset = recordsOffset;
+  uint64_t tick = 0;
+  bool sawEnd = false;
+  while (offset < bytes.size()) {
+    ReplayRecord record;
+    size_t recordStart = offset;  // parseRecord advances even on failure
+    if (!parseRecord(offset, tick, record)) {
+      Logger::error("ReplayReader: Truncated record at byte " +
+                    std::to_string(recordStart) + ", ignoring the rest");
+      bytes.resize(recordStart);
+      break;
+    }
+    if (record.kind == ReplayRecordKind::End) {
+      tickCount = record.tick;
+      sawEnd = true;
+      break;
+    }
+    recordCount++;
+    tickCount = record.tick + 1;
+  }
+  if (!sawEnd) {
+    Logger::info("ReplayReader: Log has no End record (server stopped "
+                 "abruptly?); replaying " +
+                 std::to_string(tickCount) + " ticks");
+  }
+
+  rewind();
+  return true;
+}
+
+bool ReplayReader::parseHeader() {
+  constexpr size_t fixedSize = sizeof(MAGIC) + 2 + 4 + 2;
+  if (bytes.size() < fixedSize ||
+      std::memcmp(bytes.data(), MAGIC, sizeof(MAGIC)) != 0) {
+    return false;
+  }
+
+  const uint8_t* p = bytes.data() + sizeof(MAGIC);
+  uint16_t version = static_cast<uint16_t>(p[0] | (p[1] << 8));
+  if (version != VERSION) {
+    Logger::error("ReplayReader: Unsupported version " +
+                  std::to_string(version));
+    return false;
+  }
+  rngSeed = static_cast<uint32_t>(p[2]) | (static_cast<uint32_t>(p[3]) << 8) |
+            (static_cast<uint32_t>(p[4]) << 16) |
+            (static_cast<uint32_t>(p[5]) << 24);
+  uint16_t mapPathLength = static_cast<uint16_t>(p[6] | (p[7] << 8));
+
+  if (bytes.size() < fixedSize + mapPathLength) return false;
+  mapPath.assign(reinterpret_cast<const char*>(bytes.data() + fixedSize),
+                 mapPathLength);
+  recordsOffset = fixedSize + mapPathLength;
+  return true;
+}
+
+bool ReplayReader::parseRecord(size_t& offset, uint64_t& tick,
+                               ReplayRecord& record) const {
+  if (offset >= bytes.size()) return false;
+
+  uint8_t kind = bytes[offset++];
+  if (kind < static_cast<uint8_t>(ReplayRecordKind::Connect) ||
+      kind > static_cast<uint8_t>(ReplayRecordKind::End)) {
+    return false;
+  }
+
+  uint64_t tickDelta = 0;
+  uint64_t clientId = 0;
+  if (!getVarint(bytes, offset, tickDelta) ||
+      !getVarint(bytes, offset, clientId)) {
+    return false;
+  }
+
+  record.kind = static_cast<ReplayRecordKind>(kind);
+  record.tick = tick + tickDelta;
+  record.clientId = static_cast<uint32_t>(clientId);
+  record.data = nullptr;
+  record.size = 0;
+
+  if (record.kind == ReplayRecordKind::Packet) {
+    uint64_t size = 0;
+    if (!getVarint(bytes, offset, size) || size > bytes.size() - offset) {
+      return false;
+    }
+    record.data = bytes.data() + offset;
+    record.size = static_cast<size_t>(size);
+    offset += record.size;
+  }
+
+  tick = record.tick;
+  return true;
+}
+
+bool ReplayReader::next(ReplayRecord& record) {
+  size_t offset = cursor;
+  uint64_t tick = cursorTick;
+  if (!parseRecord(offset, tick, record) ||
+      record.kind == ReplayRecordKind::End) {
+    return false;
+  }
+  cursor = offset;
+  cursorTick = tick;
+  return true;
+}
+
+void ReplayReader::rewind() {
+  cursor = recordsOffset;
+  cursorTick = 0;
+}
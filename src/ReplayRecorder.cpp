@@ -0,0 +1,61 @@
+#include "ReplayRecorder.h"
+
+#include "Logger.h"
+
+ReplayRecorder::ReplayRecorder(EventBus& bus) : bus(bus) {}
+
+ReplayRecorder::~ReplayRecorder() { stop(); }
+
+bool ReplayRecorder::start(const std::string& path, uint32_t rngSeed,
+                           const std::string& mapPath) {
+  if (!writer.open(path, rngSeed, mapPath)) {
+    return false;
+  }
+
+  subscriptions.push_back(bus.subscribeScoped<UpdateEvent>(
+      [this](const UpdateEvent& e) { onUpdate(e); }));
+  subscriptions.push_back(bus.subscribeScoped<ClientConnectedEvent>(
+      [this](const ClientConnectedEvent& e) { onClientConnected(e); }));
+  subscriptions.push_back(bus.subscribeScoped<ClientDisconnectedEvent>(
+      [this](const ClientDisconnectedEvent& e) { onClientDisconnected(e); }));
+  subscriptions.push_back(bus.subscribeScoped<NetworkPacketReceivedEvent>(
+      [this](const NetworkPacketReceivedEvent& e) {
+        onNetworkPacketReceived(e);
+      }));
+
+  Logger::info("Recording replay to " + path + " (seed " +
+               std::to_string(rngSeed) + ")");
+  return true;
+}
+
+void ReplayRecorder::stop() {
+  if (!writer.isOpen()) return;
+
+  subscriptions.clear();
+  writer.close(ticksSeen);
+  Logger::info("Replay closed: " + std::to_string(ticksSeen) + " ticks, " +
+               std::to_string(recordCount) + " records, " +
+               std::to_string(writer.getBytesWritten()) + " bytes");
+}
+
+void ReplayRecorder::onUpdate(const UpdateEvent& e) {
+  currentTick = e.frameNumber;
+  ticksSeen = currentTick + 1;
+}
+
+void ReplayRecorder::onClientConnected(const ClientConnectedEvent& e) {
+  writer.write(ReplayRecordKind::Connect, currentTick, e.clientId);
+  recordCount++;
+}
+
+void ReplayRecorder::onClientDisconnected(const ClientDisconnectedEvent& e) {
+  writer.write(ReplayRecordKind::Disconnect, currentTick, e.clientId);
+  recordCount++;
+}
+
+void ReplayRecorder::onNetworkPacketReceived(
+    const NetworkPacketReceivedEvent& e) {
+  writer.write(ReplayRecordKind::Packet, currentTick, e.clientId, e.data,
+               e.size);
+  recordCount++;
+}
@@ -0,0 +1,31 @@
+#include "ServerClock.h"
+
+#include <chrono>
+#include <cmath>
+
+ServerClock::ServerClock(float tickMs, float delayMs)
+    : tickMs(tickMs), delayMs(delayMs) {}
+
+void ServerClock::observe(uint32_t serverTick, double nowMs) {
+  double sampleMs = serverTick * static_cast<double>(tickMs) - nowMs;
+  if (!synced || std::abs(sampleMs - offsetMs) > RESYNC_MS) {
+    offsetMs = sampleMs;
+    synced = true;
+    return;
+  }
+  offsetMs += (sampleMs - offsetMs) * SMOOTHING;
+}
+
+double ServerClock::getServerTick(double nowMs) const {
+  return (nowMs + offsetMs) / tickMs;
+}
+
+double ServerClock::getRenderTick(double nowMs) const {
+  return (nowMs + offsetMs - delayMs) / tickMs;
+}
+
+double ServerClock::nowMs() {
+  using namespace std::chrono;
+  return duration<double, std::milli>(steady_clock::now().time_since_epoch())
+      .count();
+}
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cmath>
 #include <limits>
 
@@ -9,21 +10,48 @@
 #include "EnemySystem.h"
 #include "ItemRegistry.h"
 #include "Logger.h"
+#include "Metrics.h"
 #include "NetworkServer.h"
 #include "TiledMap.h"
 #include "config/GameplayConfig.h"
 #include "config/PlayerConfig.h"
 #include "config/TimingConfig.h"
 
+namespace {
+
+// Milliseconds since `since`, which is moved up to now
+float lapMs(std::chrono::steady_clock::time_point& since) {
+  auto now = std::chrono::steady_clock::now();
+  float ms = std::chrono::duration<float, std::milli>(now - since).count();
+  since = now;
+  return ms;
+}
+
+}  // namespace
+
 ServerGameState::ServerGameState(NetworkServer* server,
-                                 const WorldConfig& world)
+                                 const WorldConfig& world, EventBus& bus,
+                                 uint32_t rngSeed)
     : server(server),
+      bus(bus),
+      rngSeed(rngSeed),
       worldWidth(world.width),
       worldHeight(world.height),
       collisionSystem(world.collisionSystem),
       playerSpawns(nullptr),
       serverTick(0),
       nextWorldItemId(1) {
+  MetricsRegistry& metrics = MetricsRegistry::instance();
+  tickDuration = &metrics.histogram(
+      "gambit_tick_duration_ms", "Time to simulate one match tick",
+      {0.5, 1.0, 2.0, 4.0, 8.0, Config::Timing::TARGET_DELTA_MS,
+       Config::Timing::MAX_FRAME_TIME_MS});
+  tickOverruns = &metrics.counter(
+      "gambit_tick_overruns_total",
+      "Match ticks that took longer than the tick budget");
+  connectedPlayers =
+      &metrics.gauge("gambit_players", "Players connected to a match");
+
   // Initialize player spawns
   if (world.tiledMap != nullptr && !world.tiledMap->getPlayerSpawns().empty()) {
     playerSpawns = &world.tiledMap->getPlayerSpawns();
@@ -32,14 +60,18 @@ ServerGameState::ServerGameState(NetworkServer* server,
   }
 
   // Initialize enemy system
-  if (world.tiledMap != nullptr) {
-    enemySystem =
-        std::make_unique<EnemySystem>(world.tiledMap->getEnemySpawns());
+  const std::vector<EnemySpawn>* enemySpawns = world.enemySpawns;
+  if (enemySpawns == nullptr && world.tiledMap != nullptr) {
+    enemySpawns = &world.tiledMap->getEnemySpawns();
+  }
+  if (enemySpawns != nullptr) {
+    enemySystem = std::make_unique<EnemySystem>(*enemySpawns, bus, rngSeed);
     enemySystem->spawnAllEnemies();
   }
 
   // Initialize effect manager
-  effectManager = std::make_unique<EffectManager>();
+  // Distinct stream from the enemy system's
+  effectManager = std::make_unique<EffectManager>(rngSeed ^ 0x9E3779B9u);
   Logger::info("EffectManager initialized");
 
   // Load ship position from map
@@ -183,21 +215,40 @@ ServerGameState::ServerGameState(NetworkServer* server,
   }
 
   // Subscribe to client connection events
-  EventBus::instance().subscribe<ClientConnectedEvent>(
-      [this](const ClientConnectedEvent& e) { onClientConnected(e); });
+  subscriptions.push_back(bus.subscribeScoped<ClientConnectedEvent>(
+      [this](const ClientConnectedEvent& e) { onClientConnected(e); }));
 
-  EventBus::instance().subscribe<ClientDisconnectedEvent>(
-      [this](const ClientDisconnectedEvent& e) { onClientDisconnected(e); });
+  subscriptions.push_back(bus.subscribeScoped<ClientDisconnectedEvent>(
+      [this](const ClientDisconnectedEvent& e) { onClientDisconnected(e); }));
 
   // Subscribe to network packet events
-  EventBus::instance().subscribe<NetworkPacketReceivedEvent>(
+  subscriptions.push_back(bus.subscribeScoped<NetworkPacketReceivedEvent>(
       [this](const NetworkPacketReceivedEvent& e) {
         onNetworkPacketReceived(e);
-      });
+      }));
+
+  // Decoded inputs and attacks, drained in batches at
+  // EventPhase::AfterNetworkReceive once NetworkServer::poll has read them all
+  subscriptions.push_back(bus.subscribeBatchScoped<ClientInputReceivedEvent>(
+      [this](EventSpan<ClientInputReceivedEvent> inputs) {
+        onClientInputs(inputs);
+      }));
+
+  subscriptions.push_back(bus.subscribeBatchScoped<AttackReceivedEvent>(
+      [this](EventSpan<AttackReceivedEvent> attacks) { onAttacks(attacks); }));
 
   // Subscribe to update events
-  EventBus::instance().subscribe<UpdateEvent>(
-      [this](const UpdateEvent& e) { onUpdate(e); });
+  subscriptions.push_back(bus.subscribeScoped<UpdateEvent>(
+      [this](const UpdateEvent& e) { onUpdate(e); }));
+
+  // Queued server events, drained in batches at EventPhase::AfterSimulation
+  subscriptions.push_back(bus.subscribeBatchScoped<EnemyDiedEvent>(
+      [this](EventSpan<EnemyDiedEvent> deaths) { onEnemiesDied(deaths); }));
+
+  subscriptions.push_back(bus.subscribeBatchScoped<ObjectiveRangeExitedEvent>(
+      [this](EventSpan<ObjectiveRangeExitedEvent> exits) {
+        onObjectiveRangesExited(exits);
+      }));
 
   // Link LittleJohn guardian enemies now that both systems are initialized
   if (objectiveSystem && enemySystem) {
@@ -205,7 +256,10 @@ ServerGameState::ServerGameState(NetworkServer* server,
   }
 }
 
-ServerGameState::~ServerGameState() = default;
+ServerGameState::~ServerGameState() {
+  // A finished match takes its players off the shared gauge
+  connectedPlayers->add(-static_cast<double>(players.size()));
+}
 
 void ServerGameState::onClientConnected(const ClientConnectedEvent& e) {
   uint32_t playerId = e.clientId;
@@ -214,6 +268,7 @@ void ServerGameState::onClientConnected(const ClientConnectedEvent& e) {
   assignPlayerColor(player, players.size());
 
   players[playerId] = player;
+  connectedPlayers->add(1);
 
   Logger::info("Player " + std::to_string(playerId) + " joined");
 
@@ -261,7 +316,7 @@ void ServerGameState::onClientConnected(const ClientConnectedEvent& e) {
 void ServerGameState::onClientDisconnected(const ClientDisconnectedEvent& e) {
   uint32_t playerId = e.clientId;
 
-  players.erase(playerId);
+  if (players.erase(playerId) > 0) connectedPlayers->add(-1);
 
   Logger::info("Player " + std::to_string(playerId) + " left");
 
@@ -276,16 +331,18 @@ void ServerGameState::onNetworkPacketReceived(
     const NetworkPacketReceivedEvent& e) {
   if (e.size == 0) return;
 
-  // In embedded mode, server and client share the same EventBus.
-  // Skip client-side events (clientId == 0) — only process real client messages.
-  if (e.clientId == 0) return;
-
   PacketType type = static_cast<PacketType>(e.data[0]);
 
   switch (type) {
-    case PacketType::ClientInput:
-      processClientInput(e.clientId, e.data, e.size);
+    case PacketType::ClientInput: {
+      ClientInputPacket input = deserializeClientInput(e.data, e.size);
+      bus.enqueue(
+          ClientInputReceivedEvent{e.clientId, input.inputSequence,
+                                   input.moveLeft, input.moveRight,
+                                   input.moveUp, input.moveDown},
+          EventPhase::AfterNetworkReceive);
       break;
+    }
 
     case PacketType::AttackEnemy: {
       if (e.size < 9) {
@@ -294,134 +351,9 @@ void ServerGameState::onNetworkPacketReceived(
       }
 
       AttackEnemyPacket attackPacket = deserializeAttackEnemy(e.data, e.size);
-
-      uint32_t playerId = e.clientId;
-
-      // Apply damage (server-authoritative)
-      if (enemySystem && effectManager) {
-        // Calculate modified damage based on player and enemy effects
-        float damage = attackPacket.damage;
-
-        // Apply player's damage dealt modifiers (Empowered/Weakened)
-        auto playerMods = effectManager->calculateModifiers(playerId, false);
-        damage *= playerMods.damageDealtMultiplier;
-
-        // Apply enemy's damage taken modifiers and consume Expose/Guard
-        effectManager->consumeOnDamage(attackPacket.enemyId, true, damage);
-
-        Logger::debug("Attack damage: " + std::to_string(attackPacket.damage) +
-                      " → modified: " + std::to_string(damage) +
-                      " (player mult: " +
-                      std::to_string(playerMods.damageDealtMultiplier) + ")");
-
-        // Apply final damage
-        enemySystem->damageEnemy(attackPacket.enemyId, damage, playerId);
-
-        // Apply effect based on character selection
-        if (true) {
-          auto playerIt = players.find(playerId);
-          if (playerIt != players.end()) {
-            uint32_t characterId = playerIt->second.characterId;
-            EffectType effectToApply;
-            const char* effectName;
-
-            // Map character IDs to effects (testing multiple effects)
-            // Character IDs 1-19, map to different effects
-            switch (characterId) {
-              case 1:  // Eliana
-                effectToApply = EffectType::Slow;
-                effectName = "Slow";
-                break;
-              case 2:  // Fagan
-                effectToApply = EffectType::Weakened;
-                effectName = "Weakened";
-                break;
-              case 3:  // Gravon
-                effectToApply = EffectType::Vulnerable;
-                effectName = "Vulnerable";
-                break;
-              case 4:  // Isaac
-                effectToApply = EffectType::Wound;
-                effectName = "Wound (DoT)";
-                break;
-              case 5:  // Jeff
-                effectToApply = EffectType::Haste;
-                effectName = "Haste";
-                break;
-              case 6:  // Kade
-                effectToApply = EffectType::Empowered;
-                effectName = "Empowered";
-                break;
-              case 7:  // Lilith
-                effectToApply = EffectType::Fortified;
-                effectName = "Fortified";
-                break;
-              case 8:  // MILES
-                effectToApply = EffectType::Mend;
-                effectName = "Mend (HoT)";
-                break;
-              case 9:  // Mina
-                effectToApply = EffectType::Cursed;
-                effectName = "Cursed";
-                break;
-              case 10:  // Mordryn
-                effectToApply = EffectType::Blessed;
-                effectName = "Blessed";
-                break;
-              case 11:  // Namora
-                effectToApply = EffectType::Marked;
-                effectName = "Marked";
-                break;
-              case 12:  // Nolan
-                effectToApply = EffectType::Stealth;
-                effectName = "Stealth";
-                break;
-              case 13:  // Nyx
-                effectToApply = EffectType::Expose;
-                effectName = "Expose";
-                break;
-              case 14:  // Presidente
-                effectToApply = EffectType::Guard;
-                effectName = "Guard";
-                break;
-              case 15:  // Stitches
-                effectToApply = EffectType::Stunned;
-                effectName = "Stunned";
-                break;
-              case 16:  // Suds
-                effectToApply = EffectType::Berserk;
-                effectName = "Berserk";
-                break;
-              case 17:  // Valthor
-                effectToApply = EffectType::Snared;
-                effectName = "Snared";
-                break;
-              case 18:  // Volgore
-                effectToApply = EffectType::Unbounded;
-                effectName = "Unbounded";
-                break;
-              case 19:  // Wade
-                effectToApply = EffectType::Confused;
-                effectName = "Confused";
-                break;
-              default:  // No character selected - use Slow
-                effectToApply = EffectType::Slow;
-                effectName = "Slow (default)";
-                break;
-            }
-
-            Logger::info("Player " + std::to_string(playerId) + " (Character " +
-                         std::to_string(characterId) + ") applying " +
-                         std::string(effectName) + " to enemy " +
-                         std::to_string(attackPacket.enemyId));
-
-            effectManager->applyEffect(attackPacket.enemyId, effectToApply, 1,
-                                       3000.0f, playerId,
-                                       enemySystem->getEnemies());
-          }
-        }
-      }
-
+      bus.enqueue(AttackReceivedEvent{e.clientId, attackPacket.enemyId,
+                                      attackPacket.damage},
+                  EventPhase::AfterNetworkReceive);
       break;
     }
 
@@ -470,13 +402,27 @@ void ServerGameState::onNetworkPacketReceived(
   }
 }
 
-void ServerGameState::processClientInput(uint32_t clientId, const uint8_t* data,
-                                         size_t size) {
-  ClientInputPacket input = deserializeClientInput(data, size);
+void ServerGameState::onClientInputs(
+    EventSpan<ClientInputReceivedEvent> inputs) {
+  for (const auto& input : inputs) {
+    processClientInput(input);
+  }
+}
 
-  uint32_t playerId = clientId;
+void ServerGameState::onAttacks(EventSpan<AttackReceivedEvent> attacks) {
+  for (const auto& attack : attacks) {
+    processAttack(attack);
+  }
+}
+
+void ServerGameState::processClientInput(
+    const ClientInputReceivedEvent& input) {
+  uint32_t playerId = input.clientId;
   auto playerIt = players.find(playerId);
-  assert(playerIt != players.end());
+  // The client may have disconnected later in the same poll
+  if (playerIt == players.end()) {
+    return;
+  }
 
   Player& player = playerIt->second;
 
@@ -508,36 +454,149 @@ void ServerGameState::processClientInput(uint32_t clientId, const uint8_t* data,
   applyInput(player, movementInput, modifiers);
 }
 
-void ServerGameState::onUpdate(const UpdateEvent& e) {
-  serverTick++;
+void ServerGameState::processAttack(const AttackReceivedEvent& attack) {
+  uint32_t playerId = attack.clientId;
+
+  // Apply damage (server-authoritative)
+  if (enemySystem && effectManager) {
+    // Calculate modified damage based on player and enemy effects
+    float damage = attack.damage;
+
+    // Apply player's damage dealt modifiers (Empowered/Weakened)
+    auto playerMods = effectManager->calculateModifiers(playerId, false);
+    damage *= playerMods.damageDealtMultiplier;
+
+    // Apply enemy's damage taken modifiers and consume Expose/Guard
+    effectManager->consumeOnDamage(attack.enemyId, true, damage);
+
+    Logger::debug(LogSubsystem::Combat,
+                  "Attack damage: {} → modified: {} (player mult: {})",
+                  attack.damage, damage, playerMods.damageDealtMultiplier);
+
+    // Apply final damage
+    enemySystem->damageEnemy(attack.enemyId, damage, playerId);
+
+    // Apply effect based on character selection
+    if (true) {
+      auto playerIt = players.find(playerId);
+      if (playerIt != players.end()) {
+        uint32_t characterId = playerIt->second.characterId;
+        EffectType effectToApply;
+        const char* effectName;
+
+        // Map character IDs to effects (testing multiple effects)
+        // Character IDs 1-19, map to different effects
+        switch (characterId) {
+          case 1:  // Eliana
+            effectToApply = EffectType::Slow;
+            effectName = "Slow";
+            break;
+          case 2:  // Fagan
+            effectToApply = EffectType::Weakened;
+            effectName = "Weakened";
+            break;
+          case 3:  // Gravon
+            effectToApply = EffectType::Vulnerable;
+            effectName = "Vulnerable";
+            break;
+          case 4:  // Isaac
+            effectToApply = EffectType::Wound;
+            effectName = "Wound (DoT)";
+            break;
+          case 5:  // Jeff
+            effectToApply = EffectType::Haste;
+            effectName = "Haste";
+            break;
+          case 6:  // Kade
+            effectToApply = EffectType::Empowered;
+            effectName = "Empowered";
+            break;
+          case 7:  // Lilith
+            effectToApply = EffectType::Fortified;
+            effectName = "Fortified";
+            break;
+          case 8:  // MILES
+            effectToApply = EffectType::Mend;
+            effectName = "Mend (HoT)";
+            break;
+          case 9:  // Mina
+            effectToApply = EffectType::Cursed;
+            effectName = "Cursed";
+            break;
+          case 10:  // Mordryn
+            effectToApply = EffectType::Blessed;
+            effectName = "Blessed";
+            break;
+          case 11:  // Namora
+            effectToApply = EffectType::Marked;
+            effectName = "Marked";
+            break;
+          case 12:  // Nolan
+            effectToApply = EffectType::Stealth;
+            effectName = "Stealth";
+            break;
+          case 13:  // Nyx
+            effectToApply = EffectType::Expose;
+            effectName = "Expose";
+            break;
+          case 14:  // Presidente
+            effectToApply = EffectType::Guard;
+            effectName = "Guard";
+            break;
+          case 15:  // Stitches
+            effectToApply = EffectType::Stunned;
+            effectName = "Stunned";
+            break;
+          case 16:  // Suds
+            effectToApply = EffectType::Berserk;
+            effectName = "Berserk";
+            break;
+          case 17:  // Valthor
+            effectToApply = EffectType::Snared;
+            effectName = "Snared";
+            break;
+          case 18:  // Volgore
+            effectToApply = EffectType::Unbounded;
+            effectName = "Unbounded";
+            break;
+          case 19:  // Wade
+            effectToApply = EffectType::Confused;
+            effectName = "Confused";
+            break;
+          default:  // No character selected - use Slow
+            effectToApply = EffectType::Slow;
+            effectName = "Slow (default)";
+            break;
+        }
 
-  // Check for enemy deaths and spawn loot (BEFORE update clears the vector)
-  checkEnemyLootDrops();
-
-  // Notify objective system about enemy deaths (for CaptureOutpost)
-  if (enemySystem && objectiveSystem) {
-    // Copy deaths vector — onEnemyDeath can trigger completeObjective which
-    // calls disableSpawnsInRadius, pushing to diedThisFrame during iteration
-    const auto deaths = enemySystem->getDiedThisFrame();
-    for (const auto& death : deaths) {
-      const auto& enemies = enemySystem->getEnemies();
-      auto enemyIt = enemies.find(death.enemyId);
-      if (enemyIt != enemies.end()) {
-        objectiveSystem->onEnemyDeath(enemyIt->second.x, enemyIt->second.y);
+        Logger::info(LogSubsystem::Combat,
+                     "Player {} (Character {}) applying {} to enemy {}",
+                     playerId, characterId, effectName, attack.enemyId);
+
+        effectManager->applyEffect(attack.enemyId, effectToApply, 1, 3000.0f,
+                                   playerId, enemySystem->getEnemies());
       }
     }
   }
+}
+
+void ServerGameState::onUpdate(const UpdateEvent& e) {
+  auto tickStart = std::chrono::steady_clock::now();
+  auto phaseStart = tickStart;
+  serverTick++;
 
   // Update enemy AI
   if (enemySystem) {
     enemySystem->update(e.deltaTime, players, effectManager.get());
   }
+  lastTickPhases.enemiesMs = lapMs(phaseStart);
 
   // Update effects (DoT/HoT, duration ticking)
   if (effectManager && enemySystem) {
     effectManager->update(e.deltaTime, players, enemySystem->getEnemies(),
                           enemySystem.get());
   }
+  lastTickPhases.effectsMs = lapMs(phaseStart);
 
   // Objective side effects: gas damage, LittleJohn activation
   if (objectiveSystem && effectManager) {
@@ -548,20 +607,25 @@ void ServerGameState::onUpdate(const UpdateEvent& e) {
   if (objectiveSystem) {
     objectiveSystem->update(e.deltaTime);
 
-    // Check if players moved out of objective range
-    auto interactions =
-        objectiveSystem->getPlayerInteractions();  // copy — stopInteraction
-                                                   // mutates
-    for (const auto& [playerId, objId] : interactions) {
+    // Queue players who moved out of objective range; stopInteraction runs
+    // in the AfterSimulation flush, after this iteration has finished
+    for (const auto& [playerId, objId] :
+         objectiveSystem->getPlayerInteractions()) {
       auto playerIt = players.find(playerId);
       const Objective* obj = objectiveSystem->getObjective(objId);
       if (playerIt != players.end() && obj) {
         if (!obj->isInRange(playerIt->second.x, playerIt->second.y)) {
-          objectiveSystem->stopInteraction(playerId);
+          bus.enqueue(ObjectiveRangeExitedEvent{playerId, objId},
+                      EventPhase::AfterSimulation);
         }
       }
     }
   }
+  lastTickPhases.objectivesMs = lapMs(phaseStart);
+
+  // Enemy deaths (from last tick's client attacks and this tick's DoT),
+  // loot drops, objective progress and range exits
+  bus.flush(EventPhase::AfterSimulation);
 
   // Check for player deaths
   checkPlayerDeaths();
@@ -569,8 +633,60 @@ void ServerGameState::onUpdate(const UpdateEvent& e) {
   // Check for player respawns
   handlePlayerRespawns();
 
+  bus.flush(EventPhase::BeforeBroadcast);
+  lastTickPhases.eventsMs = lapMs(phaseStart);
+
   // Broadcast state update every frame
   broadcastStateUpdate();
+  lastTickPhases.broadcastMs = lapMs(phaseStart);
+
+  float tickMs =
+      std::chrono::duration<float, std::milli>(phaseStart - tickStart).count();
+  tickDuration->observe(tickMs);
+  if (tickMs > Config::Timing::TARGET_DELTA_MS) tickOverruns->add();
+}
+
+void ServerGameState::onEnemiesDied(EventSpan<EnemyDiedEvent> deaths) {
+  for (const auto& death : deaths) {
+    // Simple loot table: All enemies drop Health Potion (itemId=1)
+    uint32_t lootItemId = 1;
+    spawnWorldItem(lootItemId, death.x, death.y);
+
+    Logger::info("Enemy " + std::to_string(death.enemyId) + " dropped item " +
+                 std::to_string(lootItemId));
+
+    // Notify objective system (for CaptureOutpost). This can complete an
+    // objective and call disableSpawnsInRadius, which queues more deaths;
+    // those are delivered by the same flush in a later batch.
+    if (objectiveSystem) {
+      objectiveSystem->onEnemyDeath(death.x, death.y);
+    }
+
+    EnemyDiedPacket deathPacket;
+    deathPacket.enemyId = death.enemyId;
+    deathPacket.killerId = death.killerId;
+    server->broadcastPacket(serialize(deathPacket));
+
+    Logger::debug("Broadcast EnemyDied: enemy=" +
+                  std::to_string(death.enemyId) +
+                  " killer=" + std::to_string(death.killerId));
+  }
+}
+
+void ServerGameState::onObjectiveRangesExited(
+    EventSpan<ObjectiveRangeExitedEvent> exits) {
+  if (!objectiveSystem) {
+    return;
+  }
+
+  for (const auto& exited : exits) {
+    // Skip if the interaction already ended (e.g. objective completed)
+    const auto& interactions = objectiveSystem->getPlayerInteractions();
+    auto it = interactions.find(exited.playerId);
+    if (it != interactions.end() && it->second == exited.objectiveId) {
+      objectiveSystem->stopInteraction(exited.playerId);
+    }
+  }
 }
 
 void ServerGameState::broadcastStateUpdate() {
@@ -599,6 +715,7 @@ void ServerGameState::broadcastStateUpdate() {
     const auto& enemies = enemySystem->getEnemies();
 
     EnemyStateUpdatePacket enemyPacket;
+    enemyPacket.serverTick = serverTick;
     for (const auto& [id, enemy] : enemies) {
       NetworkEnemyState state;
       state.id = enemy.id;
@@ -615,20 +732,6 @@ void ServerGameState::broadcastStateUpdate() {
     }
 
     server->broadcastPacket(serialize(enemyPacket));
-
-    // Broadcast enemy deaths
-    const auto& deaths = enemySystem->getDiedThisFrame();
-    for (const auto& death : deaths) {
-      EnemyDiedPacket deathPacket;
-      deathPacket.enemyId = death.enemyId;
-      deathPacket.killerId = death.killerId;
-
-      server->broadcastPacket(serialize(deathPacket));
-
-      Logger::debug(
-          "Broadcast EnemyDied: enemy=" + std::to_string(death.enemyId) +
-          " killer=" + std::to_string(death.killerId));
-    }
   }
 
   // Broadcast effect updates for all entities with active effects
@@ -1044,28 +1147,6 @@ void ServerGameState::broadcastInventoryUpdate(uint32_t playerId) {
 
 // World item management
 
-void ServerGameState::checkEnemyLootDrops() {
-  if (!enemySystem) {
-    return;
-  }
-
-  const auto& deaths = enemySystem->getDiedThisFrame();
-  for (const auto& death : deaths) {
-    // Simple loot table: All enemies drop Health Potion (itemId=1)
-    uint32_t lootItemId = 1;
-
-    const auto& enemies = enemySystem->getEnemies();
-    auto enemyIt = enemies.find(death.enemyId);
-    if (enemyIt != enemies.end()) {
-      const Enemy& enemy = enemyIt->second;
-      spawnWorldItem(lootItemId, enemy.x, enemy.y);
-
-      Logger::info("Enemy " + std::to_string(death.enemyId) + " dropped item " +
-                   std::to_string(lootItemId));
-    }
-  }
-}
-
 void ServerGameState::spawnWorldItem(uint32_t itemId, float x, float y) {
   uint32_t worldItemId = nextWorldItemId++;
 
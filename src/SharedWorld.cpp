@@ -0,0 +1,26 @@
+#include "SharedWorld.h"
+
+#include <cassert>
+
+#include "Logger.h"
+
+bool SharedWorld::load(const std::string& mapPath) {
+  assert(!collisionSystem && "SharedWorld loaded twice");
+
+  if (!map.load(mapPath)) {
+    Logger::error("SharedWorld: Failed to load map: " + mapPath);
+    return false;
+  }
+
+  collisionSystem = std::make_unique<CollisionSystem>(map.getCollisionShapes());
+  Logger::info("SharedWorld: Loaded " + mapPath + " with " +
+               std::to_string(map.getCollisionShapes().size()) +
+               " collision shapes");
+  return true;
+}
+
+WorldConfig SharedWorld::getWorldConfig() const {
+  assert(collisionSystem && "SharedWorld used before load()");
+  return WorldConfig(map.getWorldWidth(), map.getWorldHeight(),
+                     collisionSystem.get(), &map);
+}
@@ -0,0 +1,49 @@
+#include "SpriteBatch.h"
+
+#include <algorithm>
+
+void SpriteBatch::add(uint32_t textureId, const SpriteInstance& instance) {
+  keys.push_back(SortKey{(static_cast<uint64_t>(currentBand) << 32) | textureId,
+                         static_cast<uint32_t>(pending.size())});
+  pending.push_back(instance);
+}
+
+void SpriteBatch::flush(
+    const std::function<void(const std::vector<SpriteInstance>&,
+                             const std::vector<SpriteDrawRun>&)>& submit) {
+  if (pending.empty()) {
+    currentBand = 0;
+    return;
+  }
+
+  std::stable_sort(
+      keys.begin(), keys.end(),
+      [](const SortKey& a, const SortKey& b) { return a.key < b.key; });
+
+  sorted.clear();
+  runs.clear();
+  uint64_t runKey = 0;
+  for (const SortKey& k : keys) {
+    if (runs.empty() || k.key != runKey) {
+      runKey = k.key;
+      runs.push_back(
+          SpriteDrawRun{static_cast<uint32_t>(k.key), sorted.size(), 0});
+    }
+    runs.back().instanceCount++;
+    sorted.push_back(pending[k.index]);
+  }
+
+  submit(sorted, runs);
+
+  drawCalls += runs.size();
+  spritesDrawn += sorted.size();
+
+  pending.clear();
+  keys.clear();
+  currentBand = 0;
+}
+
+void SpriteBatch::resetStats() {
+  drawCalls = 0;
+  spritesDrawn = 0;
+}
@@ -1,25 +1,28 @@
 #include "SpriteRenderer.h"
 
-#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
 
 #include "OpenGLUtils.h"
 #include "ShaderCompat.h"
 
-// Simple sprite vertex shader
+// Instanced sprite vertex shader: one unit quad stretched per instance
 const char* spriteVertexShader =
     GAMBIT_GLSL_VERSION
     R"(
 layout (location = 0) in vec2 aPos;
-layout (location = 1) in vec2 aTexCoord;
+layout (location = 1) in vec4 aRect;   // x, y, width, height
+layout (location = 2) in vec4 aUV;     // u1, v1, u2, v2
+layout (location = 3) in vec4 aColor;
 
 out vec2 TexCoord;
+out vec4 SpriteColor;
 
 uniform mat4 projection;
-uniform mat4 model;
 
 void main() {
-    TexCoord = aTexCoord;
-    gl_Position = projection * model * vec4(aPos, 0.0, 1.0);
+    TexCoord = mix(aUV.xy, aUV.zw, aPos);
+    SpriteColor = aColor;
+    gl_Position = projection * vec4(aRect.xy + aPos * aRect.zw, 0.0, 1.0);
 }
 )";
 
@@ -29,24 +32,22 @@ const char* spriteFragmentShader =
     GAMBIT_GLSL_PRECISION
     R"(
 in vec2 TexCoord;
+in vec4 SpriteColor;
 out vec4 FragColor;
 
 uniform sampler2D image;
-uniform vec4 spriteColor;
 
 void main() {
-    FragColor = spriteColor * texture(image, TexCoord);
+    FragColor = SpriteColor * texture(image, TexCoord);
 }
 )";
 
-SpriteRenderer::SpriteRenderer() {
+SpriteRenderer::SpriteRenderer() : instanceCapacity(0), batching(false) {
   // Create shader program
   shaderProgram = OpenGLUtils::createShaderProgram(spriteVertexShader,
                                                    spriteFragmentShader);
 
   // Cache uniform locations (avoid repeated lookups)
-  uniformModel = glGetUniformLocation(shaderProgram, "model");
-  uniformColor = glGetUniformLocation(shaderProgram, "spriteColor");
   uniformProjection = glGetUniformLocation(shaderProgram, "projection");
 
   initRenderData();
@@ -54,62 +55,44 @@ SpriteRenderer::SpriteRenderer() {
 
 SpriteRenderer::~SpriteRenderer() {
   glDeleteVertexArrays(1, &VAO);
-  glDeleteBuffers(1, &VBO);
-  glDeleteVertexArrays(1, &regionVAO);
-  glDeleteBuffers(1, &regionVBO);
+  glDeleteBuffers(1, &quadVBO);
+  glDeleteBuffers(1, &instanceVBO);
   glDeleteProgram(shaderProgram);
 }
 
 void SpriteRenderer::initRenderData() {
-  // Configure VAO/VBO for a quad (two triangles)
+  // Unit quad (two triangles); doubles as the UV interpolation factor
   float vertices[] = {
-      // pos      // tex
-      0.0f, 1.0f, 0.0f, 1.0f,  // top-left
-      1.0f, 0.0f, 1.0f, 0.0f,  // bottom-right
-      0.0f, 0.0f, 0.0f, 0.0f,  // bottom-left
-
-      0.0f, 1.0f, 0.0f, 1.0f,  // top-left
-      1.0f, 1.0f, 1.0f, 1.0f,  // top-right
-      1.0f, 0.0f, 1.0f, 0.0f   // bottom-right
+      0.0f, 1.0f,  // top-left
+      1.0f, 0.0f,  // bottom-right
+      0.0f, 0.0f,  // bottom-left
+
+      0.0f, 1.0f,  // top-left
+      1.0f, 1.0f,  // top-right
+      1.0f, 0.0f   // bottom-right
   };
 
   glGenVertexArrays(1, &VAO);
-  glGenBuffers(1, &VBO);
-
-  glBindBuffer(GL_ARRAY_BUFFER, VBO);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+  glGenBuffers(1, &quadVBO);
+  glGenBuffers(1, &instanceVBO);
 
   glBindVertexArray(VAO);
 
-  // Position attribute
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
-
-  // Texture coord attribute
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float),
-                        (void*)(2 * sizeof(float)));
-
-  glBindBuffer(GL_ARRAY_BUFFER, 0);
-  glBindVertexArray(0);
-
-  // Create separate VAO/VBO for dynamic region rendering
-  glGenVertexArrays(1, &regionVAO);
-  glGenBuffers(1, &regionVBO);
-
-  glBindBuffer(GL_ARRAY_BUFFER, regionVBO);
-  glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), nullptr, GL_DYNAMIC_DRAW);
-
-  glBindVertexArray(regionVAO);
-
-  // Position attribute
+  glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
   glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
-
-  // Texture coord attribute
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float),
-                        (void*)(2 * sizeof(float)));
+  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+
+  // Per-instance rect, UV rect and tint (SpriteInstance layout)
+  glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+  for (GLuint i = 0; i < 3; ++i) {
+    GLuint location = 1 + i;
+    glEnableVertexAttribArray(location);
+    glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE,
+                          sizeof(SpriteInstance),
+                          (void*)(i * 4 * sizeof(float)));
+    glVertexAttribDivisor(location, 1);
+  }
 
   glBindBuffer(GL_ARRAY_BUFFER, 0);
   glBindVertexArray(0);
@@ -122,27 +105,8 @@ void SpriteRenderer::setProjection(const glm::mat4& projection) {
 
 void SpriteRenderer::draw(const Texture& texture, float x, float y, float width,
                           float height, float r, float g, float b, float a) {
-  glUseProgram(shaderProgram);
-
-  // Create model matrix (translate + scale)
-  glm::mat4 model = glm::mat4(1.0f);
-  model = glm::translate(model, glm::vec3(x, y, 0.0f));
-  model = glm::scale(model, glm::vec3(width, height, 1.0f));
-
-  // Set uniforms (use cached locations)
-  glUniformMatrix4fv(uniformModel, 1, GL_FALSE, &model[0][0]);
-  glUniform4f(uniformColor, r, g, b, a);
-
-  // Bind texture
-  glActiveTexture(GL_TEXTURE0);
-  texture.bind();
-
-  // Draw quad
-  glBindVertexArray(VAO);
-  glDrawArrays(GL_TRIANGLES, 0, 6);
-  glBindVertexArray(0);
-
-  OpenGLUtils::checkGLError("SpriteRenderer::draw");
+  queue(texture, SpriteInstance{x, y, width, height, 0.0f, 0.0f, 1.0f, 1.0f, r,
+                                g, b, a});
 }
 
 void SpriteRenderer::drawRegion(const Texture& texture, float x, float y,
@@ -155,44 +119,69 @@ void SpriteRenderer::drawRegion(const Texture& texture, float x, float y,
   float u2 = (srcX + srcW) / (float)texture.getWidth();
   float v2 = (srcY + srcH) / (float)texture.getHeight();
 
-  // Create vertices with custom UVs
-  float vertices[] = {
-      // pos      // tex
-      0.0f, 1.0f, u1, v2,  // top-left
-      1.0f, 0.0f, u2, v1,  // bottom-right
-      0.0f, 0.0f, u1, v1,  // bottom-left
-
-      0.0f, 1.0f, u1, v2,  // top-left
-      1.0f, 1.0f, u2, v2,  // top-right
-      1.0f, 0.0f, u2, v1   // bottom-right
-  };
+  queue(texture, SpriteInstance{x, y, width, height, u1, v1, u2, v2, r, g, b,
+                                a});
+}
 
-  // Update separate region VBO (doesn't corrupt main sprite VBO)
-  glBindBuffer(GL_ARRAY_BUFFER, regionVBO);
-  glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-  glBindBuffer(GL_ARRAY_BUFFER, 0);
+void SpriteRenderer::beginBatch() { batching = true; }
 
-  glUseProgram(shaderProgram);
+void SpriteRenderer::nextBand() { batch.nextBand(); }
 
-  // Create model matrix (translate + scale)
-  glm::mat4 model = glm::mat4(1.0f);
-  model = glm::translate(model, glm::vec3(x, y, 0.0f));
-  model = glm::scale(model, glm::vec3(width, height, 1.0f));
+void SpriteRenderer::endBatch() {
+  flush();
+  batching = false;
+}
 
-  // Set uniforms (use cached locations)
-  glUniformMatrix4fv(uniformModel, 1, GL_FALSE, &model[0][0]);
-  glUniform4f(uniformColor, r, g, b, a);
+void SpriteRenderer::queue(const Texture& texture,
+                           const SpriteInstance& instance) {
+  batch.add(texture.getID(), instance);
+  if (!batching) {
+    flush();
+  }
+}
 
-  // Bind texture
+void SpriteRenderer::flush() {
+  batch.flush([this](const std::vector<SpriteInstance>& instances,
+                     const std::vector<SpriteDrawRun>& runs) {
+    submit(instances, runs);
+  });
+}
+
+void SpriteRenderer::submit(const std::vector<SpriteInstance>& instances,
+                            const std::vector<SpriteDrawRun>& runs) {
+  OpenGLUtils::markCallSite("SpriteRenderer::submit");
+  glUseProgram(shaderProgram);
   glActiveTexture(GL_TEXTURE0);
-  texture.bind();
+  glBindVertexArray(VAO);
 
-  // Draw quad using region VAO
-  glBindVertexArray(regionVAO);
-  glDrawArrays(GL_TRIANGLES, 0, 6);
-  glBindVertexArray(0);
+  // Orphan and refill the instance buffer: one upload per flush, and the
+  // driver never stalls on a buffer the GPU is still reading. (WebGL has no
+  // persistent or unsynchronized mapping, so this is the portable path.)
+  glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+  if (instances.size() > instanceCapacity) {
+    instanceCapacity = std::max(instances.size(), instanceCapacity * 2);
+  }
+  glBufferData(GL_ARRAY_BUFFER, instanceCapacity * sizeof(SpriteInstance),
+               nullptr, GL_STREAM_DRAW);
+  glBufferSubData(GL_ARRAY_BUFFER, 0, instances.size() * sizeof(SpriteInstance),
+                  instances.data());
+
+  for (const SpriteDrawRun& run : runs) {
+    glBindTexture(GL_TEXTURE_2D, run.textureId);
+
+    // Instanced attributes start at the run's first sprite
+    for (GLuint i = 0; i < 3; ++i) {
+      glVertexAttribPointer(
+          1 + i, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
+          (void*)(run.firstInstance * sizeof(SpriteInstance) +
+                  i * 4 * sizeof(float)));
+    }
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6,
+                          static_cast<GLsizei>(run.instanceCount));
+  }
 
-  OpenGLUtils::checkGLError("SpriteRenderer::drawRegion");
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
 }
 
 void SpriteRenderer::drawRect(float x, float y, float width, float height,
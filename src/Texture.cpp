@@ -85,6 +85,34 @@ bool Texture::createWhitePixel() {
   return true;
 }
 
+bool Texture::createFromPixels(const uint8_t* rgba, int pixelWidth,
+                               int pixelHeight) {
+  width = pixelWidth;
+  height = pixelHeight;
+
+  glGenTextures(1, &textureID);
+  glBindTexture(GL_TEXTURE_2D, textureID);
+
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA,
+               GL_UNSIGNED_BYTE, rgba);
+
+  // Nearest filtering keeps pixel art (and bitmap glyphs) crisp
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+  glBindTexture(GL_TEXTURE_2D, 0);
+  return true;
+}
+
+void Texture::updatePixels(const uint8_t* rgba) {
+  glBindTexture(GL_TEXTURE_2D, textureID);
+  glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA,
+                  GL_UNSIGNED_BYTE, rgba);
+  glBindTexture(GL_TEXTURE_2D, 0);
+}
+
 void Texture::bind() const { glBindTexture(GL_TEXTURE_2D, textureID); }
 
 void Texture::unbind() { glBindTexture(GL_TEXTURE_2D, 0); }
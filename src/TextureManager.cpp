@@ -1,7 +1,59 @@
 #include "TextureManager.h"
 
+#include <SDL2/SDL_image.h>
+
+#include <cstring>
+
+#include "AssetLoader.h"
 #include "Logger.h"
 
+namespace {
+
+struct DecodedImage {
+  int width = 0;
+  int height = 0;
+  std::vector<uint8_t> rgba;
+};
+
+// Worker thread: file to tightly packed RGBA8, no GL
+std::shared_ptr<DecodedImage> decodeImage(const std::string& file) {
+  auto image = std::make_shared<DecodedImage>();
+  SDL_Surface* loaded = IMG_Load(file.c_str());
+  if (!loaded) {
+    Logger::error("Failed to load texture: " + file + " - " +
+                  std::string(IMG_GetError()));
+    return image;
+  }
+  SDL_Surface* rgba =
+      SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+  SDL_FreeSurface(loaded);
+  if (!rgba) {
+    Logger::error("Failed to convert texture: " + file);
+    return image;
+  }
+
+  image->width = rgba->w;
+  image->height = rgba->h;
+  size_t rowBytes = static_cast<size_t>(rgba->w) * 4;
+  image->rgba.resize(rowBytes * rgba->h);
+  const uint8_t* source = static_cast<const uint8_t*>(rgba->pixels);
+  for (int row = 0; row < rgba->h; ++row) {
+    std::memcpy(&image->rgba[row * rowBytes], source + row * rgba->pitch,
+                rowBytes);
+  }
+  SDL_FreeSurface(rgba);
+  return image;
+}
+
+std::shared_future<const TextureRegion*> readyRegion(
+    const TextureRegion* region) {
+  std::promise<const TextureRegion*> promise;
+  promise.set_value(region);
+  return promise.get_future().share();
+}
+
+}  // namespace
+
 TextureManager& TextureManager::instance() {
   static TextureManager instance;
   return instance;
@@ -27,7 +79,264 @@ Texture* TextureManager::get(const std::string& path) {
   return ptr;
 }
 
+bool TextureManager::loadAtlas(const std::string& manifestPath) {
+  atlasPages.clear();
+  atlasPageUnusable.clear();
+  regions.clear();
+
+  if (!atlas.load(manifestPath)) {
+    Logger::info("TextureManager: No texture atlas at " + manifestPath +
+                 ", loading images individually");
+    return false;
+  }
+
+  size_t pageCount = atlas.getPages().size();
+  atlasPages.resize(pageCount);
+  atlasPageUnusable.assign(pageCount, false);
+
+  // Pages the GPU cannot hold fall back to their individual images
+  GLint maxTextureSize = 0;
+  glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+  for (size_t i = 0; i < pageCount; ++i) {
+    const AtlasPage& page = atlas.getPages()[i];
+    if (page.width > maxTextureSize || page.height > maxTextureSize) {
+      Logger::info("TextureManager: Atlas page " + page.file + " exceeds " +
+                   std::to_string(maxTextureSize) + "px, not using it");
+      atlasPageUnusable[i] = true;
+    }
+  }
+
+  Logger::info("TextureManager: Atlas with " +
+               std::to_string(atlas.getImageCount()) + " images on " +
+               std::to_string(pageCount) + " pages");
+  return true;
+}
+
+Texture* TextureManager::getAtlasPage(int page) {
+  if (atlasPageUnusable[page]) return nullptr;
+  if (!atlasPages[page]) {
+    auto texture = std::make_unique<Texture>();
+    std::string file = atlas.getBaseDirectory() + atlas.getPages()[page].file;
+    if (!texture->loadFromFile(file)) {
+      Logger::error("TextureManager: Failed to load atlas page: " + file);
+      atlasPageUnusable[page] = true;
+      return nullptr;
+    }
+    atlasPages[page] = std::move(texture);
+  }
+  return atlasPages[page].get();
+}
+
+const TextureRegion* TextureManager::getRegion(const std::string& path) {
+  auto it = regions.find(path);
+  if (it != regions.end()) {
+    return &it->second;
+  }
+
+  const AtlasEntry* entry = atlas.find(path);
+  Texture* page = entry ? getAtlasPage(entry->page) : nullptr;
+  if (page) {
+    return cacheRegion(path, page, entry->x, entry->y, entry->width,
+                       entry->height);
+  }
+
+  Texture* texture = get(path);
+  if (!texture) return nullptr;
+  return cacheRegion(path, texture, 0, 0, texture->getWidth(),
+                     texture->getHeight());
+}
+
+const TextureRegion* TextureManager::cacheRegion(const std::string& path,
+                                                 Texture* texture, int x,
+                                                 int y, int width,
+                                                 int height) {
+  TextureRegion region;
+  region.texture = texture;
+  region.x = x;
+  region.y = y;
+  region.width = width;
+  region.height = height;
+
+  float texW = static_cast<float>(texture->getWidth());
+  float texH = static_cast<float>(texture->getHeight());
+  region.u1 = x / texW;
+  region.v1 = y / texH;
+  region.u2 = (x + width) / texW;
+  region.v2 = (y + height) / texH;
+
+  return &(regions[path] = region);
+}
+
+const TextureRegion* TextureManager::findResidentRegion(
+    const std::string& path) {
+  auto it = regions.find(path);
+  if (it != regions.end()) {
+    return &it->second;
+  }
+
+  const AtlasEntry* entry = atlas.find(path);
+  if (entry && atlasPages[entry->page]) {
+    return cacheRegion(path, atlasPages[entry->page].get(), entry->x,
+                       entry->y, entry->width, entry->height);
+  }
+
+  auto texture = textures.find(path);
+  if (texture != textures.end()) {
+    Texture* standalone = texture->second.get();
+    return cacheRegion(path, standalone, 0, 0, standalone->getWidth(),
+                       standalone->getHeight());
+  }
+  return nullptr;
+}
+
+std::shared_future<const TextureRegion*> TextureManager::loadRegionAsync(
+    const std::string& path) {
+  if (const TextureRegion* region = findResidentRegion(path)) {
+    return readyRegion(region);
+  }
+  if (failedPaths.count(path)) {
+    return readyRegion(nullptr);
+  }
+  auto pending = pendingRegions.find(path);
+  if (pending != pendingRegions.end()) {
+    return pending->second;
+  }
+
+  auto promise = std::make_shared<std::promise<const TextureRegion*>>();
+  std::shared_future<const TextureRegion*> future =
+      promise->get_future().share();
+  pendingRegions[path] = future;
+
+  requestRegionTexture(path, [this, path, promise]() {
+    const TextureRegion* region = findResidentRegion(path);
+    if (!region) failedPaths.insert(path);
+    pendingRegions.erase(path);
+    promise->set_value(region);
+  });
+  return future;
+}
+
+const TextureRegion* TextureManager::tryGetRegion(const std::string& path) {
+  if (const TextureRegion* region = findResidentRegion(path)) {
+    return region;
+  }
+  loadRegionAsync(path);
+  return nullptr;
+}
+
+std::shared_future<void> TextureManager::prefetch(
+    const std::vector<std::string>& paths) {
+  auto promise = std::make_shared<std::promise<void>>();
+  std::shared_future<void> future = promise->get_future().share();
+
+  // All callbacks run on the render thread: a plain counter will do
+  auto remaining = std::make_shared<size_t>(paths.size() + 1);
+  auto countDown = [promise, remaining]() {
+    if (--*remaining == 0) promise->set_value();
+  };
+
+  for (const std::string& path : paths) {
+    auto loading = loadRegionAsync(path);
+    if (loading.wait_for(std::chrono::seconds(0)) ==
+        std::future_status::ready) {
+      countDown();
+    } else {
+      requestRegionTexture(path, countDown);
+    }
+  }
+  countDown();  // Resolves now if nothing had to load
+  return future;
+}
+
+void TextureManager::requestRegionTexture(const std::string& path,
+                                          std::function<void()> done) {
+  if (findResidentRegion(path)) {
+    done();
+    return;
+  }
+
+  const AtlasEntry* entry = atlas.find(path);
+  if (entry && !atlasPageUnusable[entry->page]) {
+    int page = entry->page;
+    size_t pageCount = atlasPages.size();
+    decodeAsync(
+        atlas.getBaseDirectory() + atlas.getPages()[page].file,
+        [this, page, pageCount](std::unique_ptr<Texture> texture) {
+          if (atlasPages.size() != pageCount || atlasPages[page]) {
+            return;  // Atlas reloaded, or page loaded synchronously meanwhile
+          }
+          if (texture) {
+            atlasPages[page] = std::move(texture);
+          } else {
+            atlasPageUnusable[page] = true;
+          }
+        },
+        [this, path, page, pageCount, done]() {
+          bool pageFailed =
+              atlasPages.size() == pageCount && atlasPageUnusable[page];
+          if (pageFailed) {
+            requestRegionTexture(path, done);  // Standalone image instead
+          } else {
+            done();
+          }
+        });
+    return;
+  }
+
+  decodeAsync(
+      path,
+      [this, path](std::unique_ptr<Texture> texture) {
+        if (texture && !textures.count(path)) {
+          textures[path] = std::move(texture);
+        }
+      },
+      done);
+}
+
+void TextureManager::decodeAsync(
+    const std::string& file,
+    std::function<void(std::unique_ptr<Texture>)> store,
+    std::function<void()> done) {
+  auto waiting = decodeWaiters.find(file);
+  if (waiting != decodeWaiters.end()) {
+    waiting->second.push_back(std::move(done));
+    return;
+  }
+  decodeWaiters[file].push_back(std::move(done));
+
+  AssetLoader::instance().submitWithUpload([this, file, store]() {
+    std::shared_ptr<DecodedImage> image = decodeImage(file);
+    AssetLoader::Upload upload;
+    upload.cost = image->rgba.size();
+    upload.run = [this, file, store, image]() {
+      std::unique_ptr<Texture> texture;
+      if (image->width > 0) {
+        texture = std::make_unique<Texture>();
+        texture->createFromPixels(image->rgba.data(), image->width,
+                                  image->height);
+        Logger::info("Loaded texture: " + file + " (" +
+                     std::to_string(image->width) + "x" +
+                     std::to_string(image->height) + ", async)");
+      }
+      store(std::move(texture));
+
+      std::vector<std::function<void()>> waiters =
+          std::move(decodeWaiters[file]);
+      decodeWaiters.erase(file);
+      for (const auto& callback : waiters) {
+        callback();
+      }
+    };
+    return upload;
+  });
+}
+
 void TextureManager::clear() {
+  regions.clear();
+  atlasPages.clear();
+  atlasPageUnusable.clear();
+  atlas = AtlasManifest();
   textures.clear();
+  failedPaths.clear();
   Logger::info("TextureManager: Cleared all textures");
 }
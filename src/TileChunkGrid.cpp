@@ -0,0 +1,86 @@
+#include "TileChunkGrid.h"
+
+#include <algorithm>
+#include <cassert>
+
+TileChunkGrid::TileChunkGrid(int mapWidth, int mapHeight, int tileWidth,
+                             int tileHeight, int chunkSize)
+    : mapWidth(mapWidth),
+      mapHeight(mapHeight),
+      tileWidth(tileWidth),
+      tileHeight(tileHeight) {
+  assert(chunkSize > 0 && "Chunk size must be positive");
+
+  // Map center in grid space, projected; subtracted so the map sits at (0, 0)
+  float centerTileX = (mapWidth - 1) / 2.0f;
+  float centerTileY = (mapHeight - 1) / 2.0f;
+  centerWorldX = (centerTileX - centerTileY) * tileWidth / 2.0f;
+  centerWorldY = (centerTileX + centerTileY) * tileHeight / 4.0f;
+
+  int chunksWide = (mapWidth + chunkSize - 1) / chunkSize;
+  int chunksHigh = (mapHeight + chunkSize - 1) / chunkSize;
+  chunks.reserve(static_cast<size_t>(chunksWide) * chunksHigh);
+
+  // Walk chunk diagonals back to front
+  for (int diagonal = 0; diagonal <= chunksWide + chunksHigh - 2; ++diagonal) {
+    for (int cx = std::max(0, diagonal - chunksHigh + 1);
+         cx <= std::min(diagonal, chunksWide - 1); ++cx) {
+      int cy = diagonal - cx;
+
+      TileChunk chunk;
+      chunk.firstTileX = cx * chunkSize;
+      chunk.firstTileY = cy * chunkSize;
+      chunk.tilesWide = std::min(chunkSize, mapWidth - chunk.firstTileX);
+      chunk.tilesHigh = std::min(chunkSize, mapHeight - chunk.firstTileY);
+
+      // The projection is linear, so the extremes are at the corner tiles
+      int lastTileX = chunk.firstTileX + chunk.tilesWide - 1;
+      int lastTileY = chunk.firstTileY + chunk.tilesHigh - 1;
+      const int cornerX[4] = {chunk.firstTileX, lastTileX, chunk.firstTileX,
+                              lastTileX};
+      const int cornerY[4] = {chunk.firstTileY, chunk.firstTileY, lastTileY,
+                              lastTileY};
+      float wx, wy;
+      gridToWorld(cornerX[0], cornerY[0], wx, wy);
+      chunk.minX = chunk.maxX = wx;
+      chunk.minY = chunk.maxY = wy;
+      for (int i = 1; i < 4; ++i) {
+        gridToWorld(cornerX[i], cornerY[i], wx, wy);
+        chunk.minX = std::min(chunk.minX, wx);
+        chunk.maxX = std::max(chunk.maxX, wx);
+        chunk.minY = std::min(chunk.minY, wy);
+        chunk.maxY = std::max(chunk.maxY, wy);
+      }
+
+      // Tile quads are tileWidth x tileHeight, centered on their position
+      chunk.minX -= tileWidth / 2.0f;
+      chunk.maxX += tileWidth / 2.0f;
+      chunk.minY -= tileHeight / 2.0f;
+      chunk.maxY += tileHeight / 2.0f;
+
+      chunks.push_back(chunk);
+    }
+  }
+}
+
+void TileChunkGrid::gridToWorld(int tileX, int tileY, float& worldX,
+                                float& worldY) const {
+  // Using tileHeight/4 for Y to increase vertical overlap for thick isometric
+  // tiles
+  worldX = (tileX - tileY) * tileWidth / 2.0f - centerWorldX;
+  worldY = (tileX + tileY) * tileHeight / 4.0f - centerWorldY;
+}
+
+void TileChunkGrid::findVisible(float viewMinX, float viewMinY,
+                                float viewMaxX, float viewMaxY,
+                                std::vector<size_t>& out) const {
+  out.clear();
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    const TileChunk& chunk = chunks[i];
+    if (chunk.maxX < viewMinX || chunk.minX > viewMaxX ||
+        chunk.maxY < viewMinY || chunk.minY > viewMaxY) {
+      continue;
+    }
+    out.push_back(i);
+  }
+}
@@ -1,6 +1,7 @@
 #include "TileRenderer.h"
 
 #include <glm/gtc/matrix_transform.hpp>
+#include <iterator>
 
 #include "Logger.h"
 #include "OpenGLUtils.h"
@@ -54,19 +55,22 @@ TileRenderer::TileRenderer(Camera* camera, SpriteRenderer* spriteRenderer,
       spriteRenderer(spriteRenderer),
       whitePixel(whitePixel),
       tilesetTexture(nullptr),
-      batchBuilt(false),
-      verticesUploaded(false),
-      vboCapacity(0) {
-  initBatchRenderer();
+      drawCalls(0),
+      builtChunks(0) {
+  initShader();
 }
 
 TileRenderer::~TileRenderer() {
-  glDeleteVertexArrays(1, &VAO);
-  glDeleteBuffers(1, &VBO);
+  for (ChunkBuffers& chunk : chunkBuffers) {
+    if (chunk.built) {
+      glDeleteVertexArrays(1, &chunk.VAO);
+      glDeleteBuffers(1, &chunk.VBO);
+    }
+  }
   glDeleteProgram(shaderProgram);
 }
 
-void TileRenderer::initBatchRenderer() {
+void TileRenderer::initShader() {
   // Create shader program for batched tile rendering
   shaderProgram = OpenGLUtils::createShaderProgram(batchTileVertexShader,
                                                    batchTileFragmentShader);
@@ -75,31 +79,23 @@ void TileRenderer::initBatchRenderer() {
   uniformProjection = glGetUniformLocation(shaderProgram, "projection");
   uniformCameraPos = glGetUniformLocation(shaderProgram, "cameraPos");
   uniformScreenCenter = glGetUniformLocation(shaderProgram, "screenCenter");
+}
 
-  // Create VAO/VBO for dynamic batched rendering
-  glGenVertexArrays(1, &VAO);
-  glGenBuffers(1, &VBO);
-
-  glBindBuffer(GL_ARRAY_BUFFER, VBO);
-  // Start with zero capacity - will allocate on first render based on actual
-  // map size
-  vboCapacity = 0;
-
-  glBindVertexArray(VAO);
-
-  // Position attribute
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
-
-  // Texture coord attribute
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float),
-                        (void*)(2 * sizeof(float)));
-
-  glBindBuffer(GL_ARRAY_BUFFER, 0);
-  glBindVertexArray(0);
-
-  // Vector will auto-grow in buildTileBatch() based on actual map size
+void TileRenderer::loadTileset(const TiledMap& map) {
+  std::string tilesetPath = map.getTilesetImagePath();
+  if (!tilesetPath.empty()) {
+    tilesetTexture = TextureManager::instance().get(tilesetPath);
+    if (!tilesetTexture) {
+      Logger::info("Failed to load tileset: " + tilesetPath +
+                   ", using placeholder");
+      tilesetTexture = whitePixel;
+    } else {
+      Logger::info("Loaded tileset: " + tilesetPath);
+    }
+  } else {
+    Logger::info("No tileset found in map, using placeholder");
+    tilesetTexture = whitePixel;
+  }
 }
 
 void TileRenderer::render(const TiledMap& map,
@@ -111,30 +107,34 @@ void TileRenderer::render(const TiledMap& map,
 
   // Load tileset if not already loaded
   if (!tilesetTexture) {
-    std::string tilesetPath = map.getTilesetImagePath();
-    if (!tilesetPath.empty()) {
-      tilesetTexture = TextureManager::instance().get(tilesetPath);
-      if (!tilesetTexture) {
-        Logger::info("Failed to load tileset: " + tilesetPath +
-                     ", using placeholder");
-        tilesetTexture = whitePixel;
-      } else {
-        Logger::info("Loaded tileset: " + tilesetPath);
-      }
-    } else {
-      Logger::info("No tileset found in map, using placeholder");
-      tilesetTexture = whitePixel;
-    }
+    loadTileset(map);
   }
 
-  // Build all tile vertices into a single batch (only once - tiles are static)
-  if (!batchBuilt) {
-    buildTileBatch(map);
-    batchBuilt = true;
+  // Chunk layout is cheap (bounds only); vertices come later, per chunk
+  if (!grid) {
+    grid = std::make_unique<TileChunkGrid>(
+        map.getWidth(), map.getHeight(), map.getTileWidth(),
+        map.getTileHeight(), Config::Tile::CHUNK_SIZE);
+    chunkBuffers.resize(grid->getChunks().size());
+    Logger::info("TileRenderer: " + std::to_string(chunkBuffers.size()) +
+                 " chunks of " + std::to_string(Config::Tile::CHUNK_SIZE) +
+                 "x" + std::to_string(Config::Tile::CHUNK_SIZE) + " tiles, " +
+                 std::to_string(tileLayers.size()) + " layer(s)");
   }
 
-  // Render all tiles in one draw call
-  renderBatch();
+  // Camera view in world space (worldToScreen is a plain offset)
+  float halfW = camera->screenWidth / 2.0f;
+  float halfH = camera->screenHeight / 2.0f;
+  grid->findVisible(camera->x - halfW, camera->y - halfH, camera->x + halfW,
+                    camera->y + halfH, visibleChunks);
+
+  for (size_t chunkIndex : visibleChunks) {
+    if (!chunkBuffers[chunkIndex].built) {
+      buildChunk(map, chunkIndex);
+    }
+  }
+
+  renderVisibleChunks(tileLayers.size());
 
   // Render all entities on top of tiles
   // Entities are already depth-sorted by RenderSystem before drawing
@@ -143,16 +143,9 @@ void TileRenderer::render(const TiledMap& map,
   playerCallback(0.0f, 1000000.0f);
 }
 
-void TileRenderer::buildTileBatch(const TiledMap& map) {
-  batchVertices.clear();
-
-  const auto& tileLayers = map.getTileLayers();
-  if (tileLayers.empty()) {
-    return;
-  }
-
-  const tmx::TileLayer* layer = tileLayers[0];
-  const auto& tiles = layer->getTiles();
+void TileRenderer::buildChunk(const TiledMap& map, size_t chunkIndex) {
+  const TileChunk& chunk = grid->getChunks()[chunkIndex];
+  ChunkBuffers& buffers = chunkBuffers[chunkIndex];
 
   int tileWidth = map.getTileWidth();
   int tileHeight = map.getTileHeight();
@@ -161,82 +154,112 @@ void TileRenderer::buildTileBatch(const TiledMap& map) {
 
   bool isPlaceholder = (tilesetTexture == whitePixel);
 
-  for (int tileY = 0; tileY < map.getHeight(); ++tileY) {
-    for (int tileX = 0; tileX < map.getWidth(); ++tileX) {
-      int tileIndex = tileY * map.getWidth() + tileX;
-      uint32_t gid = tiles[tileIndex].ID;
-
-      if (gid == 0) continue;  // Skip empty tiles
-
-      float worldX, worldY;
-      gridToWorld(map, tileX, tileY, worldX, worldY);
-
-      // Use world coordinates instead of screen coordinates
-      // Camera transformation will be applied in shader
-      // For isometric tiles, center the quad at the world position
-      float x = worldX - tileWidth / 2.0f;
-      float y = worldY - tileHeight / 2.0f;  // Center anchor for proper overlap
-
-      // Calculate UV coordinates for texture atlas
-      float u1, v1, u2, v2;
-      if (isPlaceholder) {
-        u1 = 0.0f;
-        v1 = 0.0f;
-        u2 = 1.0f;
-        v2 = 1.0f;
-      } else {
-        int tileTextureIndex = gid - 1;
-        // FIX: Use actual column count from tileset, not hardcoded 2
-        int column = tileTextureIndex % columns;
-        int row = tileTextureIndex / columns;
-        // Account for spacing between tiles
-        int srcX = column * (tileWidth + spacing);
-        int srcY = row * (tileHeight + spacing);
-
-        u1 = srcX / (float)tilesetTexture->getWidth();
-        v1 = srcY / (float)tilesetTexture->getHeight();
-        u2 = (srcX + tileWidth) / (float)tilesetTexture->getWidth();
-        v2 = (srcY + tileHeight) / (float)tilesetTexture->getHeight();
-      }
+  scratchVertices.clear();
+  buffers.layers.clear();
+
+  for (const uint32_t* tiles : map.getTileLayers()) {
+    LayerRange range{
+        static_cast<GLint>(scratchVertices.size() /
+                           Config::Tile::FLOATS_PER_VERTEX),
+        0};
 
-      // Build 6 vertices (2 triangles) for this tile
-      // Triangle 1: top-left, bottom-right, bottom-left
-      batchVertices.push_back(x);
-      batchVertices.push_back(y + tileHeight);
-      batchVertices.push_back(u1);
-      batchVertices.push_back(v2);
-
-      batchVertices.push_back(x + tileWidth);
-      batchVertices.push_back(y);
-      batchVertices.push_back(u2);
-      batchVertices.push_back(v1);
-
-      batchVertices.push_back(x);
-      batchVertices.push_back(y);
-      batchVertices.push_back(u1);
-      batchVertices.push_back(v1);
-
-      // Triangle 2: top-left, top-right, bottom-right
-      batchVertices.push_back(x);
-      batchVertices.push_back(y + tileHeight);
-      batchVertices.push_back(u1);
-      batchVertices.push_back(v2);
-
-      batchVertices.push_back(x + tileWidth);
-      batchVertices.push_back(y + tileHeight);
-      batchVertices.push_back(u2);
-      batchVertices.push_back(v2);
-
-      batchVertices.push_back(x + tileWidth);
-      batchVertices.push_back(y);
-      batchVertices.push_back(u2);
-      batchVertices.push_back(v1);
+    if (!tiles) {
+      // Hidden, or an infinite-map layer stored in its own chunks
+      buffers.layers.push_back(range);
+      continue;
     }
+
+    for (int tileY = chunk.firstTileY;
+         tileY < chunk.firstTileY + chunk.tilesHigh; ++tileY) {
+      for (int tileX = chunk.firstTileX;
+           tileX < chunk.firstTileX + chunk.tilesWide; ++tileX) {
+        int tileIndex = tileY * map.getWidth() + tileX;
+        uint32_t gid = tiles[tileIndex];
+
+        if (gid == 0) continue;  // Skip empty tiles
+
+        float worldX, worldY;
+        grid->gridToWorld(tileX, tileY, worldX, worldY);
+
+        // Use world coordinates instead of screen coordinates
+        // Camera transformation will be applied in shader
+        // For isometric tiles, center the quad at the world position
+        float x = worldX - tileWidth / 2.0f;
+        float y = worldY - tileHeight / 2.0f;
+
+        // Calculate UV coordinates for texture atlas
+        float u1, v1, u2, v2;
+        if (isPlaceholder) {
+          u1 = 0.0f;
+          v1 = 0.0f;
+          u2 = 1.0f;
+          v2 = 1.0f;
+        } else {
+          int tileTextureIndex = gid - 1;
+          int column = tileTextureIndex % columns;
+          int row = tileTextureIndex / columns;
+          // Account for spacing between tiles
+          int srcX = column * (tileWidth + spacing);
+          int srcY = row * (tileHeight + spacing);
+
+          u1 = srcX / (float)tilesetTexture->getWidth();
+          v1 = srcY / (float)tilesetTexture->getHeight();
+          u2 = (srcX + tileWidth) / (float)tilesetTexture->getWidth();
+          v2 = (srcY + tileHeight) / (float)tilesetTexture->getHeight();
+        }
+
+        // Build 6 vertices (2 triangles) for this tile
+        const float quad[] = {
+            x,             y + tileHeight, u1, v2,  // top-left
+            x + tileWidth, y,              u2, v1,  // bottom-right
+            x,             y,              u1, v1,  // bottom-left
+            x,             y + tileHeight, u1, v2,  // top-left
+            x + tileWidth, y + tileHeight, u2, v2,  // top-right
+            x + tileWidth, y,              u2, v1   // bottom-right
+        };
+        scratchVertices.insert(scratchVertices.end(), std::begin(quad),
+                               std::end(quad));
+      }
+    }
+
+    range.vertexCount =
+        static_cast<GLsizei>(scratchVertices.size() /
+                             Config::Tile::FLOATS_PER_VERTEX) -
+        range.firstVertex;
+    buffers.layers.push_back(range);
+  }
+
+  buffers.built = true;
+  builtChunks++;
+  if (scratchVertices.empty()) {
+    return;  // Nothing but empty tiles; never drawn
   }
+
+  glGenVertexArrays(1, &buffers.VAO);
+  glGenBuffers(1, &buffers.VBO);
+
+  glBindVertexArray(buffers.VAO);
+  glBindBuffer(GL_ARRAY_BUFFER, buffers.VBO);
+  glBufferData(GL_ARRAY_BUFFER, scratchVertices.size() * sizeof(float),
+               scratchVertices.data(), GL_STATIC_DRAW);
+
+  // Position attribute
+  glEnableVertexAttribArray(0);
+  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+
+  // Texture coord attribute
+  glEnableVertexAttribArray(1);
+  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float),
+                        (void*)(2 * sizeof(float)));
+
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
 }
 
-void TileRenderer::renderBatch() {
-  if (batchVertices.empty()) {
+void TileRenderer::renderVisibleChunks(size_t layerCount) {
+  OpenGLUtils::markCallSite("TileRenderer::renderVisibleChunks");
+  drawCalls = 0;
+  if (visibleChunks.empty()) {
     return;
   }
 
@@ -262,67 +285,20 @@ void TileRenderer::renderBatch() {
   glActiveTexture(GL_TEXTURE0);
   tilesetTexture->bind();
 
-  // Upload vertex data only once (tiles are static in world space)
-  if (!verticesUploaded) {
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-
-    size_t requiredCapacity = batchVertices.size();
-
-    // Check if we need to resize the buffer
-    if (requiredCapacity > vboCapacity) {
-      // Allocate new buffer with actual size needed (not fixed size)
-      glBufferData(GL_ARRAY_BUFFER, requiredCapacity * sizeof(float),
-                   batchVertices.data(), GL_STATIC_DRAW);
-      vboCapacity = requiredCapacity;
-
-      Logger::info(
-          "TileRenderer: Allocated GPU buffer for " +
-          std::to_string(requiredCapacity / 24) + " tiles (" +
-          std::to_string(requiredCapacity * sizeof(float) / 1024 / 1024) +
-          " MB)");
-    } else {
-      // Buffer is large enough, just update data
-      glBufferSubData(GL_ARRAY_BUFFER, 0, requiredCapacity * sizeof(float),
-                      batchVertices.data());
+  // Layer by layer, so an upper layer never sinks below a lower layer of a
+  // neighbouring chunk; chunks within a layer are already back to front
+  for (size_t layer = 0; layer < layerCount; ++layer) {
+    for (size_t chunkIndex : visibleChunks) {
+      const ChunkBuffers& chunk = chunkBuffers[chunkIndex];
+      if (layer >= chunk.layers.size() ||
+          chunk.layers[layer].vertexCount == 0) {
+        continue;
+      }
+      glBindVertexArray(chunk.VAO);
+      glDrawArrays(GL_TRIANGLES, chunk.layers[layer].firstVertex,
+                   chunk.layers[layer].vertexCount);
+      drawCalls++;
     }
-
-    verticesUploaded = true;
   }
-
-  // Draw all tiles in one call
-  glBindVertexArray(VAO);
-  glDrawArrays(GL_TRIANGLES, 0, batchVertices.size() / 4);
   glBindVertexArray(0);
-
-  OpenGLUtils::checkGLError("TileRenderer::renderBatch");
-}
-
-void TileRenderer::gridToWorld(const TiledMap& map, int tileX, int tileY,
-                               float& worldX, float& worldY) {
-  // Tiled's isometric grid-to-world formula
-  int tileWidth = map.getTileWidth();
-  int tileHeight = map.getTileHeight();
-
-  // Calculate position using Tiled's formula
-  // Using tileHeight/4 for Y to increase vertical overlap for thick isometric
-  // tiles
-  worldX = (tileX - tileY) * tileWidth / 2.0f;
-  worldY = (tileX + tileY) * tileHeight / 4.0f;
-
-  // Center the map at origin
-  // The map's bounding box center needs to be at (0, 0)
-  int mapWidth = map.getWidth();
-  int mapHeight = map.getHeight();
-
-  // Map center in grid space
-  float centerTileX = (mapWidth - 1) / 2.0f;
-  float centerTileY = (mapHeight - 1) / 2.0f;
-
-  // Map center in world space (before offset)
-  float centerWorldX = (centerTileX - centerTileY) * tileWidth / 2.0f;
-  float centerWorldY = (centerTileX + centerTileY) * tileHeight / 4.0f;
-
-  // Offset to center the map at origin
-  worldX -= centerWorldX;
-  worldY -= centerWorldY;
 }
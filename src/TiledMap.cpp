@@ -2,10 +2,31 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <tmxlite/Map.hpp>
+#include <tmxlite/ObjectGroup.hpp>
+#include <tmxlite/TileLayer.hpp>
 
+#include "CompiledMap.h"
 #include "Logger.h"
 
 bool TiledMap::load(const std::string& filepath) {
+  if (CompiledMap::isCompiledPath(filepath)) {
+    return CompiledMap::read(filepath, *this);
+  }
+
+  std::string compiledPath = CompiledMap::pathFor(filepath);
+  if (CompiledMap::isUpToDate(compiledPath, filepath)) {
+    if (CompiledMap::read(compiledPath, *this)) {
+      return true;
+    }
+    Logger::info("Ignoring unreadable " + compiledPath + ", parsing TMX");
+  }
+  return loadTmx(filepath);
+}
+
+bool TiledMap::loadTmx(const std::string& filepath) {
+  tmx::Map tmxMap;
   if (!tmxMap.load(filepath)) {
     Logger::error("Failed to load map: " + filepath);
     return false;
@@ -19,19 +40,78 @@ bool TiledMap::load(const std::string& filepath) {
   tileWidth = static_cast<int>(tmxMap.getTileSize().x);
   tileHeight = static_cast<int>(tmxMap.getTileSize().y);
 
+  const auto& tilesets = tmxMap.getTilesets();
+  tilesetImagePath = tilesets.empty() ? "" : tilesets[0].getImagePath();
+  tilesetColumns = tilesets.empty() ? 1 : tilesets[0].getColumnCount();
+  tilesetSpacing = tilesets.empty() ? 0 : tilesets[0].getSpacing();
+
+  extractTiles(tmxMap);
+  extractCollisionShapes(tmxMap);
+  extractEnemySpawns(tmxMap);
+  extractPlayerSpawns(tmxMap);
+  extractShip(tmxMap);
+  extractObjectives(tmxMap);
+  extractMusicZones(tmxMap);
+
+  Logger::info("Loaded map: " + filepath + " (" + std::to_string(mapWidth) +
+               "x" + std::to_string(mapHeight) + " tiles, " +
+               std::to_string(tileWidth) + "x" + std::to_string(tileHeight) +
+               "px, " + std::to_string(collisionShapes.size()) +
+               " collision shapes, " + std::to_string(enemySpawns.size()) +
+               " enemy spawns, " + std::to_string(playerSpawns.size()) +
+               " player spawns)");
+
+  return true;
+}
+
+int TiledMap::getWorldWidth() const {
+  // For centered isometric map, width is the horizontal extent of the diamond
+  // worldX = (tileX - tileY) * tileWidth/2
+  // Max occurs at right corner (mapWidth-1, 0): worldX = (mapWidth-1) *
+  // tileWidth/2 After centering offset, max is still the same distance from
+  // origin
+  return (mapWidth - 1) * tileWidth;  // Full width is 2x maxX
+}
+
+int TiledMap::getWorldHeight() const {
+  // For centered isometric map, height is the vertical extent of the diamond
+  // worldY = (tileX + tileY) * tileHeight/4
+  // Max occurs at bottom corner (mapWidth-1, mapHeight-1):
+  // worldY = (mapWidth-1 + mapHeight-1) * tileHeight/4
+  // After centering, max is still the same distance from origin
+  return (mapWidth + mapHeight - 2) * tileHeight / 4;  // Full height is 2x maxY
+}
+
+void TiledMap::extractTiles(const tmx::Map& tmxMap) {
+  mappedFile.reset();
   tileLayers.clear();
-  const auto& layers = tmxMap.getLayers();
-  for (const auto& layer : layers) {
-    if (layer->getType() == tmx::Layer::Type::Tile) {
-      tileLayers.push_back(dynamic_cast<const tmx::TileLayer*>(layer.get()));
+  tileData.clear();
+
+  // Copy every drawable layer's gids into one block, then point at it
+  size_t layerTiles = static_cast<size_t>(mapWidth) * mapHeight;
+  std::vector<size_t> offsets;
+  for (const auto& layer : tmxMap.getLayers()) {
+    if (layer->getType() != tmx::Layer::Type::Tile) continue;
+    const auto& tiles = layer->getLayerAs<tmx::TileLayer>().getTiles();
+    if (!layer->getVisible() || tiles.size() < layerTiles) {
+      // Hidden, or an infinite-map layer stored in its own chunks
+      offsets.push_back(SIZE_MAX);
+      continue;
+    }
+    offsets.push_back(tileData.size());
+    for (size_t i = 0; i < layerTiles; ++i) {
+      tileData.push_back(tiles[i].ID);
     }
   }
 
-  extractCollisionShapes();
-  extractEnemySpawns();
-  extractPlayerSpawns();
-  extractShip();
-  extractObjectives();
+  for (size_t offset : offsets) {
+    tileLayers.push_back(offset == SIZE_MAX ? nullptr
+                                            : tileData.data() + offset);
+  }
+}
+
+void TiledMap::extractMusicZones(const tmx::Map& tmxMap) {
+  musicZones.clear();
 
   // Calculate map centering offset for music zones
   float centerTileX = (mapWidth - 1) / 2.0f;
@@ -40,8 +120,7 @@ bool TiledMap::load(const std::string& filepath) {
   float centerWorldY = (centerTileX + centerTileY) * tileHeight / 4.0f;
 
   // Extract music zones from object layers
-  musicZones.clear();
-  for (const auto& layer : layers) {
+  for (const auto& layer : tmxMap.getLayers()) {
     if (layer->getType() == tmx::Layer::Type::Object) {
       const auto& objectLayer = layer->getLayerAs<tmx::ObjectGroup>();
 
@@ -91,37 +170,9 @@ bool TiledMap::load(const std::string& filepath) {
       }
     }
   }
-
-  Logger::info("Loaded map: " + filepath + " (" + std::to_string(mapWidth) +
-               "x" + std::to_string(mapHeight) + " tiles, " +
-               std::to_string(tileWidth) + "x" + std::to_string(tileHeight) +
-               "px, " + std::to_string(collisionShapes.size()) +
-               " collision shapes, " + std::to_string(enemySpawns.size()) +
-               " enemy spawns, " + std::to_string(playerSpawns.size()) +
-               " player spawns)");
-
-  return true;
-}
-
-int TiledMap::getWorldWidth() const {
-  // For centered isometric map, width is the horizontal extent of the diamond
-  // worldX = (tileX - tileY) * tileWidth/2
-  // Max occurs at right corner (mapWidth-1, 0): worldX = (mapWidth-1) *
-  // tileWidth/2 After centering offset, max is still the same distance from
-  // origin
-  return (mapWidth - 1) * tileWidth;  // Full width is 2x maxX
 }
 
-int TiledMap::getWorldHeight() const {
-  // For centered isometric map, height is the vertical extent of the diamond
-  // worldY = (tileX + tileY) * tileHeight/4
-  // Max occurs at bottom corner (mapWidth-1, mapHeight-1):
-  // worldY = (mapWidth-1 + mapHeight-1) * tileHeight/4
-  // After centering, max is still the same distance from origin
-  return (mapWidth + mapHeight - 2) * tileHeight / 4;  // Full height is 2x maxY
-}
-
-void TiledMap::extractCollisionShapes() {
+void TiledMap::extractCollisionShapes(const tmx::Map& tmxMap) {
   collisionShapes.clear();
 
   // Calculate map centering offset (same as in TileRenderer::gridToWorld)
@@ -181,7 +232,7 @@ void TiledMap::extractCollisionShapes() {
   }
 }
 
-void TiledMap::extractEnemySpawns() {
+void TiledMap::extractEnemySpawns(const tmx::Map& tmxMap) {
   enemySpawns.clear();
 
   // Calculate map centering offset
@@ -258,31 +309,7 @@ void TiledMap::extractEnemySpawns() {
   }
 }
 
-std::string TiledMap::getTilesetImagePath() const {
-  const auto& tilesets = tmxMap.getTilesets();
-  if (tilesets.empty()) {
-    return "";
-  }
-  return tilesets[0].getImagePath();
-}
-
-int TiledMap::getTilesetColumns() const {
-  const auto& tilesets = tmxMap.getTilesets();
-  if (tilesets.empty()) {
-    return 1;
-  }
-  return tilesets[0].getColumnCount();
-}
-
-int TiledMap::getTilesetSpacing() const {
-  const auto& tilesets = tmxMap.getTilesets();
-  if (tilesets.empty()) {
-    return 0;
-  }
-  return tilesets[0].getSpacing();
-}
-
-void TiledMap::extractPlayerSpawns() {
+void TiledMap::extractPlayerSpawns(const tmx::Map& tmxMap) {
   playerSpawns.clear();
 
   // Calculate map centering offset
@@ -326,7 +353,7 @@ void TiledMap::extractPlayerSpawns() {
   }
 }
 
-void TiledMap::extractShip() {
+void TiledMap::extractShip(const tmx::Map& tmxMap) {
   hasShip = false;
 
   float centerTileX = (tmxMap.getTileCount().x - 1) / 2.0f;
@@ -356,7 +383,7 @@ void TiledMap::extractShip() {
   Logger::info("No ship position found in map");
 }
 
-void TiledMap::extractObjectives() {
+void TiledMap::extractObjectives(const tmx::Map& tmxMap) {
   objectives.clear();
 
   // Calculate map centering offset
@@ -21,15 +21,27 @@
 #include "Player.h"
 #include "Texture.h"
 #include "TextureManager.h"
+#include "TiledMap.h"
 #include "Window.h"
 #include "config/GameplayConfig.h"
 #include "config/PlayerConfig.h"
+#include "config/TimingConfig.h"
+
+namespace {
+
+constexpr const char* TITLE_BACKGROUND_PATH = "assets/uis/blue_zone.png";
+
+constexpr int MINIMAP_WIDTH = 200;
+constexpr int MINIMAP_HEIGHT = 150;
+
+}  // namespace
 
 UISystem::UISystem(Window* window, ClientPrediction* clientPrediction,
                    NetworkClient* client, DamageNumberSystem* damageNumbers,
                    EffectTracker* effectTracker,
                    RemotePlayerInterpolation* remoteInterpolation,
-                   EnemyInterpolation* enemyInterpolation, Camera* camera)
+                   EnemyInterpolation* enemyInterpolation, Camera* camera,
+                   EventBus& bus)
     : window(window),
       clientPrediction(clientPrediction),
       client(client),
@@ -46,20 +58,22 @@ UISystem::UISystem(Window* window, ClientPrediction* clientPrediction,
       selectedCharacterId(0),
       selectionAnimationTime(0.0f),
       keyboardFocusedIndex(-1),
-      showCoordinates(false) {
+      showCoordinates(false),
+      minimapMap(nullptr),
+      minimapTerrainDirty(false),
+      minimapRaster(MINIMAP_WIDTH, MINIMAP_HEIGHT),
+      minimapMarkersTime(-Config::Timing::MINIMAP_MARKER_INTERVAL_S) {
   // Load settings
   settings.load(Settings::DEFAULT_FILENAME);
 
   // Subscribe to keyboard events for navigation
-  EventBus::instance().subscribe<KeyDownEvent>(
-      [this](const KeyDownEvent& e) { onKeyDown(e); });
+  subscriptions.push_back(bus.subscribeScoped<KeyDownEvent>(
+      [this](const KeyDownEvent& e) { onKeyDown(e); }));
 
-  // Load title screen background
+  // Start decoding the title screen background; the title shows at once
+  // and the image appears when its upload lands
   titleScreenBackground =
-      TextureManager::instance().get("assets/uis/blue_zone.png");
-  if (!titleScreenBackground) {
-    Logger::error("Failed to load title screen background");
-  }
+      TextureManager::instance().tryGetRegion(TITLE_BACKGROUND_PATH);
 
   // Load title screen music (SDL_mixer already initialized by MusicSystem)
   titleMusic = Mix_LoadMUS("assets/music/landing_screen.ogg");
@@ -69,7 +83,7 @@ UISystem::UISystem(Window* window, ClientPrediction* clientPrediction,
   }
 
   // Subscribe to state changes to control title music
-  EventBus::instance().subscribe<GameStateChangedEvent>(
+  subscriptions.push_back(bus.subscribeScoped<GameStateChangedEvent>(
       [this](const GameStateChangedEvent& e) {
         // Start title music when entering TitleScreen
         if (e.newState == GameState::TitleScreen && titleMusic) {
@@ -82,7 +96,7 @@ UISystem::UISystem(Window* window, ClientPrediction* clientPrediction,
           Mix_FadeOutMusic(500);  // 500ms fade out
           Logger::info("Faded out title screen music");
         }
-      });
+      }));
 
   // If we're already in TitleScreen state (transition happened before UISystem
   // was created), start the music now
@@ -94,30 +108,31 @@ UISystem::UISystem(Window* window, ClientPrediction* clientPrediction,
     Logger::info("Started title screen music (initial state)");
   }
 
-  EventBus::instance().subscribe<RenderEvent>(
-      [this](const RenderEvent& e) { onRender(e); });
+  subscriptions.push_back(bus.subscribeScoped<RenderEvent>(
+      [this](const RenderEvent& e) { onRender(e); }));
 
-  EventBus::instance().subscribe<ItemPickedUpEvent>(
-      [this](const ItemPickedUpEvent& e) { onItemPickedUp(e); });
+  subscriptions.push_back(bus.subscribeScoped<ItemPickedUpEvent>(
+      [this](const ItemPickedUpEvent& e) { onItemPickedUp(e); }));
 
-  EventBus::instance().subscribe<ObjectiveUpdatedEvent>(
-      [this](const ObjectiveUpdatedEvent& e) { onObjectiveUpdated(e); });
+  subscriptions.push_back(bus.subscribeScoped<ObjectiveUpdatedEvent>(
+      [this](const ObjectiveUpdatedEvent& e) { onObjectiveUpdated(e); }));
 
-  EventBus::instance().subscribe<UpdateEvent>([this](const UpdateEvent& e) {
-    currentTime += e.deltaTime / 1000.0f;  // Convert ms to seconds
+  subscriptions.push_back(
+      bus.subscribeScoped<UpdateEvent>([this](const UpdateEvent& e) {
+        currentTime += e.deltaTime / 1000.0f;  // Convert ms to seconds
 
-    // Remove old notifications (after 3 seconds)
-    while (!notifications.empty() &&
-           currentTime - notifications.front().timestamp > 3.0f) {
-      notifications.pop_front();
-    }
+        // Remove old notifications (after 3 seconds)
+        while (!notifications.empty() &&
+               currentTime - notifications.front().timestamp > 3.0f) {
+          notifications.pop_front();
+        }
 
-    // Remove old objective notifications (after 5 seconds)
-    while (!objectiveNotifications.empty() &&
-           currentTime - objectiveNotifications.front().timestamp > 5.0f) {
-      objectiveNotifications.pop_front();
-    }
-  });
+        // Remove old objective notifications (after 5 seconds)
+        while (!objectiveNotifications.empty() &&
+               currentTime - objectiveNotifications.front().timestamp > 5.0f) {
+          objectiveNotifications.pop_front();
+        }
+      }));
 
   Logger::info("UISystem initialized");
 }
@@ -128,6 +143,11 @@ UISystem::~UISystem() {
   }
 }
 
+void UISystem::setMap(const TiledMap* map) {
+  minimapMap = map;
+  minimapTerrainDirty = true;
+}
+
 void UISystem::onRender(const RenderEvent& e) { render(); }
 
 void UISystem::render() {
@@ -196,6 +216,10 @@ void UISystem::renderTitleScreen() {
   ImVec2 windowSize = ImGui::GetIO().DisplaySize;
 
   // Fullscreen background image
+  if (!titleScreenBackground) {
+    titleScreenBackground =
+        TextureManager::instance().tryGetRegion(TITLE_BACKGROUND_PATH);
+  }
   if (titleScreenBackground) {
     ImGui::SetNextWindowPos(ImVec2(0, 0));
     ImGui::SetNextWindowSize(windowSize);
@@ -205,8 +229,11 @@ void UISystem::renderTitleScreen() {
                      ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoScrollbar |
                      ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoBackground);
 
-    ImGui::Image((ImTextureID)(intptr_t)titleScreenBackground->getID(),
-                 windowSize);
+    ImGui::Image(
+        (ImTextureID)(intptr_t)titleScreenBackground->texture->getID(),
+        windowSize,
+        ImVec2(titleScreenBackground->u1, titleScreenBackground->v1),
+        ImVec2(titleScreenBackground->u2, titleScreenBackground->v2));
 
     ImGui::End();
     ImGui::PopStyleVar();
@@ -338,12 +365,12 @@ void UISystem::renderCharacterSelect() {
         displaySize = portraitSize * 1.1f * pulse;
       }
 
-      // Try to load portrait texture
-      Texture* portrait =
-          TextureManager::instance().get(character.getCharacterPortraitPath());
+      // Portrait if resident (decoding off-thread otherwise)
+      const TextureRegion* portrait = TextureManager::instance().tryGetRegion(
+          character.getCharacterPortraitPath());
 
       // If portrait exists, use it as image button
-      if (portrait && portrait->isLoaded()) {
+      if (portrait) {
         // Create invisible button for click detection (fixed size for layout)
         ImVec2 cursorPos = ImGui::GetCursorScreenPos();
         bool clicked = ImGui::InvisibleButton(
@@ -357,8 +384,10 @@ void UISystem::renderCharacterSelect() {
 
         // Draw texture centered and scaled (doesn't affect layout)
         ImDrawList* drawList = ImGui::GetWindowDrawList();
-        drawList->AddImage((ImTextureID)(intptr_t)portrait->getID(), topLeft,
-                           bottomRight);
+        drawList->AddImage((ImTextureID)(intptr_t)portrait->texture->getID(),
+                           topLeft, bottomRight,
+                           ImVec2(portrait->u1, portrait->v1),
+                           ImVec2(portrait->u2, portrait->v2));
 
         // Draw keyboard focus border (yellow)
         if (isFocused) {
@@ -489,9 +518,9 @@ void UISystem::renderCharacterSelect() {
       ImGui::Spacing();
 
       // Display character using relevant character image asset
-      Texture* playerTexture =
-          TextureManager::instance().get(character->getCharacterPreviewPath());
-      if (playerTexture && playerTexture->isLoaded()) {
+      const TextureRegion* preview = TextureManager::instance().tryGetRegion(
+          character->getCharacterPreviewPath());
+      if (preview) {
         // Calculate preview size (3x game size = 96x96)
         float previewSize = 250.0f;
         float previewSizeY = previewSize * 1.44;
@@ -501,8 +530,13 @@ void UISystem::renderCharacterSelect() {
         float centerX = (350 - previewSize) / 2.0f;
         ImGui::SetCursorPos(ImVec2(centerX, cursorPos.y));
 
-        ImGui::Image((ImTextureID)(intptr_t)playerTexture->getID(),
-                     ImVec2(previewSize, previewSizeY));
+        ImGui::Image((ImTextureID)(intptr_t)preview->texture->getID(),
+                     ImVec2(previewSize, previewSizeY),
+                     ImVec2(preview->u1, preview->v1),
+                     ImVec2(preview->u2, preview->v2));
+      } else if (!GameStateManager::instance().isLoaded(
+                     GameState::CharacterSelect)) {
+        ImGui::TextDisabled("Loading...");
       }
 
       // Future: Show character stats here
@@ -659,12 +693,14 @@ void UISystem::renderHUD() {
         CharacterRegistry::instance().getCharacter(selectedId);
 
     if (character) {
-      Texture* portrait =
-          TextureManager::instance().get(character->getCharacterPortraitPath());
+      const TextureRegion* portrait = TextureManager::instance().tryGetRegion(
+          character->getCharacterPortraitPath());
 
-      if (portrait && portrait->isLoaded()) {
+      if (portrait) {
         // Draw portrait on the left (60x60)
-        ImGui::Image((ImTextureID)(intptr_t)portrait->getID(), ImVec2(60, 60));
+        ImGui::Image((ImTextureID)(intptr_t)portrait->texture->getID(),
+                     ImVec2(60, 60), ImVec2(portrait->u1, portrait->v1),
+                     ImVec2(portrait->u2, portrait->v2));
         ImGui::SameLine();
       }
     }
@@ -1177,8 +1213,23 @@ void UISystem::renderEffectBars() {
     return;
   }
 
-  // Get nearby enemies from enemy interpolation
-  // For now, just show effects in top-right corner for all enemies with effects
+  // Only enemies that have effects and are on screen or being attacked;
+  // the tracker keeps the affected ids, so this never scans the id space
+  double renderTick =
+      enemyInterpolation ? enemyInterpolation->getRenderTick() : 0.0;
+  auto isOnScreen = [&](uint32_t enemyId) {
+    if (!enemyInterpolation || !camera) return false;
+    float x, y;
+    if (!enemyInterpolation->samplePosition(enemyId, renderTick, x, y)) {
+      return false;
+    }
+    int screenX, screenY;
+    camera->worldToScreen(x, y, screenX, screenY);
+    return screenX >= 0 && screenX < camera->screenWidth && screenY >= 0 &&
+           screenY < camera->screenHeight;
+  };
+  effectTracker->collectRelevantEnemies(isOnScreen, effectBarEnemies);
+
   ImGui::SetNextWindowPos(ImVec2(ImGui::GetIO().DisplaySize.x - 210, 10),
                           ImGuiCond_Always);
   ImGui::SetNextWindowSize(ImVec2(200, 0), ImGuiCond_Always);
@@ -1190,15 +1241,9 @@ void UISystem::renderEffectBars() {
   ImGui::Text("Enemy Effects:");
   ImGui::Separator();
 
-  // For now, we'll iterate over all possible enemy IDs (1-100)
-  // In a real implementation, you'd get the list from EnemyInterpolation
   bool foundAny = false;
-  for (uint32_t enemyId = 1; enemyId < 100; ++enemyId) {
+  for (uint32_t enemyId : effectBarEnemies) {
     const auto& effects = effectTracker->getEffects(enemyId, true);
-    if (effects.empty()) {
-      continue;
-    }
-
     foundAny = true;
     ImGui::Text("Enemy %u:", enemyId);
     ImGui::Indent();
@@ -1453,12 +1498,19 @@ void UISystem::onKeyDown(const KeyDownEvent& e) {
 void UISystem::renderMinimap() {
   if (!camera || !clientPrediction) return;
 
-  static constexpr float MAP_W = 200.0f;
-  static constexpr float MAP_H = 150.0f;
+  static constexpr float MAP_W = static_cast<float>(MINIMAP_WIDTH);
+  static constexpr float MAP_H = static_cast<float>(MINIMAP_HEIGHT);
   static constexpr float PADDING = 10.0f;
   const float screenW = static_cast<float>(Config::Screen::WIDTH);
   const float screenH = static_cast<float>(Config::Screen::HEIGHT);
 
+  refreshMinimapTexture();
+  if (currentTime - minimapMarkersTime >=
+      Config::Timing::MINIMAP_MARKER_INTERVAL_S) {
+    refreshMinimapMarkers();
+    minimapMarkersTime = currentTime;
+  }
+
   ImGui::SetNextWindowPos(
       ImVec2(screenW - MAP_W - PADDING, screenH - MAP_H - PADDING),
       ImGuiCond_Always);
@@ -1483,79 +1535,23 @@ void UISystem::renderMinimap() {
     return ImVec2(origin.x + nx * MAP_W, origin.y + ny * MAP_H);
   };
 
+  // Map layout and objectives, baked
+  if (minimapTexture) {
+    draw->AddImage((ImTextureID)(intptr_t)minimapTexture->getID(), origin,
+                   ImVec2(origin.x + MAP_W, origin.y + MAP_H));
+  }
+
   // Draw border
   draw->AddRect(origin, ImVec2(origin.x + MAP_W, origin.y + MAP_H),
                 IM_COL32(200, 200, 200, 200), 0.0f, 0, 1.5f);
 
-  // Draw objectives
-  const auto& objectives = clientPrediction->getObjectives();
-  for (const auto& [id, obj] : objectives) {
-    ImVec2 pos = worldToMinimap(obj.x, obj.y);
-    // Scale objective radius to minimap space
-    float radiusX = obj.radius / camera->worldWidth * MAP_W;
-    float radiusY = obj.radius / camera->worldHeight * MAP_H;
-    float displayRadius = (radiusX + radiusY) * 0.5f;
-    displayRadius = std::max(3.0f, std::min(displayRadius, 20.0f));
-
-    ImU32 color;
-    switch (static_cast<int>(obj.state)) {
-      case 0:  // Inactive
-        color = IM_COL32(180, 180, 60, 200);
-        break;
-      case 1:  // InProgress
-        color = IM_COL32(60, 120, 255, 220);
-        break;
-      case 2:  // ReadyToDeposit
-        color = IM_COL32(255, 140, 0, 220);
-        break;
-      case 3:  // Completed
-        color = IM_COL32(60, 220, 60, 200);
-        break;
-      default:
-        color = IM_COL32(180, 180, 180, 180);
-        break;
-    }
-    draw->AddCircle(pos, displayRadius, color, 0, 1.5f);
-    // Small filled center dot
-    draw->AddCircleFilled(pos, 2.0f, color);
-
-    // Draw deposit point as a diamond marker if present
-    if (obj.state != ObjectiveState::Completed) {
-      ImVec2 dp = worldToMinimap(obj.depositX, obj.depositY);
-      constexpr float D = 5.0f;
-      ImU32 depositColor = IM_COL32(255, 200, 50, 230);
-      draw->AddQuadFilled(ImVec2(dp.x, dp.y - D), ImVec2(dp.x + D, dp.y),
-                          ImVec2(dp.x, dp.y + D), ImVec2(dp.x - D, dp.y),
-                          depositColor);
-      draw->AddQuad(ImVec2(dp.x, dp.y - D), ImVec2(dp.x + D, dp.y),
-                    ImVec2(dp.x, dp.y + D), ImVec2(dp.x - D, dp.y),
-                    IM_COL32(255, 255, 255, 180), 1.0f);
-    }
-  }
-
-  // Draw enemies (red dots)
-  if (enemyInterpolation) {
-    const auto& enemyIds = enemyInterpolation->getEnemyIds();
-    for (uint32_t eid : enemyIds) {
-      Enemy enemy;
-      if (enemyInterpolation->getInterpolatedState(eid, 0.0f, enemy)) {
-        ImVec2 pos = worldToMinimap(enemy.x, enemy.y);
-        draw->AddCircleFilled(pos, 3.0f, IM_COL32(220, 60, 60, 230));
-      }
-    }
-  }
-
-  // Draw remote players (team color dots)
-  if (remoteInterpolation) {
-    const auto& remoteIds = remoteInterpolation->getRemotePlayerIds();
-    for (uint32_t pid : remoteIds) {
-      Player remote;
-      if (remoteInterpolation->getInterpolatedState(pid, 0.0f, remote)) {
-        ImVec2 pos = worldToMinimap(remote.x, remote.y);
-        ImU32 col = IM_COL32(remote.r, remote.g, remote.b, 230);
-        draw->AddCircleFilled(pos, 4.0f, col);
-        draw->AddCircle(pos, 4.0f, IM_COL32(255, 255, 255, 150), 0, 1.0f);
-      }
+  // Enemies and remote players, as of the last marker refresh
+  for (const MinimapMarker& marker : minimapMarkers) {
+    ImVec2 pos = worldToMinimap(marker.x, marker.y);
+    draw->AddCircleFilled(pos, marker.radius, marker.color);
+    if (marker.radius > 3.0f) {
+      draw->AddCircle(pos, marker.radius, IM_COL32(255, 255, 255, 150), 0,
+                      1.0f);
     }
   }
 
@@ -1574,7 +1570,8 @@ void UISystem::renderMinimap() {
                         ImVec2(sp.x + THICK, sp.y + ARM), shipColor);
   }
 
-  // Draw local player (bright white, slightly larger)
+  // Draw local player (bright white, slightly larger); every frame, since
+  // it is what the eye follows
   {
     const Player& local = clientPrediction->getLocalPlayer();
     ImVec2 pos = worldToMinimap(local.x, local.y);
@@ -1584,3 +1581,77 @@ void UISystem::renderMinimap() {
 
   ImGui::End();
 }
+
+void UISystem::refreshMinimapTexture() {
+  // Objectives are baked in too, so a state change redraws the overlay
+  bool objectivesChanged = false;
+  const auto& objectives = clientPrediction->getObjectives();
+  if (objectives.size() != minimapObjectiveStates.size()) {
+    objectivesChanged = true;
+  } else {
+    size_t i = 0;
+    for (const auto& [id, obj] : objectives) {
+      const auto& seen = minimapObjectiveStates[i++];
+      if (seen.first != id || seen.second != obj.state) {
+        objectivesChanged = true;
+        break;
+      }
+    }
+  }
+
+  if (!minimapTerrainDirty && !objectivesChanged) return;
+
+  if (minimapTerrainDirty && minimapMap) {
+    minimapRaster.bakeTerrain(
+        minimapMap->getWidth(), minimapMap->getHeight(),
+        minimapMap->getTileWidth(), minimapMap->getTileHeight(),
+        minimapMap->getTileLayers(), minimapMap->getCollisionShapes(),
+        camera->worldWidth, camera->worldHeight);
+    Logger::info("Baked minimap terrain for " +
+                 std::to_string(minimapMap->getWidth()) + "x" +
+                 std::to_string(minimapMap->getHeight()) + " map");
+  }
+  minimapTerrainDirty = false;
+
+  minimapRaster.clearOverlay();
+  minimapObjectiveStates.clear();
+  for (const auto& [id, obj] : objectives) {
+    minimapRaster.drawObjective(obj.x, obj.y, obj.radius, obj.state,
+                                obj.depositX, obj.depositY);
+    minimapObjectiveStates.emplace_back(id, obj.state);
+  }
+
+  const uint8_t* pixels = minimapRaster.getPixels().data();
+  if (minimapTexture) {
+    minimapTexture->updatePixels(pixels);
+  } else {
+    minimapTexture = std::make_unique<Texture>();
+    minimapTexture->createFromPixels(pixels, minimapRaster.getWidth(),
+                                     minimapRaster.getHeight());
+  }
+}
+
+void UISystem::refreshMinimapMarkers() {
+  minimapMarkers.clear();
+
+  if (enemyInterpolation) {
+    minimapEnemies.clear();
+    enemyInterpolation->appendRenderStates(enemyInterpolation->getRenderTick(),
+                                           minimapEnemies);
+    for (const EnemyRenderState& enemy : minimapEnemies) {
+      minimapMarkers.push_back(
+          {enemy.x, enemy.y, IM_COL32(220, 60, 60, 230), 3.0f});
+    }
+  }
+
+  if (remoteInterpolation) {
+    minimapRemotePlayers.clear();
+    remoteInterpolation->appendRenderStates(
+        remoteInterpolation->getRenderTick(), minimapRemotePlayers);
+    for (const RemotePlayerRenderState& remote : minimapRemotePlayers) {
+      minimapMarkers.push_back(
+          {remote.x, remote.y, IM_COL32(remote.r, remote.g, remote.b, 230),
+           4.0f});
+    }
+  }
+}
@@ -16,8 +16,11 @@
 
 #include "EventBus.h"
 #include "Logger.h"
+#include "OpenGLUtils.h"
 
-Window::Window(const std::string& title, int width, int height) : open(true) {
+Window::Window(const std::string& title, int width, int height, EventBus& bus,
+               bool glDebug)
+    : open(true), bus(bus) {
   if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) != 0) {
     throw std::runtime_error("Failed to initialize SDL: " +
                              std::string(SDL_GetError()));
@@ -32,6 +35,10 @@ Window::Window(const std::string& title, int width, int height) : open(true) {
   SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
   SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
   SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+  if (glDebug) {
+    // Some drivers only emit KHR_debug messages for debug contexts
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_DEBUG_FLAG);
+  }
 #endif
   SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
 
@@ -61,9 +68,16 @@ Window::Window(const std::string& title, int width, int height) : open(true) {
   }
 #endif
 
+  if (glDebug) {
+    OpenGLUtils::enableDebugLayer(SDL_GL_GetProcAddress);
+  }
+
   // Subscribe to swap buffers event
-  EventBus::instance().subscribe<SwapBuffersEvent>(
-      [this](const SwapBuffersEvent& e) { SDL_GL_SwapWindow(sdlWindow); });
+  subscriptions.push_back(bus.subscribeScoped<SwapBuffersEvent>(
+      [this](const SwapBuffersEvent& e) {
+        OpenGLUtils::checkFrameErrors();  // No-op unless FrameCheck mode
+        SDL_GL_SwapWindow(sdlWindow);
+      }));
 }
 
 Window::~Window() {
@@ -98,10 +112,10 @@ void Window::pollEvents() {
                         event.key.keysym.sym == SDLK_i);
 
       if (isMenuKey || !imguiWantsKeyboard) {
-        EventBus::instance().publish(KeyDownEvent{event.key.keysym.sym});
+        bus.publish(KeyDownEvent{event.key.keysym.sym});
       }
     } else if (event.type == SDL_KEYUP && !imguiWantsKeyboard) {
-      EventBus::instance().publish(KeyUpEvent{event.key.keysym.sym});
+      bus.publish(KeyUpEvent{event.key.keysym.sym});
     }
   }
 }
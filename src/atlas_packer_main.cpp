@@ -0,0 +1,190 @@
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "AtlasManifest.h"
+#include "AtlasPacker.h"
+#include "FileSystem.h"
+#include "Logger.h"
+
+namespace {
+
+// Art the client draws through TextureManager::getRegion. Tilesets are left
+// out: TileRenderer addresses them by tile index on their own texture.
+const char* const DEFAULT_INPUTS[] = {
+    "assets/player_animated.png", "assets/ship.png", "assets/portraits",
+    "assets/previews", "assets/uis",
+};
+
+void printUsage(const char* programName) {
+  std::cout << "Usage: " << programName << " [OPTIONS] [INPUT...]\n\n"
+            << "Options:\n"
+            << "  --out PATH        Manifest to write; pages go next to it "
+               "(default: "
+            << AtlasManifest::DEFAULT_PATH << ")\n"
+            << "  --page-size N     Maximum page width and height "
+               "(default: 4096)\n"
+            << "  --padding N       Transparent pixels between images "
+               "(default: 2)\n"
+            << "  --help            Show this help message\n"
+            << "\n"
+            << "AtlasPacker - packs PNG files (or every PNG in a directory)\n"
+            << "into atlas pages plus the lookup table TextureManager reads.\n"
+            << "Without inputs, packs the client's sprites, portraits,\n"
+            << "previews and UI images. Run from the repository root.\n";
+}
+
+bool isPng(const std::string& path) {
+  return path.size() > 4 && path.compare(path.size() - 4, 4, ".png") == 0;
+}
+
+// Expand directories (sorted, so output is reproducible) into PNG paths
+std::vector<std::string> collectImages(const std::vector<std::string>& inputs) {
+  std::vector<std::string> images;
+  for (const std::string& input : inputs) {
+    if (std::filesystem::is_directory(input)) {
+      std::vector<std::string> files = FileSystem::listFiles(input);
+      std::sort(files.begin(), files.end());
+      for (const std::string& file : files) {
+        if (isPng(file)) images.push_back(file);
+      }
+    } else if (isPng(input)) {
+      images.push_back(input);
+    } else {
+      Logger::error("Skipping non-PNG input: " + input);
+    }
+  }
+  return images;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::string manifestPath = AtlasManifest::DEFAULT_PATH;
+  int pageSize = 4096;
+  int padding = 2;
+  std::vector<std::string> inputs;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+      manifestPath = argv[++i];
+    } else if (strcmp(argv[i], "--page-size") == 0 && i + 1 < argc) {
+      pageSize = std::max(64, std::stoi(argv[++i]));
+    } else if (strcmp(argv[i], "--padding") == 0 && i + 1 < argc) {
+      padding = std::max(0, std::stoi(argv[++i]));
+    } else if (strcmp(argv[i], "--help") == 0) {
+      printUsage(argv[0]);
+      return EXIT_SUCCESS;
+    } else if (argv[i][0] != '-') {
+      inputs.push_back(argv[i]);
+    } else {
+      std::cerr << "Unknown option: " << argv[i] << "\n";
+      printUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (inputs.empty()) {
+    inputs.assign(std::begin(DEFAULT_INPUTS), std::end(DEFAULT_INPUTS));
+  }
+
+  Logger::init();
+
+  // Decode everything as RGBA so pages can be assembled with plain copies
+  std::vector<std::string> paths;
+  std::vector<SDL_Surface*> surfaces;
+  for (const std::string& path : collectImages(inputs)) {
+    if (path.find_first_of(" \t") != std::string::npos) {
+      Logger::error("Skipping path with whitespace: " + path);
+      continue;
+    }
+    SDL_Surface* loaded = IMG_Load(path.c_str());
+    if (!loaded) {
+      Logger::error("Failed to load " + path + ": " + IMG_GetError());
+      continue;
+    }
+    SDL_Surface* rgba =
+        SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    if (!rgba) {
+      Logger::error("Failed to convert " + path + ": " + SDL_GetError());
+      continue;
+    }
+    paths.push_back(path);
+    surfaces.push_back(rgba);
+  }
+
+  std::vector<AtlasPacker::Size> sizes;
+  for (SDL_Surface* surface : surfaces) {
+    sizes.push_back(AtlasPacker::Size{surface->w, surface->h});
+  }
+
+  AtlasPacker packer(pageSize, padding);
+  std::vector<AtlasPlacement> placements = packer.pack(sizes);
+
+  std::filesystem::path manifestFile(manifestPath);
+  std::filesystem::path outputDir = manifestFile.parent_path();
+  if (!outputDir.empty()) {
+    std::filesystem::create_directories(outputDir);
+  }
+  std::string stem = manifestFile.stem().string();
+
+  bool ok = true;
+  AtlasManifest manifest;
+  for (int page = 0; page < packer.getPageCount() && ok; ++page) {
+    int width = packer.getUsedWidth(page);
+    int height = packer.getUsedHeight(page);
+    SDL_Surface* pageSurface = SDL_CreateRGBSurfaceWithFormat(
+        0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+    SDL_FillRect(pageSurface, nullptr, 0);  // Transparent padding
+
+    for (size_t i = 0; i < surfaces.size(); ++i) {
+      if (placements[i].page != page) continue;
+      // Copy pixels as-is rather than alpha blending onto the page
+      SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE);
+      SDL_Rect target{placements[i].x, placements[i].y, surfaces[i]->w,
+                      surfaces[i]->h};
+      SDL_BlitSurface(surfaces[i], nullptr, pageSurface, &target);
+    }
+
+    std::string file = stem + "_" + std::to_string(page) + ".png";
+    std::string pagePath = (outputDir / file).string();
+    if (IMG_SavePNG(pageSurface, pagePath.c_str()) != 0) {
+      Logger::error("Failed to write " + pagePath + ": " + IMG_GetError());
+      ok = false;
+    }
+    SDL_FreeSurface(pageSurface);
+
+    manifest.addPage(AtlasPage{file, width, height});
+    Logger::info("Wrote " + pagePath + " (" + std::to_string(width) + "x" +
+                 std::to_string(height) + ")");
+  }
+
+  for (size_t i = 0; i < surfaces.size(); ++i) {
+    const AtlasPlacement& placement = placements[i];
+    if (placement.page < 0) {
+      // Still usable: TextureManager loads unpacked images on their own
+      Logger::info("Not packed (larger than a page): " + paths[i]);
+    } else {
+      manifest.addImage(paths[i],
+                        AtlasEntry{placement.page, placement.x, placement.y,
+                                   surfaces[i]->w, surfaces[i]->h});
+    }
+    SDL_FreeSurface(surfaces[i]);
+  }
+
+  if (!ok || !manifest.save(manifestPath)) {
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Packed " << manifest.getImageCount() << " of " << paths.size()
+            << " images into " << packer.getPageCount() << " pages ("
+            << manifestPath << ")\n";
+  return EXIT_SUCCESS;
+}
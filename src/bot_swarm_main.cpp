@@ -0,0 +1,139 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "BotSwarm.h"
+#include "ItemRegistry.h"
+#include "Logger.h"
+#include "config/NetworkConfig.h"
+#include "config/TimingConfig.h"
+
+void printUsage(const char* programName) {
+  std::cout
+      << "Usage: " << programName << " [OPTIONS]\n\n"
+      << "Options:\n"
+      << "  --bots N          Number of simulated clients (default: 32)\n"
+      << "  --seconds S       Simulated duration (default: 30)\n"
+      << "  --ticks N         Simulated duration in 60 Hz ticks\n"
+      << "  --pattern P       idle | random | circle | zigzag "
+         "(default: random)\n"
+      << "  --seed N          Base RNG seed for random walks (default: 1)\n"
+      << "  --enet            Connect over ENet instead of hosting the "
+         "server in-process\n"
+      << "  --host H          ENet server address (default: "
+      << Config::Network::SERVER_ADDRESS << ")\n"
+      << "  --port P          ENet base port (default: "
+      << Config::Network::PORT << ")\n"
+      << "  --ports K         Spread bots over ports P..P+K-1 (default: 1)\n"
+      << "  --map PATH        Map for the in-process server "
+         "(default: assets/maps/test_map.tmx)\n"
+      << "  --enemies M       Host M enemies around the map's spawn points "
+         "instead of its own\n"
+      << "  --realtime        Pace in-process frames at 60 Hz\n"
+      << "  --check-budget    Fail if the p99 server tick exceeds the "
+         "60 Hz budget\n"
+      << "                    or any in-process message was dropped\n"
+      << "                    (in-process only; not valid with --enet)\n"
+      << "  --help            Show this help message\n"
+      << "\n"
+      << "Bot Swarm - drives many protocol-level clients against one server\n"
+      << "and reports server tick time and bandwidth percentiles. In-process\n"
+      << "runs also report throughput, tick phases, allocations and bytes\n"
+      << "serialized per tick (soak: --bots K --enemies M --ticks N)\n";
+}
+
+int main(int argc, char* argv[]) {
+  BotSwarmConfig config;
+  bool checkBudget = false;
+  config.host = Config::Network::SERVER_ADDRESS;
+  config.port = static_cast<uint16_t>(Config::Network::PORT);
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--bots") == 0 && i + 1 < argc) {
+      config.botCount = std::stoul(argv[++i]);
+    } else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+      config.frames = std::stoull(argv[++i]) * Config::Timing::TARGET_FPS;
+    } else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+      config.frames = std::stoull(argv[++i]);
+    } else if (strcmp(argv[i], "--pattern") == 0 && i + 1 < argc) {
+      if (!parseBotPattern(argv[++i], config.pattern)) {
+        std::cerr << "Unknown pattern: " << argv[i] << "\n";
+        return EXIT_FAILURE;
+      }
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      config.seed = static_cast<uint32_t>(std::stoul(argv[++i]));
+    } else if (strcmp(argv[i], "--enet") == 0) {
+      config.inProcess = false;
+    } else if (strcmp(argv[i], "--host") == 0 && i + 1 < argc) {
+      config.host = argv[++i];
+    } else if (strcmp(argv[i], "--port") == 0 && i + 1 < argc) {
+      config.port = static_cast<uint16_t>(std::stoul(argv[++i]));
+    } else if (strcmp(argv[i], "--ports") == 0 && i + 1 < argc) {
+      config.portCount = std::stoul(argv[++i]);
+    } else if (strcmp(argv[i], "--map") == 0 && i + 1 < argc) {
+      config.mapPath = argv[++i];
+    } else if (strcmp(argv[i], "--enemies") == 0 && i + 1 < argc) {
+      config.enemyCount = std::stoul(argv[++i]);
+    } else if (strcmp(argv[i], "--realtime") == 0) {
+      config.realtime = true;
+    } else if (strcmp(argv[i], "--check-budget") == 0) {
+      checkBudget = true;
+    } else if (strcmp(argv[i], "--help") == 0) {
+      printUsage(argv[0]);
+      return EXIT_SUCCESS;
+    } else {
+      std::cerr << "Unknown option: " << argv[i] << "\n";
+      printUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (config.botCount == 0 || config.portCount == 0) {
+    std::cerr << "--bots and --ports must be at least 1\n";
+    return EXIT_FAILURE;
+  }
+
+  // Server ticks are only timed when the server runs in this process
+  if (checkBudget && !config.inProcess) {
+    std::cerr << "--check-budget needs the in-process server; it cannot "
+                 "measure an --enet server\n";
+    return EXIT_FAILURE;
+  }
+
+  Logger::init();
+
+  // The in-process server needs item definitions for loot drops
+  if (config.inProcess &&
+      !ItemRegistry::instance().loadFromCSV("assets/items.csv")) {
+    Logger::error("Failed to load items.csv - inventory will be empty");
+  }
+
+  BotSwarm swarm(config);
+  if (!swarm.start()) {
+    Logger::error("BotSwarm: Failed to start");
+    return EXIT_FAILURE;
+  }
+
+  BotSwarmReport report = swarm.run();
+  printBotSwarmReport(report, std::cout);
+
+  if (checkBudget && report.serverTickMs.count == 0) {
+    std::cerr << "No server ticks were measured; cannot check the budget\n";
+    return EXIT_FAILURE;
+  }
+  if (checkBudget && report.messagesDropped > 0) {
+    std::cerr << report.messagesDropped
+              << " messages were dropped by full or undersized channel "
+                 "rings; the measured ticks don't reflect the real traffic\n";
+    return EXIT_FAILURE;
+  }
+  if (checkBudget &&
+      report.serverTickMs.p99 > Config::Timing::TARGET_DELTA_MS) {
+    std::cerr << "p99 server tick " << report.serverTickMs.p99
+              << "ms is over the " << Config::Timing::TARGET_DELTA_MS
+              << "ms budget\n";
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
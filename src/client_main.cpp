@@ -1,7 +1,9 @@
+#include <future>
 #include <memory>
 
 #include "AnimationAssetLoader.h"
 #include "AnimationSystem.h"
+#include "AssetLoader.h"
 #include "Camera.h"
 #include "CharacterRegistry.h"
 #include "CharacterSelectionState.h"
@@ -25,9 +27,11 @@
 #include "NetworkProtocol.h"
 #include "Objective.h"
 #include "ObjectiveDebugRenderer.h"
+#include "OpenGLUtils.h"
 #include "RemotePlayerInterpolation.h"
 #include "RenderSystem.h"
 #include "TestInputReader.h"
+#include "TextureManager.h"
 #include "TileRenderer.h"
 #include "TiledMap.h"
 #include "UISystem.h"
@@ -46,6 +50,7 @@ int main(int argc, char* argv[]) {
 
   // Parse command line arguments
   bool embeddedMode = false;
+  bool glDebug = OpenGLUtils::DEBUG_LAYER_DEFAULT;
   for (int i = 1; i < argc; i++) {
     std::string arg = argv[i];
     if (arg == "--test-mode") {
@@ -54,6 +59,8 @@ int main(int argc, char* argv[]) {
     } else if (arg == "--embedded") {
       embeddedMode = true;
       Logger::info("Embedded server mode enabled");
+    } else if (arg == "--gl-debug") {
+      glDebug = true;
     }
   }
 
@@ -62,6 +69,10 @@ int main(int argc, char* argv[]) {
     Logger::error("Failed to load items.csv - inventory will be empty");
   }
 
+  // Every client system is handed this bus. It is the process default
+  // because GameStateManager publishes state changes there.
+  EventBus& bus = EventBus::instance();
+
   // Create client with appropriate transport
   std::unique_ptr<GameSession> gameSession;
   NetworkClient* clientPtr = nullptr;
@@ -77,7 +88,7 @@ int main(int argc, char* argv[]) {
   } else {
     // Network mode: connect to remote server
     static auto transport = std::make_unique<ENetTransport>();
-    static NetworkClient networkClient(std::move(transport));
+    static NetworkClient networkClient(std::move(transport), bus);
     if (!networkClient.connect(Config::Network::SERVER_ADDRESS,
                                Config::Network::PORT)) {
       return EXIT_FAILURE;
@@ -87,16 +98,44 @@ int main(int argc, char* argv[]) {
 
   NetworkClient& client = *clientPtr;
 
+  // Parse the map on a worker while the window and GL context come up
+  TiledMap map;
+  std::string mapPath = MapSelectionState::instance().getSelectedMapPath();
+  std::future<bool> mapLoaded = AssetLoader::instance().submit(
+      [&map, mapPath]() { return map.load(mapPath); });
+
   // Start in title screen
   GameStateManager::instance().transitionTo(GameState::TitleScreen);
 
-  Window window("Gambit Client", Config::Screen::WIDTH, Config::Screen::HEIGHT);
+  Window window("Gambit Client", Config::Screen::WIDTH, Config::Screen::HEIGHT,
+                bus, glDebug);
   window.initImGui();
-  GameLoop gameLoop;
 
-  TiledMap map;
-  std::string mapPath = MapSelectionState::instance().getSelectedMapPath();
-  assert(map.load(mapPath) && "Failed to load required map");
+  // Packed sprites/portraits/UI, if AtlasPacker has been run
+  TextureManager::instance().loadAtlas();
+  GameLoop gameLoop(bus);
+
+  // Finish background asset uploads at the start of each frame, within the
+  // AssetLoader budget
+  bus.subscribe<RenderEvent>(
+      [](const RenderEvent& e) { AssetLoader::instance().pump(); });
+
+  // Menu art decodes in the background: the title screen comes up without
+  // waiting and character select shows placeholders until portraits land
+  std::vector<std::string> characterArt;
+  for (const auto& character :
+       CharacterRegistry::instance().getAllCharacters()) {
+    characterArt.push_back(character.getCharacterPortraitPath());
+    characterArt.push_back(character.getCharacterPreviewPath());
+  }
+  GameStateManager::instance().addLoadingFuture(
+      GameState::CharacterSelect,
+      TextureManager::instance().prefetch(characterArt));
+
+  if (!mapLoaded.get()) {
+    Logger::error("Failed to load required map: " + mapPath);
+    return EXIT_FAILURE;
+  }
 
   CollisionSystem collisionSystem(map.getCollisionShapes());
   Logger::info("Client collision system initialized");
@@ -110,44 +149,47 @@ int main(int argc, char* argv[]) {
   uint32_t localPlayerId = (uint32_t)(uintptr_t)&client;
   WorldConfig world(map.getWorldWidth(), map.getWorldHeight(),
                     &collisionSystem);
-  ClientPrediction clientPrediction(&client, localPlayerId, world);
+  ClientPrediction clientPrediction(&client, localPlayerId, world, bus);
 
   ObjectiveDebugRenderer objectiveDebugRenderer(&camera, &clientPrediction);
 
   InputSystem inputSystem(&clientPrediction, &collisionDebugRenderer,
-                          &musicZoneDebugRenderer, &objectiveDebugRenderer);
+                          &musicZoneDebugRenderer, &objectiveDebugRenderer,
+                          bus);
 
   // Initialize animation system first
-  AnimationSystem animationSystem;
+  AnimationSystem animationSystem(bus);
 
   // Create music system (zone-based)
-  MusicSystem musicSystem(&clientPrediction, &map);
+  MusicSystem musicSystem(&clientPrediction, &map, bus);
 
   // Create remote player interpolation with animation system
   RemotePlayerInterpolation remoteInterpolation(localPlayerId,
-                                                &animationSystem);
+                                                &animationSystem, bus);
 
   // Create enemy interpolation with animation system
-  EnemyInterpolation enemyInterpolation(&animationSystem);
+  EnemyInterpolation enemyInterpolation(&animationSystem, bus);
 
   // Create combat system
-  CombatSystem combatSystem(&client, &clientPrediction, &enemyInterpolation);
+  CombatSystem combatSystem(&client, &clientPrediction, &enemyInterpolation,
+                            bus);
 
   RenderSystem renderSystem(&window, &clientPrediction, &remoteInterpolation,
                             &enemyInterpolation, &camera, &map,
                             &collisionDebugRenderer, &musicZoneDebugRenderer,
-                            &objectiveDebugRenderer);
+                            &objectiveDebugRenderer, bus);
 
   // Create damage number system
-  DamageNumberSystem damageNumberSystem(&camera,
-                                        renderSystem.getSpriteRenderer());
+  DamageNumberSystem damageNumberSystem(
+      &camera, renderSystem.getSpriteRenderer(), bus);
 
   // Create effect tracker
-  EffectTracker effectTracker;
+  EffectTracker effectTracker(bus);
 
   UISystem uiSystem(&window, &clientPrediction, &client, &damageNumberSystem,
                     &effectTracker, &remoteInterpolation, &enemyInterpolation,
-                    &camera);
+                    &camera, bus);
+  uiSystem.setMap(&map);
 
   // Load local player animations
   Player& localPlayer = clientPrediction.getLocalPlayerMutable();
@@ -205,7 +247,7 @@ int main(int argc, char* argv[]) {
   }
 
   // Subscribe to UpdateEvent for network processing
-  EventBus::instance().subscribe<UpdateEvent>([&](const UpdateEvent& e) {
+  bus.subscribe<UpdateEvent>([&](const UpdateEvent& e) {
     // Test mode: process input commands and capture screenshots
     if (Config::TestMode::testConfig.enabled && testInputReader) {
       testInputReader->tick();
@@ -309,7 +351,7 @@ int main(int argc, char* argv[]) {
 
     // Process network events (embedded mode ticks both server and client)
     if (gameSession) {
-      gameSession->tick();
+      gameSession->tick(e);
     } else {
       client.run();
     }
@@ -356,18 +398,17 @@ int main(int argc, char* argv[]) {
 
   // Subscribe to LocalInputEvent for testing (log when any input changes)
   bool lastInputState = false;
-  EventBus::instance().subscribe<LocalInputEvent>(
-      [&](const LocalInputEvent& e) {
-        bool hasInput = e.moveLeft || e.moveRight || e.moveUp || e.moveDown;
-        if (hasInput && !lastInputState) {
-          Logger::info("Input active - L:" + std::to_string(e.moveLeft) +
-                       " R:" + std::to_string(e.moveRight) +
-                       " U:" + std::to_string(e.moveUp) +
-                       " D:" + std::to_string(e.moveDown) +
-                       " Seq:" + std::to_string(e.inputSequence));
-        }
-        lastInputState = hasInput;
-      });
+  bus.subscribe<LocalInputEvent>([&](const LocalInputEvent& e) {
+    bool hasInput = e.moveLeft || e.moveRight || e.moveUp || e.moveDown;
+    if (hasInput && !lastInputState) {
+      Logger::info("Input active - L:" + std::to_string(e.moveLeft) +
+                   " R:" + std::to_string(e.moveRight) +
+                   " U:" + std::to_string(e.moveUp) +
+                   " D:" + std::to_string(e.moveDown) +
+                   " Seq:" + std::to_string(e.inputSequence));
+    }
+    lastInputState = hasInput;
+  });
 
   // Set up objective event handlers (InteractInputEvent + ObjectiveState
   // packets) in ClientPrediction (shared with WASM client)
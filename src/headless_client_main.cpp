@@ -89,8 +89,12 @@ int main(int argc, char* argv[]) {
     Logger::error("Failed to load items.csv - inventory will be empty");
   }
 
+  // Every client system is handed this bus. It is the process default
+  // because GameStateManager publishes state changes there.
+  EventBus& bus = EventBus::instance();
+
   auto transport = std::make_unique<ENetTransport>();
-  NetworkClient client(std::move(transport));
+  NetworkClient client(std::move(transport), bus);
   if (!client.connect(Config::Network::SERVER_ADDRESS, Config::Network::PORT)) {
     return EXIT_FAILURE;
   }
@@ -102,7 +106,7 @@ int main(int argc, char* argv[]) {
   MockWindow window("Headless Gambit Client", Config::Screen::WIDTH,
                     Config::Screen::HEIGHT);
   window.initImGui();
-  GameLoop gameLoop;
+  GameLoop gameLoop(bus);
 
   TiledMap map;
   assert(map.load("assets/maps/test_map.tmx") && "Failed to load required map");
@@ -116,40 +120,41 @@ int main(int argc, char* argv[]) {
   uint32_t localPlayerId = (uint32_t)(uintptr_t)&client;
   WorldConfig world(map.getWorldWidth(), map.getWorldHeight(),
                     &collisionSystem);
-  ClientPrediction clientPrediction(&client, localPlayerId, world);
+  ClientPrediction clientPrediction(&client, localPlayerId, world, bus);
 
   // Create input script for programmatic input
-  InputScript inputScript;
+  InputScript inputScript(bus);
   window.setInputScript(&inputScript);
 
   // Note: Headless mode doesn't use CollisionDebugRenderer or
   // MusicZoneDebugRenderer
-  InputSystem inputSystem(&clientPrediction, nullptr, nullptr);
+  InputSystem inputSystem(&clientPrediction, nullptr, nullptr, nullptr, bus);
 
   // Initialize animation system
-  AnimationSystem animationSystem;
+  AnimationSystem animationSystem(bus);
 
   // Create music system (zone-based)
-  MusicSystem musicSystem(&clientPrediction, &map);
+  MusicSystem musicSystem(&clientPrediction, &map, bus);
 
   // Create remote player interpolation with animation system
   RemotePlayerInterpolation remoteInterpolation(localPlayerId,
-                                                &animationSystem);
+                                                &animationSystem, bus);
 
   // Create enemy interpolation with animation system
-  EnemyInterpolation enemyInterpolation(&animationSystem);
+  EnemyInterpolation enemyInterpolation(&animationSystem, bus);
 
   // Create combat system
-  CombatSystem combatSystem(&client, &clientPrediction, &enemyInterpolation);
+  CombatSystem combatSystem(&client, &clientPrediction, &enemyInterpolation,
+                            bus);
 
   // Use HeadlessRenderSystem instead of RenderSystem
-  HeadlessRenderSystem renderSystem;
+  HeadlessRenderSystem renderSystem(bus);
 
   // Create effect tracker
-  EffectTracker effectTracker;
+  EffectTracker effectTracker(bus);
 
   // Use HeadlessUISystem instead of UISystem
-  HeadlessUISystem uiSystem;
+  HeadlessUISystem uiSystem(bus);
 
   // Load local player animations (no texture needed in headless mode)
   Player& localPlayer = clientPrediction.getLocalPlayerMutable();
@@ -200,7 +205,7 @@ int main(int argc, char* argv[]) {
   uint64_t currentFrame = 0;
 
   // Subscribe to UpdateEvent for network processing and frame tracking
-  EventBus::instance().subscribe<UpdateEvent>([&](const UpdateEvent& e) {
+  bus.subscribe<UpdateEvent>([&](const UpdateEvent& e) {
     currentFrame = e.frameNumber;
 
     // Update window's frame number for input scripting
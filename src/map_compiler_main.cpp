@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CompiledMap.h"
+#include "FileSystem.h"
+#include "Logger.h"
+#include "TiledMap.h"
+
+namespace {
+
+const char* const DEFAULT_MAP_DIRECTORY = "assets/maps";
+
+void printUsage(const char* programName) {
+  std::cout << "Usage: " << programName << " [OPTIONS] [MAP.tmx...]\n\n"
+            << "Options:\n"
+            << "  --out PATH        Output file (one input only; default: "
+               "the input with a "
+            << CompiledMap::EXTENSION << " extension)\n"
+            << "  --help            Show this help message\n"
+            << "\n"
+            << "MapCompiler - compiles Tiled TMX maps into the flat binary\n"
+            << "format TiledMap::load maps and uses without parsing. The TMX\n"
+            << "stays the source: a map whose .tmx is newer than its "
+            << CompiledMap::EXTENSION << "\n"
+            << "is parsed from TMX until recompiled. Without inputs, compiles\n"
+            << "every map in " << DEFAULT_MAP_DIRECTORY
+            << ". Run from the repository root.\n";
+}
+
+bool isTmx(const std::string& path) {
+  return std::filesystem::path(path).extension() == ".tmx";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::string outPath;
+  std::vector<std::string> inputs;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+      outPath = argv[++i];
+    } else if (strcmp(argv[i], "--help") == 0) {
+      printUsage(argv[0]);
+      return EXIT_SUCCESS;
+    } else if (argv[i][0] != '-') {
+      inputs.push_back(argv[i]);
+    } else {
+      std::cerr << "Unknown option: " << argv[i] << "\n";
+      printUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (inputs.empty()) {
+    for (const std::string& file :
+         FileSystem::listFiles(DEFAULT_MAP_DIRECTORY)) {
+      if (isTmx(file)) inputs.push_back(file);
+    }
+    std::sort(inputs.begin(), inputs.end());
+  }
+  if (!outPath.empty() && inputs.size() != 1) {
+    std::cerr << "--out needs exactly one input map\n";
+    return EXIT_FAILURE;
+  }
+
+  Logger::init();
+
+  int failures = 0;
+  for (const std::string& input : inputs) {
+    TiledMap map;
+    std::string output =
+        outPath.empty() ? CompiledMap::pathFor(input) : outPath;
+    if (!map.loadTmx(input) || !CompiledMap::write(map, output)) {
+      failures++;
+      continue;
+    }
+
+    // Read it back so a bad file fails here rather than at server start
+    TiledMap check;
+    if (!CompiledMap::read(output, check)) {
+      failures++;
+      continue;
+    }
+    std::cout << "Compiled " << input << " -> " << output << " ("
+              << std::filesystem::file_size(output) << " bytes)\n";
+  }
+
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "ItemRegistry.h"
+#include "Logger.h"
+#include "Match.h"
+#include "ReplayLog.h"
+#include "SharedWorld.h"
+#include "WorldConfig.h"
+#include "config/ScreenConfig.h"
+#include "config/TimingConfig.h"
+#include "transport/ReplayServerTransport.h"
+
+void printUsage(const char* programName) {
+  std::cout << "Usage: " << programName << " [OPTIONS] REPLAY_FILE\n\n"
+            << "Options:\n"
+            << "  --map PATH        Override the map stored in the log\n"
+            << "  --repeat N        Replay N times and check every run "
+               "produces identical output (default: 1)\n"
+            << "  --help            Show this help message\n"
+            << "\n"
+            << "Replay - re-simulates a match recorded with Server --record\n"
+            << "as fast as possible and reports tick timings\n";
+}
+
+struct ReplayRun {
+  uint64_t ticks = 0;
+  double wallSeconds = 0.0;
+  double maxTickMs = 0.0;
+  uint64_t outputHash = 0;
+  uint64_t bytesSent = 0;
+};
+
+ReplayRun replayOnce(ReplayReader& reader, const WorldConfig& world) {
+  auto transport = std::make_unique<ReplayServerTransport>(reader);
+  ReplayServerTransport* replay = transport.get();
+  Match match(0, std::move(transport), world, reader.getRngSeed());
+  match.initialize("replay", 0);
+
+  ReplayRun run;
+  auto runStart = std::chrono::steady_clock::now();
+  while (true) {
+    replay->setTick(match.getFrameNumber());
+    if (replay->isFinished()) break;
+
+    auto tickStart = std::chrono::steady_clock::now();
+    match.tick();
+    double tickMs = std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - tickStart)
+                        .count();
+    run.maxTickMs = std::max(run.maxTickMs, tickMs);
+  }
+  run.wallSeconds = std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - runStart)
+                        .count();
+  run.ticks = match.getFrameNumber();
+  run.outputHash = replay->getOutputHash();
+  run.bytesSent = replay->getBytesSent();
+  return run;
+}
+
+int main(int argc, char* argv[]) {
+  std::string replayPath;
+  std::string mapOverride;
+  int repeat = 1;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--map") == 0 && i + 1 < argc) {
+      mapOverride = argv[++i];
+    } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+      repeat = std::max(1, std::stoi(argv[++i]));
+    } else if (strcmp(argv[i], "--help") == 0) {
+      printUsage(argv[0]);
+      return EXIT_SUCCESS;
+    } else if (argv[i][0] != '-' && replayPath.empty()) {
+      replayPath = argv[i];
+    } else {
+      std::cerr << "Unknown option: " << argv[i] << "\n";
+      printUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (replayPath.empty()) {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  Logger::init();
+
+  ReplayReader reader;
+  if (!reader.open(replayPath)) {
+    return EXIT_FAILURE;
+  }
+
+  if (!ItemRegistry::instance().loadFromCSV("assets/items.csv")) {
+    Logger::error("Failed to load items.csv - inventory will be empty");
+  }
+
+  // Same world the recording server ran: its map, or plain bounds if none
+  std::string mapPath = mapOverride.empty() ? reader.getMapPath() : mapOverride;
+  WorldConfig world(static_cast<float>(Config::Screen::WIDTH),
+                    static_cast<float>(Config::Screen::HEIGHT));
+  SharedWorld sharedWorld;
+  if (!mapPath.empty()) {
+    if (!sharedWorld.load(mapPath)) {
+      return EXIT_FAILURE;
+    }
+    world = sharedWorld.getWorldConfig();
+  }
+
+  bool deterministic = true;
+  ReplayRun first;
+  for (int i = 0; i < repeat; ++i) {
+    ReplayRun run = replayOnce(reader, world);
+    double recordedSeconds =
+        run.ticks * Config::Timing::TARGET_DELTA_MS / 1000.0;
+
+    std::cout << std::fixed << std::setprecision(2) << "Run " << (i + 1)
+              << ": " << run.ticks << " ticks (" << recordedSeconds
+              << " s of play) in " << run.wallSeconds << " s, "
+              << (run.wallSeconds > 0.0 ? run.ticks / run.wallSeconds : 0.0)
+              << " ticks/s, "
+              << (run.ticks > 0 ? run.wallSeconds * 1000.0 / run.ticks : 0.0)
+              << " ms/tick avg, " << run.maxTickMs << " ms max, "
+              << run.bytesSent << " bytes out, hash " << std::hex
+              << run.outputHash << std::dec << "\n";
+
+    if (i == 0) {
+      first = run;
+    } else if (run.outputHash != first.outputHash ||
+               run.ticks != first.ticks) {
+      deterministic = false;
+    }
+  }
+
+  if (repeat > 1) {
+    std::cout << (deterministic ? "All runs identical\n"
+                                : "MISMATCH: runs diverged\n");
+  }
+  return deterministic ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,63 +1,143 @@
+#include <algorithm>
 #include <cassert>
 #include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
-#include "CollisionSystem.h"
-#include "EventBus.h"
-#include "GameLoop.h"
 #include "ItemRegistry.h"
 #include "Logger.h"
-#include "NetworkServer.h"
-#include "ServerGameState.h"
-#include "TiledMap.h"
-#include "WorldConfig.h"
+#include "Match.h"
+#include "MatchScheduler.h"
+#include "Metrics.h"
+#include "MetricsExporter.h"
+#include "SharedWorld.h"
 #include "config/NetworkConfig.h"
+#include "config/TimingConfig.h"
 #include "transport/ENetServerTransport.h"
 
 volatile bool serverRunning = true;
 
 void signalHandler(int signum) { serverRunning = false; }
 
-int main() {
+void printUsage(const char* programName) {
+  std::cout << "Usage: " << programName << " [OPTIONS]\n\n"
+            << "Options:\n"
+            << "  --matches N       Host N independent matches (default: 1)\n"
+            << "                    Match i listens on port "
+            << Config::Network::PORT << " + i\n"
+            << "  --threads N       Worker threads ticking matches "
+               "(default: min(matches, hardware threads))\n"
+            << "  --record PATH     Write a replay log per match "
+               "(PATH, or PATH.<i> with several matches)\n"
+            << "  --metrics TARGET  Export Prometheus metrics to a file, "
+               "or unix:<path> to serve them on a socket\n"
+            << "  --help            Show this help message\n";
+}
+
+int main(int argc, char* argv[]) {
+  size_t matchCount = 1;
+  size_t threadCount = 0;  // 0 = pick from hardware
+  std::string recordPath;
+  std::string metricsTarget;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--matches") == 0 && i + 1 < argc) {
+      matchCount = std::stoul(argv[++i]);
+    } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      threadCount = std::stoul(argv[++i]);
+    } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+      recordPath = argv[++i];
+    } else if (strcmp(argv[i], "--metrics") == 0 && i + 1 < argc) {
+      metricsTarget = argv[++i];
+    } else if (strcmp(argv[i], "--help") == 0) {
+      printUsage(argv[0]);
+      return EXIT_SUCCESS;
+    } else {
+      std::cerr << "Unknown option: " << argv[i] << "\n";
+      printUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (matchCount == 0) {
+    std::cerr << "--matches must be at least 1\n";
+    return EXIT_FAILURE;
+  }
+  if (threadCount == 0) {
+    size_t hardwareThreads =
+        std::max<size_t>(1, std::thread::hardware_concurrency());
+    threadCount = std::min(matchCount, hardwareThreads);
+  }
+
   Logger::init();
   signal(SIGINT, signalHandler);
 
-  // Load item definitions
+  // Registries are loaded once and only read by matches afterwards
   if (!ItemRegistry::instance().loadFromCSV("assets/items.csv")) {
     Logger::error("Failed to load items.csv - inventory will be empty");
   }
 
-  auto transport = std::make_unique<ENetServerTransport>();
-  NetworkServer server(std::move(transport));
-  if (!server.initialize(Config::Network::SERVER_BIND_ADDRESS,
-                         Config::Network::PORT)) {
+  // Server uses default map (could be made configurable via command line)
+  const std::string mapPath = "assets/maps/test_map.tmx";
+  SharedWorld sharedWorld;
+  if (!sharedWorld.load(mapPath)) {
+    assert(false && "Failed to load required map");
     return EXIT_FAILURE;
   }
+  WorldConfig world = sharedWorld.getWorldConfig();
 
-  TiledMap map;
-  // Server uses default map (could be made configurable via command line)
-  assert(map.load("assets/maps/test_map.tmx") && "Failed to load required map");
-
-  CollisionSystem collisionSystem(map.getCollisionShapes());
-  Logger::info("Collision system initialized with " +
-               std::to_string(map.getCollisionShapes().size()) + " shapes");
+  std::vector<std::unique_ptr<Match>> matches;
+  matches.reserve(matchCount);
+  for (size_t i = 0; i < matchCount; ++i) {
+    auto match = std::make_unique<Match>(
+        static_cast<uint32_t>(i), std::make_unique<ENetServerTransport>(),
+        world);
+    uint16_t port = static_cast<uint16_t>(Config::Network::PORT + i);
+    if (!match->initialize(Config::Network::SERVER_BIND_ADDRESS, port)) {
+      return EXIT_FAILURE;
+    }
+    if (!recordPath.empty()) {
+      std::string path = matchCount == 1
+                             ? recordPath
+                             : recordPath + "." + std::to_string(i);
+      if (!match->startRecording(path, mapPath)) {
+        return EXIT_FAILURE;
+      }
+    }
+    matches.push_back(std::move(match));
+  }
 
-  GameLoop gameLoop;
-  WorldConfig world(map.getWorldWidth(), map.getWorldHeight(), &collisionSystem,
-                    &map);
-  ServerGameState gameState(&server, world);
+  std::unique_ptr<MetricsExporter> metricsExporter;
+  if (!metricsTarget.empty()) {
+    metricsExporter = std::make_unique<MetricsExporter>(
+        MetricsRegistry::instance(), metricsTarget,
+        Config::Timing::METRICS_EXPORT_INTERVAL_MS);
+    if (!metricsExporter->start()) {
+      return EXIT_FAILURE;
+    }
+  }
 
-  // Subscribe to UpdateEvent to process network events
-  EventBus::instance().subscribe<UpdateEvent>([&](const UpdateEvent& e) {
-    server.poll();  // Process network events
+  Logger::info("Hosting " + std::to_string(matchCount) + " match(es) on " +
+               std::to_string(threadCount) + " thread(s)");
 
-    if (!serverRunning) {
-      gameLoop.stop();
+  // Scheduler is destroyed (workers joined) before the matches it ticks
+  {
+    MatchScheduler scheduler(threadCount);
+    for (auto& match : matches) {
+      scheduler.addMatch(match.get());
     }
-  });
+    scheduler.run(serverRunning);
+  }
 
-  // Run the game loop (which will drive ServerGameState updates)
-  gameLoop.run();
+  // Last export while the matches (and their gauges) still exist
+  if (metricsExporter) {
+    metricsExporter->stop();
+  }
 
   Logger::info("Server shutting down");
   return EXIT_SUCCESS;
@@ -3,9 +3,24 @@
 #include <cstdint>
 
 #include "Logger.h"
+#include "Metrics.h"
+
+namespace {
+
+constexpr const char* RTT_METRIC = "gambit_client_rtt_ms";
+
+// Received packets are lent to the caller and destroyed once it lets go
+void destroyPacket(void* packet) {
+  enet_packet_destroy(static_cast<ENetPacket*>(packet));
+}
+
+}  // namespace
 
 ENetServerTransport::ENetServerTransport()
-    : server(nullptr), nextClientId(1) {}
+    : server(nullptr),
+      nextClientId(1),
+      connectedClients(&MetricsRegistry::instance().gauge(
+          "gambit_connected_clients", "Clients connected to this server")) {}
 
 ENetServerTransport::~ENetServerTransport() {
   if (server != nullptr) {
@@ -25,6 +40,7 @@ bool ENetServerTransport::initialize(const std::string& address,
   ENetAddress addr;
   enet_address_set_host(&addr, address.c_str());
   addr.port = port;
+  listenPort = port;
 
   server = enet_host_create(&addr, 32, 2, 0, 0);
   if (server == nullptr) {
@@ -56,6 +72,11 @@ bool ENetServerTransport::poll(TransportEvent& event) {
       event.clientId = clientId;
       event.data.clear();
 
+      connectedClients->add(1.0);
+      clientRtt[clientId] = &MetricsRegistry::instance().gauge(
+          RTT_METRIC, "Round-trip time to each client, as ENet estimates it",
+          rttLabels(clientId));
+
       Logger::info("Client " + std::to_string(clientId) + " connected");
       return true;
     }
@@ -65,10 +86,13 @@ bool ENetServerTransport::poll(TransportEvent& event) {
 
       event.type = TransportEventType::RECEIVE;
       event.clientId = clientId;
-      event.data.assign(enetEvent.packet->data,
-                        enetEvent.packet->data + enetEvent.packet->dataLength);
+      event.data.borrow(enetEvent.packet->data, enetEvent.packet->dataLength,
+                        enetEvent.packet, destroyPacket);
 
-      enet_packet_destroy(enetEvent.packet);
+      auto rtt = clientRtt.find(clientId);
+      if (rtt != clientRtt.end()) {
+        rtt->second->set(enetEvent.peer->roundTripTime);
+      }
       return true;
     }
 
@@ -80,6 +104,10 @@ bool ENetServerTransport::poll(TransportEvent& event) {
       event.data.clear();
 
       clientPeers.erase(clientId);
+      if (clientRtt.erase(clientId) > 0) {
+        connectedClients->add(-1.0);
+        MetricsRegistry::instance().remove(RTT_METRIC, rttLabels(clientId));
+      }
 
       Logger::info("Client " + std::to_string(clientId) + " disconnected");
       return true;
@@ -114,7 +142,19 @@ void ENetServerTransport::broadcast(const uint8_t* data, size_t length) {
   enet_host_flush(server);
 }
 
+std::string ENetServerTransport::rttLabels(uint32_t clientId) const {
+  return "port=\"" + std::to_string(listenPort) + "\",client=\"" +
+         std::to_string(clientId) + "\"";
+}
+
 void ENetServerTransport::stop() {
+  // Clients still connected no longer count
+  for (const auto& [clientId, gauge] : clientRtt) {
+    connectedClients->add(-1.0);
+    MetricsRegistry::instance().remove(RTT_METRIC, rttLabels(clientId));
+  }
+  clientRtt.clear();
+
   if (server != nullptr) {
     enet_host_destroy(server);
     server = nullptr;
@@ -2,6 +2,15 @@
 
 #include "Logger.h"
 
+namespace {
+
+// The packet backs the event's payload until the caller clears it
+void destroyPacket(void* packet) {
+  enet_packet_destroy(static_cast<ENetPacket*>(packet));
+}
+
+}  // namespace
+
 ENetTransport::ENetTransport()
     : client(nullptr), peer(nullptr), connected(false) {}
 
@@ -86,9 +95,8 @@ bool ENetTransport::poll(TransportEvent& event) {
   if (enet_host_service(client, &enetEvent, 0) > 0) {
     if (enetEvent.type == ENET_EVENT_TYPE_RECEIVE) {
       event.type = TransportEventType::RECEIVE;
-      event.data.assign(enetEvent.packet->data,
-                        enetEvent.packet->data + enetEvent.packet->dataLength);
-      enet_packet_destroy(enetEvent.packet);
+      event.data.borrow(enetEvent.packet->data, enetEvent.packet->dataLength,
+                        enetEvent.packet, destroyPacket);
       return true;
     }
   }
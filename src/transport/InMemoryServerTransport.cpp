@@ -1,61 +1,105 @@
 #include "transport/InMemoryServerTransport.h"
 
+#include <cassert>
+
 #include "Logger.h"
 
+namespace {
+
+// The ring record backs the event's payload until the caller clears it
+void consumeRecord(void* ring) { static_cast<SpscByteRing*>(ring)->consume(); }
+
+}  // namespace
+
 InMemoryServerTransport::InMemoryServerTransport(
-    std::shared_ptr<InMemoryChannel> channel)
-    : channel(std::move(channel)) {}
+    std::shared_ptr<InMemoryChannel> channel) {
+  if (channel) {
+    addClient(std::move(channel));
+  }
+}
+
+uint32_t InMemoryServerTransport::addClient(
+    std::shared_ptr<InMemoryChannel> channel) {
+  assert(channel && "Cannot attach null InMemoryChannel");
+  clients.push_back(ClientSlot{std::move(channel), false});
+  return static_cast<uint32_t>(clients.size() - 1) + FIRST_CLIENT_ID;
+}
 
 bool InMemoryServerTransport::initialize(const std::string& /*address*/,
                                           uint16_t /*port*/) {
-  if (!channel) {
+  if (clients.empty()) {
     Logger::error("InMemoryServerTransport: No channel provided");
     return false;
   }
 
   running = true;
-  Logger::info("InMemoryServerTransport: Initialized (embedded mode)");
+  Logger::info("InMemoryServerTransport: Initialized (embedded mode, " +
+               std::to_string(clients.size()) + " client channel(s))");
   return true;
 }
 
 bool InMemoryServerTransport::poll(TransportEvent& event) {
-  if (!running || !channel) return false;
+  if (!running || clients.empty()) return false;
+
+  // Hand the previous message back to its ring before peeking for the next
+  event.data.clear();
+
+  // Stay on a slot while it has events, then move on; give up after one
+  // full pass finds nothing
+  for (size_t scanned = 0; scanned < clients.size(); ++scanned) {
+    if (pollSlot(pollCursor, event)) {
+      return true;
+    }
+    pollCursor = (pollCursor + 1) % clients.size();
+  }
+
+  return false;
+}
+
+bool InMemoryServerTransport::pollSlot(size_t slotIndex,
+                                       TransportEvent& event) {
+  ClientSlot& slot = clients[slotIndex];
+  InMemoryChannel& channel = *slot.channel;
+  uint32_t clientId = static_cast<uint32_t>(slotIndex) + FIRST_CLIENT_ID;
 
   // Check for client connection request
-  if (channel->clientWantsConnect && !clientConnected) {
-    channel->clientWantsConnect = false;
-    channel->connected = true;
-    clientConnected = true;
+  if (channel.clientWantsConnect && !slot.connected) {
+    channel.clientWantsConnect = false;
+    channel.connected = true;
+    slot.connected = true;
 
     event.type = TransportEventType::CONNECT;
-    event.clientId = EMBEDDED_CLIENT_ID;
+    event.clientId = clientId;
     event.data.clear();
 
     Logger::info("InMemoryServerTransport: Client " +
-                 std::to_string(EMBEDDED_CLIENT_ID) + " connected");
+                 std::to_string(clientId) + " connected");
     return true;
   }
 
   // Check for client disconnect request
-  if (channel->clientWantsDisconnect && clientConnected) {
-    channel->clientWantsDisconnect = false;
-    channel->connected = false;
-    clientConnected = false;
+  if (channel.clientWantsDisconnect && slot.connected) {
+    channel.clientWantsDisconnect = false;
+    channel.connected = false;
+    slot.connected = false;
 
     event.type = TransportEventType::DISCONNECT;
-    event.clientId = EMBEDDED_CLIENT_ID;
+    event.clientId = clientId;
     event.data.clear();
 
     Logger::info("InMemoryServerTransport: Client " +
-                 std::to_string(EMBEDDED_CLIENT_ID) + " disconnected");
+                 std::to_string(clientId) + " disconnected");
     return true;
   }
 
-  // Check for messages from the client
-  if (channel->hasClientToServer()) {
+  // Check for messages from the client; the payload reads the record in
+  // place and consumes it when released
+  const uint8_t* data;
+  size_t length;
+  if (channel.clientToServer.peek(data, length)) {
     event.type = TransportEventType::RECEIVE;
-    event.clientId = EMBEDDED_CLIENT_ID;
-    event.data = channel->popClientToServer();
+    event.clientId = clientId;
+    event.data.borrow(data, length, &channel.clientToServer, consumeRecord);
     return true;
   }
 
@@ -64,21 +108,65 @@ bool InMemoryServerTransport::poll(TransportEvent& event) {
 
 void InMemoryServerTransport::send(uint32_t clientId, const uint8_t* data,
                                     size_t length) {
-  if (!running || !channel || clientId != EMBEDDED_CLIENT_ID) return;
+  if (!running || clientId < FIRST_CLIENT_ID) return;
+
+  size_t slotIndex = clientId - FIRST_CLIENT_ID;
+  if (slotIndex >= clients.size() || !clients[slotIndex].connected) return;
 
-  channel->pushServerToClient(data, length);
+  pushToClient(slotIndex, data, length);
 }
 
 void InMemoryServerTransport::broadcast(const uint8_t* data, size_t length) {
-  // In embedded mode, there's only one client
-  send(EMBEDDED_CLIENT_ID, data, length);
+  if (!running) return;
+
+  for (size_t i = 0; i < clients.size(); ++i) {
+    if (clients[i].connected) {
+      pushToClient(i, data, length);
+    }
+  }
+}
+
+void InMemoryServerTransport::pushToClient(size_t slotIndex,
+                                           const uint8_t* data,
+                                           size_t length) {
+  SpscByteRing& ring = clients[slotIndex].channel->serverToClient;
+  uint32_t clientId = static_cast<uint32_t>(slotIndex) + FIRST_CLIENT_ID;
+
+  // Reliable traffic rides these rings too, so every loss is an error;
+  // repeats are logged at doubling counts
+  if (length > ring.getMaxMessageSize()) {
+    ring.reject();
+    if (!shouldLogRingDrop(ring.getDroppedCount())) return;
+    Logger::error("InMemoryServerTransport: " + std::to_string(length) +
+                  "-byte message to client " + std::to_string(clientId) +
+                  " exceeds the " + std::to_string(ring.getMaxMessageSize()) +
+                  "-byte limit (raise IN_MEMORY_SERVER_TO_CLIENT_BYTES); "
+                  "dropped (" + std::to_string(ring.getDroppedCount()) +
+                  " so far)");
+    return;
+  }
+  if (!ring.push(data, length) && shouldLogRingDrop(ring.getDroppedCount())) {
+    Logger::error("InMemoryServerTransport: Ring to client " +
+                  std::to_string(clientId) + " full, dropped " +
+                  std::to_string(length) + "-byte message (" +
+                  std::to_string(ring.getDroppedCount()) + " so far)");
+  }
+}
+
+uint64_t InMemoryServerTransport::getDroppedCount() const {
+  uint64_t dropped = 0;
+  for (const auto& slot : clients) {
+    dropped += slot.channel->serverToClient.getDroppedCount() +
+               slot.channel->clientToServer.getDroppedCount();
+  }
+  return dropped;
 }
 
 void InMemoryServerTransport::stop() {
   running = false;
-  clientConnected = false;
-  if (channel) {
-    channel->connected = false;
+  for (auto& slot : clients) {
+    slot.connected = false;
+    slot.channel->connected = false;
   }
   Logger::info("InMemoryServerTransport: Stopped");
 }
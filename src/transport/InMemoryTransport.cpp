@@ -1,7 +1,16 @@
 #include "transport/InMemoryTransport.h"
 
+#include <string>
+
 #include "Logger.h"
 
+namespace {
+
+// The ring record backs the event's payload until the caller clears it
+void consumeRecord(void* ring) { static_cast<SpscByteRing*>(ring)->consume(); }
+
+}  // namespace
+
 InMemoryTransport::InMemoryTransport(std::shared_ptr<InMemoryChannel> channel)
     : channel(std::move(channel)) {}
 
@@ -33,16 +42,39 @@ void InMemoryTransport::send(const uint8_t* data, size_t length,
                               bool /*reliable*/) {
   if (!connected || !channel) return;
 
-  channel->pushClientToServer(data, length);
+  SpscByteRing& ring = channel->clientToServer;
+  // Every loss is an error; repeats are logged at doubling counts
+  if (length > ring.getMaxMessageSize()) {
+    ring.reject();
+    if (!shouldLogRingDrop(ring.getDroppedCount())) return;
+    Logger::error("InMemoryTransport: " + std::to_string(length) +
+                  "-byte message exceeds the " +
+                  std::to_string(ring.getMaxMessageSize()) +
+                  "-byte limit (raise IN_MEMORY_CLIENT_TO_SERVER_BYTES); "
+                  "dropped (" + std::to_string(ring.getDroppedCount()) +
+                  " so far)");
+    return;
+  }
+  if (!ring.push(data, length) && shouldLogRingDrop(ring.getDroppedCount())) {
+    Logger::error("InMemoryTransport: Client-to-server ring full, dropped " +
+                  std::to_string(length) + "-byte message (" +
+                  std::to_string(ring.getDroppedCount()) + " so far)");
+  }
 }
 
 bool InMemoryTransport::poll(TransportEvent& event) {
   if (!channel) return false;
 
-  // Check for messages from the server
-  if (channel->hasServerToClient()) {
+  // Hand the previous message back to the ring before peeking for the next
+  event.data.clear();
+
+  // Check for messages from the server; the payload reads the record in
+  // place and consumes it when released
+  const uint8_t* data;
+  size_t length;
+  if (channel->serverToClient.peek(data, length)) {
     event.type = TransportEventType::RECEIVE;
-    event.data = channel->popServerToClient();
+    event.data.borrow(data, length, &channel->serverToClient, consumeRecord);
     event.clientId = 0;  // Client doesn't use clientId
     return true;
   }
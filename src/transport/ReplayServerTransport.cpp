@@ -0,0 +1,73 @@
+#include "transport/ReplayServerTransport.h"
+
+#include <cassert>
+
+#include "Logger.h"
+
+ReplayServerTransport::ReplayServerTransport(ReplayReader& reader)
+    : reader(reader) {}
+
+bool ReplayServerTransport::initialize(const std::string& /*address*/,
+                                       uint16_t /*port*/) {
+  reader.rewind();
+  hasPending = reader.next(pending);
+  running = true;
+  Logger::info("ReplayServerTransport: " +
+               std::to_string(reader.getRecordCount()) + " records over " +
+               std::to_string(reader.getTickCount()) + " ticks");
+  return true;
+}
+
+bool ReplayServerTransport::poll(TransportEvent& event) {
+  if (!running || !hasPending) return false;
+  assert(pending.tick >= currentTick && "Replay skipped a recorded tick");
+  if (pending.tick != currentTick) return false;
+
+  event.clientId = pending.clientId;
+  event.data.clear();
+  switch (pending.kind) {
+    case ReplayRecordKind::Connect:
+      event.type = TransportEventType::CONNECT;
+      break;
+    case ReplayRecordKind::Disconnect:
+      event.type = TransportEventType::DISCONNECT;
+      break;
+    case ReplayRecordKind::Packet:
+      event.type = TransportEventType::RECEIVE;
+      // Records point into the reader's file buffer, which outlives us
+      event.data.borrow(pending.data, pending.size);
+      break;
+    case ReplayRecordKind::End:
+      assert(false && "Reader never returns End records");
+      break;
+  }
+
+  hasPending = reader.next(pending);
+  return true;
+}
+
+void ReplayServerTransport::send(uint32_t clientId, const uint8_t* data,
+                                 size_t length) {
+  if (!running) return;
+  hashOutput(clientId, data, length);
+}
+
+void ReplayServerTransport::broadcast(const uint8_t* data, size_t length) {
+  if (!running) return;
+  hashOutput(0, data, length);
+}
+
+void ReplayServerTransport::stop() { running = false; }
+
+void ReplayServerTransport::hashOutput(uint32_t clientId, const uint8_t* data,
+                                       size_t length) {
+  constexpr uint64_t prime = 1099511628211ull;
+  for (int i = 0; i < 4; ++i) {
+    outputHash = (outputHash ^ ((clientId >> (8 * i)) & 0xFF)) * prime;
+  }
+  for (size_t i = 0; i < length; ++i) {
+    outputHash = (outputHash ^ data[i]) * prime;
+  }
+  bytesSent += length;
+  packetsSent++;
+}
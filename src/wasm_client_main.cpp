@@ -10,6 +10,7 @@
 
 #include "AnimationAssetLoader.h"
 #include "AnimationSystem.h"
+#include "AssetLoader.h"
 #include "Camera.h"
 #include "CharacterRegistry.h"
 #include "CharacterSelectionState.h"
@@ -33,8 +34,10 @@
 #include "NetworkProtocol.h"
 #include "Objective.h"
 #include "ObjectiveDebugRenderer.h"
+#include "OpenGLUtils.h"
 #include "RemotePlayerInterpolation.h"
 #include "RenderSystem.h"
+#include "TextureManager.h"
 #include "TileRenderer.h"
 #include "TiledMap.h"
 #include "UISystem.h"
@@ -53,6 +56,10 @@ int main(int argc, char* argv[]) {
     Logger::error("Failed to load items.csv - inventory will be empty");
   }
 
+  // Every client system is handed this bus. It is the process default
+  // because GameStateManager and the session's client publish there.
+  EventBus& bus = EventBus::instance();
+
   // Create embedded game session (client + server in same process)
   auto gameSession = GameSession::create();
   if (!gameSession) {
@@ -65,9 +72,29 @@ int main(int argc, char* argv[]) {
   // Start in title screen (same as native client)
   GameStateManager::instance().transitionTo(GameState::TitleScreen);
 
-  Window window("Gambit WASM", Config::Screen::WIDTH, Config::Screen::HEIGHT);
+  // WebGL has no KHR_debug, so a debug build falls back to per-frame checks
+  Window window("Gambit WASM", Config::Screen::WIDTH, Config::Screen::HEIGHT,
+                bus, OpenGLUtils::DEBUG_LAYER_DEFAULT);
   window.initImGui();
-  GameLoop gameLoop;
+
+  // Packed sprites/portraits/UI, if AtlasPacker has been run
+  TextureManager::instance().loadAtlas();
+  GameLoop gameLoop(bus);
+
+  // No worker threads on WASM: pump() decodes one queued image per frame
+  // and uploads it, keeping menu art off the startup path
+  bus.subscribe<RenderEvent>(
+      [](const RenderEvent& e) { AssetLoader::instance().pump(); });
+
+  std::vector<std::string> characterArt;
+  for (const auto& character :
+       CharacterRegistry::instance().getAllCharacters()) {
+    characterArt.push_back(character.getCharacterPortraitPath());
+    characterArt.push_back(character.getCharacterPreviewPath());
+  }
+  GameStateManager::instance().addLoadingFuture(
+      GameState::CharacterSelect,
+      TextureManager::instance().prefetch(characterArt));
 
   // Map is already loaded by GameSession, but we need a reference for rendering
   TiledMap map;
@@ -89,34 +116,37 @@ int main(int argc, char* argv[]) {
   uint32_t localPlayerId = 1;  // Fixed player ID for embedded mode
   WorldConfig world(map.getWorldWidth(), map.getWorldHeight(),
                     &collisionSystem);
-  ClientPrediction clientPrediction(&client, localPlayerId, world);
+  ClientPrediction clientPrediction(&client, localPlayerId, world, bus);
 
   clientPrediction.setupObjectiveEventHandlers();
 
   ObjectiveDebugRenderer objectiveDebugRenderer(&camera, &clientPrediction);
 
   InputSystem inputSystem(&clientPrediction, &collisionDebugRenderer,
-                          &musicZoneDebugRenderer, &objectiveDebugRenderer);
+                          &musicZoneDebugRenderer, &objectiveDebugRenderer,
+                          bus);
 
-  AnimationSystem animationSystem;
-  MusicSystem musicSystem(&clientPrediction, &map);
+  AnimationSystem animationSystem(bus);
+  MusicSystem musicSystem(&clientPrediction, &map, bus);
 
   RemotePlayerInterpolation remoteInterpolation(localPlayerId,
-                                                &animationSystem);
-  EnemyInterpolation enemyInterpolation(&animationSystem);
-  CombatSystem combatSystem(&client, &clientPrediction, &enemyInterpolation);
+                                                &animationSystem, bus);
+  EnemyInterpolation enemyInterpolation(&animationSystem, bus);
+  CombatSystem combatSystem(&client, &clientPrediction, &enemyInterpolation,
+                            bus);
 
   RenderSystem renderSystem(&window, &clientPrediction, &remoteInterpolation,
                             &enemyInterpolation, &camera, &map,
                             &collisionDebugRenderer, &musicZoneDebugRenderer,
-                            &objectiveDebugRenderer);
+                            &objectiveDebugRenderer, bus);
 
-  DamageNumberSystem damageNumberSystem(&camera,
-                                        renderSystem.getSpriteRenderer());
-  EffectTracker effectTracker;
+  DamageNumberSystem damageNumberSystem(
+      &camera, renderSystem.getSpriteRenderer(), bus);
+  EffectTracker effectTracker(bus);
   UISystem uiSystem(&window, &clientPrediction, &client, &damageNumberSystem,
                     &effectTracker, &remoteInterpolation, &enemyInterpolation,
-                    &camera);
+                    &camera, bus);
+  uiSystem.setMap(&map);
 
   // Load local player animations
   Player& localPlayer = clientPrediction.getLocalPlayerMutable();
@@ -136,11 +166,11 @@ int main(int argc, char* argv[]) {
   localPlayer.inventory[2] = ItemStack(3, 1);
 
   // Subscribe to UpdateEvent
-  EventBus::instance().subscribe<UpdateEvent>([&](const UpdateEvent& e) {
+  bus.subscribe<UpdateEvent>([&](const UpdateEvent& e) {
     window.pollEvents();
 
     // Tick the embedded game session (processes both server and client)
-    gameSession->tick();
+    gameSession->tick(e);
 
     if (!window.isOpen()) {
       gameLoop.stop();
@@ -202,6 +202,72 @@ TEST(AnimationController_ZeroTimeUpdate) {
   assert(frame1X == frame2X && frame1Y == frame2Y);
 }
 
+TEST(AnimationController_SharesOneLibraryPerSheet) {
+  const AnimationLibrary& library =
+      AnimationAssetLoader::getPlayerLibrary("shared_sheet.png");
+  assert(&AnimationAssetLoader::getPlayerLibrary("shared_sheet.png") ==
+         &library);
+
+  AnimationController a;
+  AnimationController b;
+  AnimationAssetLoader::loadPlayerAnimations(a, "shared_sheet.png");
+  AnimationAssetLoader::loadPlayerAnimations(b, "shared_sheet.png");
+  assert(a.getLibrary() == &library && b.getLibrary() == &library);
+
+  // Playback state stays per controller
+  a.updateAnimationState(1.0f, 0.0f);
+  assert(a.getCurrentDirection() == AnimationDirection::EAST);
+  assert(b.getCurrentDirection() == AnimationDirection::IDLE);
+  assert(a.getCurrentClipId() != b.getCurrentClipId());
+
+  // Copies are cheap and independent
+  static_assert(sizeof(AnimationController) <= 32,
+                "AnimationController should hold playback state only");
+  AnimationController copy = a;
+  copy.updateAnimationState(0.0f, 1.0f);
+  assert(a.getCurrentDirection() == AnimationDirection::EAST);
+  assert(copy.getCurrentDirection() == AnimationDirection::SOUTH);
+}
+
+TEST(AnimationController_DirectionTableMatchesClipNames) {
+  const AnimationLibrary& library = AnimationAssetLoader::getPlayerLibrary("");
+  assert(library.getClipCount() == AnimationLibrary::DIRECTION_COUNT);
+
+  struct DirectionClip {
+    AnimationDirection dir;
+    const char* name;
+  };
+  DirectionClip expected[] = {
+      {AnimationDirection::IDLE, "idle"},
+      {AnimationDirection::NORTH, "walk_north"},
+      {AnimationDirection::EAST, "walk_east"},
+      {AnimationDirection::SOUTHWEST, "walk_southwest"},
+      {AnimationDirection::NORTHWEST, "walk_northwest"},
+  };
+  for (const auto& test : expected) {
+    AnimationClipId id;
+    assert(library.findClip(test.name, id));
+    assert(library.getDirectionClip(test.dir) == id);
+  }
+
+  AnimationController controller;
+  controller.setLibrary(&library);
+  controller.updateAnimationState(-1.0f, -1.0f);
+  assert(controller.getCurrentAnimationName() == "walk_northwest");
+}
+
+TEST(AnimationController_NoLibraryIsInert) {
+  AnimationController controller;
+  controller.updateAnimationState(1.0f, 0.0f);
+  controller.advanceFrame(1000.0f);
+  assert(controller.getCurrentDirection() == AnimationDirection::IDLE);
+  assert(controller.getCurrentAnimationName() == "idle");
+
+  int srcX, srcY, srcW, srcH;
+  controller.getCurrentFrame(srcX, srcY, srcW, srcH);
+  assert(srcX == 0 && srcY == 0 && srcW == 32 && srcH == 32);
+}
+
 int main() {
   Logger::init();
 
@@ -214,6 +280,9 @@ int main() {
   test_AnimationController_FrameLooping();
   test_AnimationController_MultipleDirectionChanges();
   test_AnimationController_ZeroTimeUpdate();
+  test_AnimationController_SharesOneLibraryPerSheet();
+  test_AnimationController_DirectionTableMatchesClipNames();
+  test_AnimationController_NoLibraryIsInert();
 
   return 0;
 }
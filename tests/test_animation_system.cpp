@@ -6,7 +6,7 @@
 
 TEST(AnimationSystem_RegisterEntity) {
   resetEventBus();
-  AnimationSystem animSystem;
+  AnimationSystem animSystem(EventBus::instance());
 
   Player player;
   player.vx = 0.0f;
@@ -18,7 +18,7 @@ TEST(AnimationSystem_RegisterEntity) {
 
 TEST(AnimationSystem_MultipleEntities) {
   resetEventBus();
-  AnimationSystem animSystem;
+  AnimationSystem animSystem(EventBus::instance());
 
   // Create multiple players and load their animations
   Player player1, player2, player3;
@@ -63,7 +63,7 @@ TEST(AnimationSystem_MultipleEntities) {
 
 TEST(AnimationSystem_UnregisterEntity) {
   resetEventBus();
-  AnimationSystem animSystem;
+  AnimationSystem animSystem(EventBus::instance());
 
   Player player;
   player.vx = 1.0f;
@@ -77,7 +77,7 @@ TEST(AnimationSystem_UnregisterEntity) {
 
 TEST(AnimationSystem_RegisterSameEntityTwice) {
   resetEventBus();
-  AnimationSystem animSystem;
+  AnimationSystem animSystem(EventBus::instance());
 
   Player player;
 
@@ -88,7 +88,7 @@ TEST(AnimationSystem_RegisterSameEntityTwice) {
 
 TEST(AnimationSystem_UnregisterNonExistentEntity) {
   resetEventBus();
-  AnimationSystem animSystem;
+  AnimationSystem animSystem(EventBus::instance());
 
   Player player;
 
@@ -99,7 +99,7 @@ TEST(AnimationSystem_UnregisterNonExistentEntity) {
 TEST(AnimationSystem_EventDriven) {
   // Test that AnimationSystem updates entities via UpdateEvent
   resetEventBus();
-  AnimationSystem animSystem;
+  AnimationSystem animSystem(EventBus::instance());
 
   Player player;
   AnimationAssetLoader::loadPlayerAnimations(*player.getAnimationController(),
@@ -131,7 +131,7 @@ TEST(AnimationSystem_EventDriven) {
 
 TEST(AnimationSystem_RegisterUnregisterCycle) {
   resetEventBus();
-  AnimationSystem animSystem;
+  AnimationSystem animSystem(EventBus::instance());
 
   Player player;
 
@@ -145,6 +145,115 @@ TEST(AnimationSystem_RegisterUnregisterCycle) {
   animSystem.registerEntity(&player);
 }
 
+TEST(AnimationSystem_UnregisterKeepsOtherSlots) {
+  resetEventBus();
+  AnimationSystem animSystem(EventBus::instance());
+
+  // Each player walks east and has been running a different length of time
+  Player players[5];
+  for (int i = 0; i < 5; i++) {
+    AnimationAssetLoader::loadPlayerAnimations(
+        *players[i].getAnimationController(), "");
+    players[i].getAnimationController()->updateAnimationState(1.0f, 0.0f);
+    players[i].getAnimationController()->advanceFrame(100.0f * i);
+    animSystem.registerEntity(&players[i]);
+  }
+  assert(animSystem.getEntityCount() == 5);
+
+  // Removing from the middle moves the last slot; nobody's clock changes
+  animSystem.unregisterEntity(&players[1]);
+  animSystem.unregisterEntity(&players[1]);
+  assert(animSystem.getEntityCount() == 4);
+  assert(!players[1].getAnimationController()->isRegistered());
+  for (int i = 0; i < 5; i++) {
+    assert(players[i].getAnimationController()->getCurrentFrameIndex() ==
+           i % 4);
+  }
+
+  // One tick advances everyone still registered, and only them
+  animSystem.advance(100.0f);
+  for (int i = 0; i < 5; i++) {
+    int expected = (i == 1) ? 1 : (i + 1) % 4;
+    assert(players[i].getAnimationController()->getCurrentFrameIndex() ==
+           expected);
+  }
+}
+
+TEST(AnimationSystem_AdvanceWrapsLoopingClips) {
+  resetEventBus();
+  AnimationSystem animSystem(EventBus::instance());
+
+  Player walker;
+  AnimationAssetLoader::loadPlayerAnimations(*walker.getAnimationController(),
+                                             "");
+  walker.getAnimationController()->updateAnimationState(1.0f, 0.0f);
+  animSystem.registerEntity(&walker);
+
+  // Four 100ms frames: 1050ms in is 50ms into frame 2
+  for (int i = 0; i < 63; i++) {
+    animSystem.advance(16.67f);
+  }
+  assert(walker.getAnimationController()->getCurrentFrameIndex() == 2);
+
+  // Switching clips restarts at frame 0
+  walker.getAnimationController()->updateAnimationState(0.0f, 1.0f);
+  assert(walker.getAnimationController()->getCurrentFrameIndex() == 0);
+
+  // A copy is a snapshot: it stays put while the original advances
+  AnimationController copy = *walker.getAnimationController();
+  assert(!copy.isRegistered());
+  animSystem.advance(150.0f);
+  assert(walker.getAnimationController()->getCurrentFrameIndex() == 1);
+  assert(copy.getCurrentFrameIndex() == 0);
+}
+
+TEST(AnimationSystem_EntityDestroyedWhileRegistered) {
+  resetEventBus();
+  AnimationSystem animSystem(EventBus::instance());
+
+  Player kept;
+  animSystem.registerEntity(&kept);
+  {
+    Player dropped;
+    animSystem.registerEntity(&dropped);
+    assert(animSystem.getEntityCount() == 2);
+  }
+  // The destroyed controller gave its slot back
+  assert(animSystem.getEntityCount() == 1);
+  animSystem.advance(16.67f);
+  animSystem.unregisterEntity(&kept);
+  assert(animSystem.getEntityCount() == 0);
+}
+
+TEST(AnimationSystem_DestroyedBeforeEntities) {
+  EventBus bus;
+  Player walker;
+  AnimationAssetLoader::loadPlayerAnimations(*walker.getAnimationController(),
+                                             "");
+  walker.getAnimationController()->updateAnimationState(1.0f, 0.0f);
+  {
+    AnimationSystem animSystem(bus);
+    animSystem.registerEntity(&walker);
+    animSystem.advance(150.0f);
+  }
+  // The controller keeps its playback time and runs on its own again
+  assert(!walker.getAnimationController()->isRegistered());
+  assert(walker.getAnimationController()->getCurrentFrameIndex() == 1);
+  walker.getAnimationController()->advanceFrame(100.0f);
+  assert(walker.getAnimationController()->getCurrentFrameIndex() == 2);
+}
+
+TEST(AnimationSystem_UnsubscribesOnDestruction) {
+  EventBus bus;
+  {
+    AnimationSystem animSystem(bus);
+    assert(bus.subscriberCount<UpdateEvent>() == 1);
+  }
+  // Publishing after the system is gone must not call into it
+  assert(bus.subscriberCount<UpdateEvent>() == 0);
+  bus.publish(UpdateEvent{16.67f, 1});
+}
+
 int main() {
   Logger::init();
 
@@ -155,6 +264,11 @@ int main() {
   test_AnimationSystem_UnregisterNonExistentEntity();
   test_AnimationSystem_EventDriven();
   test_AnimationSystem_RegisterUnregisterCycle();
+  test_AnimationSystem_UnregisterKeepsOtherSlots();
+  test_AnimationSystem_AdvanceWrapsLoopingClips();
+  test_AnimationSystem_EntityDestroyedWhileRegistered();
+  test_AnimationSystem_DestroyedBeforeEntities();
+  test_AnimationSystem_UnsubscribesOnDestruction();
 
   return 0;
 }
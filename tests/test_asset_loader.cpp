@@ -0,0 +1,142 @@
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "AssetLoader.h"
+#include "GameStateManager.h"
+#include "Logger.h"
+
+#define TEST(name)    \
+  void test_##name(); \
+  void test_##name()
+
+namespace {
+
+// Pump until every upload has run (worker decodes finish in the meantime)
+void pumpUntilIdle(AssetLoader& loader, size_t budget) {
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (loader.getPendingCount() > 0) {
+    assert(std::chrono::steady_clock::now() < deadline && "Loader stuck");
+    loader.pump(budget);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+}  // namespace
+
+TEST(AssetLoader_SubmitRunsOnWorkers) {
+  AssetLoader loader(2);
+  assert(loader.getWorkerCount() == 2);
+
+  std::thread::id caller = std::this_thread::get_id();
+  std::vector<std::future<int>> results;
+  std::vector<std::future<bool>> offThread;
+  for (int i = 0; i < 16; ++i) {
+    results.push_back(loader.submit([i]() { return i * i; }));
+    offThread.push_back(loader.submit(
+        [caller]() { return std::this_thread::get_id() != caller; }));
+  }
+  for (int i = 0; i < 16; ++i) {
+    assert(results[i].get() == i * i);
+    assert(offThread[i].get());
+  }
+}
+
+TEST(AssetLoader_UploadsRunOnlyInPump) {
+  AssetLoader loader(2);
+  std::thread::id renderThread = std::this_thread::get_id();
+  std::atomic<int> decoded{0};
+  int uploaded = 0;
+
+  for (int i = 0; i < 4; ++i) {
+    loader.submitWithUpload([&, renderThread]() {
+      decoded++;
+      AssetLoader::Upload upload;
+      upload.cost = 100;
+      upload.run = [&, renderThread]() {
+        assert(std::this_thread::get_id() == renderThread);
+        uploaded++;
+      };
+      return upload;
+    });
+  }
+  assert(loader.getPendingCount() == 4);
+
+  // Decodes finish without the render thread doing anything...
+  while (decoded < 4) {
+    std::this_thread::yield();
+  }
+  assert(uploaded == 0);
+
+  // ...but uploads wait for pump(), 2 per frame at this budget
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  assert(loader.pump(250) == 2);
+  assert(uploaded == 2);
+  assert(loader.pump(250) == 2);
+  assert(uploaded == 4);
+  assert(loader.getPendingCount() == 0);
+}
+
+TEST(AssetLoader_OversizedUploadStillLands) {
+  AssetLoader loader(1);
+  bool uploaded = false;
+  loader.submitWithUpload([&]() {
+    return AssetLoader::Upload{[&]() { uploaded = true; }, 1 << 30};
+  });
+  pumpUntilIdle(loader, 1024);
+  assert(uploaded);
+}
+
+TEST(AssetLoader_InlineModeDefersDecodesToPump) {
+  AssetLoader loader(0);  // WASM configuration
+  assert(loader.submit([]() { return 7; }).get() == 7);
+
+  int decoded = 0;
+  int uploaded = 0;
+  for (int i = 0; i < 3; ++i) {
+    loader.submitWithUpload([&]() {
+      decoded++;
+      return AssetLoader::Upload{[&]() { uploaded++; }, 1};
+    });
+  }
+  assert(decoded == 0);
+
+  // One decode per frame, uploaded in the same pump
+  assert(loader.pump() == 1);
+  assert(decoded == 1 && uploaded == 1);
+  pumpUntilIdle(loader, AssetLoader::DEFAULT_UPLOAD_BUDGET);
+  assert(decoded == 3 && uploaded == 3);
+}
+
+TEST(GameStateManager_LoadingGates) {
+  GameStateManager& states = GameStateManager::instance();
+  assert(states.isLoaded(GameState::Inventory));  // Nothing registered
+
+  std::promise<void> portraits;
+  std::promise<void> previews;
+  states.addLoadingFuture(GameState::CharacterSelect,
+                          portraits.get_future().share());
+  states.addLoadingFuture(GameState::CharacterSelect,
+                          previews.get_future().share());
+  assert(!states.isLoaded(GameState::CharacterSelect));
+
+  portraits.set_value();
+  assert(!states.isLoaded(GameState::CharacterSelect));
+  previews.set_value();
+  assert(states.isLoaded(GameState::CharacterSelect));
+}
+
+int main() {
+  Logger::init();
+
+  test_AssetLoader_SubmitRunsOnWorkers();
+  test_AssetLoader_UploadsRunOnlyInPump();
+  test_AssetLoader_OversizedUploadStillLands();
+  test_AssetLoader_InlineModeDefersDecodesToPump();
+  test_GameStateManager_LoadingGates();
+
+  return 0;
+}
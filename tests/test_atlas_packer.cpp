@@ -0,0 +1,141 @@
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "AtlasManifest.h"
+#include "AtlasPacker.h"
+#include "Logger.h"
+
+#define TEST(name)    \
+  void test_##name(); \
+  void test_##name()
+
+namespace {
+
+bool overlaps(const AtlasPlacement& a, const AtlasPacker::Size& sa,
+              const AtlasPlacement& b, const AtlasPacker::Size& sb,
+              int padding) {
+  return a.page == b.page && a.x < b.x + sb.width + padding &&
+         b.x < a.x + sa.width + padding && a.y < b.y + sb.height + padding &&
+         b.y < a.y + sa.height + padding;
+}
+
+}  // namespace
+
+TEST(AtlasPacker_PlacementsFitAndDoNotOverlap) {
+  // The client's art: 19 portraits, 20 previews, sheets and UI
+  std::vector<AtlasPacker::Size> sizes;
+  for (int i = 0; i < 19; ++i) sizes.push_back({740, 870});
+  for (int i = 0; i < 20; ++i) sizes.push_back({1024, 1536});
+  sizes.push_back({256, 256});
+  sizes.push_back({96, 64});
+  sizes.push_back({1154, 769});
+
+  constexpr int PAGE = 4096;
+  constexpr int PADDING = 2;
+  AtlasPacker packer(PAGE, PADDING);
+  std::vector<AtlasPlacement> placements = packer.pack(sizes);
+  assert(placements.size() == sizes.size());
+
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    const AtlasPlacement& p = placements[i];
+    assert(p.page >= 0 && p.page < packer.getPageCount());
+    assert(p.x >= 0 && p.x + sizes[i].width <= packer.getUsedWidth(p.page));
+    assert(p.y >= 0 && p.y + sizes[i].height <= packer.getUsedHeight(p.page));
+    for (size_t j = i + 1; j < sizes.size(); ++j) {
+      assert(!overlaps(p, sizes[i], placements[j], sizes[j], PADDING));
+    }
+  }
+
+  // 43 images collapse to a handful of textures
+  assert(packer.getPageCount() <= 6);
+  for (int page = 0; page < packer.getPageCount(); ++page) {
+    assert(packer.getUsedWidth(page) <= PAGE);
+    assert(packer.getUsedHeight(page) <= PAGE);
+  }
+}
+
+TEST(AtlasPacker_OversizedImagesLeftUnplaced) {
+  AtlasPacker packer(512, 1);
+  std::vector<AtlasPlacement> placements =
+      packer.pack({{600, 10}, {32, 32}, {10, 513}});
+
+  assert(placements[0].page == -1);
+  assert(placements[1].page == 0);
+  assert(placements[2].page == -1);
+  assert(packer.getPageCount() == 1);
+  assert(packer.getUsedWidth(0) == 32 && packer.getUsedHeight(0) == 32);
+}
+
+TEST(AtlasPacker_Deterministic) {
+  std::vector<AtlasPacker::Size> sizes = {
+      {100, 50}, {30, 80}, {100, 50}, {64, 64}, {200, 20}};
+  AtlasPacker a(256, 2);
+  AtlasPacker b(256, 2);
+  std::vector<AtlasPlacement> first = a.pack(sizes);
+  std::vector<AtlasPlacement> second = b.pack(sizes);
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    assert(first[i].page == second[i].page);
+    assert(first[i].x == second[i].x && first[i].y == second[i].y);
+  }
+}
+
+TEST(AtlasManifest_RoundTrip) {
+  const std::string path = "test_atlas_manifest.txt";
+
+  AtlasManifest written;
+  written.addPage(AtlasPage{"atlas_0.png", 2048, 1024});
+  written.addPage(AtlasPage{"atlas_1.png", 512, 512});
+  written.addImage("assets/ship.png", AtlasEntry{1, 10, 20, 96, 64});
+  written.addImage("assets/portraits/Nyx.png",
+                   AtlasEntry{0, 0, 0, 740, 870});
+  assert(written.save(path));
+
+  AtlasManifest read;
+  assert(read.load(path));
+  assert(read.getPages().size() == 2);
+  assert(read.getPages()[1].file == "atlas_1.png");
+  assert(read.getPages()[0].width == 2048);
+  assert(read.getImageCount() == 2);
+
+  const AtlasEntry* ship = read.find("assets/ship.png");
+  assert(ship && ship->page == 1 && ship->x == 10 && ship->y == 20);
+  assert(ship->width == 96 && ship->height == 64);
+  assert(read.find("assets/player.png") == nullptr);
+  assert(read.getBaseDirectory().empty());
+
+  std::remove(path.c_str());
+}
+
+TEST(AtlasManifest_RejectsBadInput) {
+  AtlasManifest manifest;
+  assert(!manifest.load("no_such_dir/atlas.txt"));
+  assert(manifest.getBaseDirectory() == "no_such_dir/");
+
+  // Image referring to a page that does not exist
+  const std::string path = "test_atlas_bad.txt";
+  {
+    std::ofstream file(path);
+    file << "page 0 atlas_0.png 64 64\n"
+         << "image assets/a.png 0 0 0 8 8\n"
+         << "image assets/b.png 3 0 0 8 8\n";
+  }
+  assert(!manifest.load(path));
+  assert(manifest.getImageCount() == 0);
+  assert(manifest.getPages().empty());
+  std::remove(path.c_str());
+}
+
+int main() {
+  Logger::init();
+
+  test_AtlasPacker_PlacementsFitAndDoNotOverlap();
+  test_AtlasPacker_OversizedImagesLeftUnplaced();
+  test_AtlasPacker_Deterministic();
+  test_AtlasManifest_RoundTrip();
+  test_AtlasManifest_RejectsBadInput();
+
+  return 0;
+}
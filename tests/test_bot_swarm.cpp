@@ -0,0 +1,103 @@
+#include <set>
+#include <vector>
+
+#include "BotSwarm.h"
+#include "EventBus.h"
+#include "Logger.h"
+#include "test_utils.h"
+
+TEST(BotSwarm_PercentilesNearestRank) {
+  std::vector<float> samples;
+  for (int i = 100; i >= 1; --i) {
+    samples.push_back(static_cast<float>(i));
+  }
+
+  PercentileSummary summary = summarizePercentiles(samples);
+  assert(summary.count == 100);
+  assert(floatEqual(summary.p50, 50.0f));
+  assert(floatEqual(summary.p90, 90.0f));
+  assert(floatEqual(summary.p99, 99.0f));
+  assert(floatEqual(summary.max, 100.0f));
+
+  std::vector<float> empty;
+  assert(summarizePercentiles(empty).count == 0);
+}
+
+TEST(BotSwarm_InProcessBotsJoinAndReceiveState) {
+  resetEventBus();
+
+  BotSwarmConfig config;
+  config.botCount = 16;
+  config.frames = 120;
+  config.pattern = BotPattern::Circle;
+  config.mapPath = "";  // No map: plain world bounds, no enemies
+
+  BotSwarm swarm(config);
+  assert(swarm.start());
+  BotSwarmReport report = swarm.run();
+
+  assert(report.botsConnected == 16);
+  assert(report.botsJoined == 16);
+  assert(report.serverTickMs.count == 120);
+  assert(report.downstreamBytesPerFrame.count == 120);
+  assert(report.totalBytesUp > 0);
+  assert(report.totalBytesDown > report.totalBytesUp);
+
+  // Every bot is a distinct player and saw the server tick
+  std::set<uint32_t> playerIds;
+  for (const auto& bot : swarm.getBots()) {
+    playerIds.insert(bot->getPlayerId());
+    assert(bot->getStateUpdatesReceived() > 100);
+    assert(bot->getLastServerTick() >= 119);
+  }
+  assert(playerIds.size() == 16);
+
+  resetEventBus();
+}
+
+TEST(BotSwarm_SoakReportsPerTickCosts) {
+  resetEventBus();
+
+  BotSwarmConfig config;
+  config.botCount = 4;
+  config.frames = 60;
+  config.mapPath = "";  // Enemies scattered over the plain world bounds
+  config.enemyCount = 200;
+
+  BotSwarm swarm(config);
+  assert(swarm.start());
+  BotSwarmReport report = swarm.run();
+
+  assert(report.botsJoined == 4);
+  assert(report.serverTicksPerSecond > 0.0);
+  assert(report.meanPhaseMs.enemiesMs > 0.0f);
+  assert(report.meanNetworkMs >= 0.0f);
+
+  // Every tick broadcasts player and enemy state
+  assert(report.bytesSerializedPerTick.count == 60);
+  assert(report.bytesSerializedPerTick.p50 > 200.0f);
+  assert(report.allocationsPerTick.count == 60);
+  assert(report.allocationsPerTick.max > 0.0f);
+
+  resetEventBus();
+}
+
+TEST(BotSwarm_PatternNames) {
+  BotPattern pattern = BotPattern::Idle;
+  assert(parseBotPattern("zigzag", pattern));
+  assert(pattern == BotPattern::Zigzag);
+  assert(std::string(botPatternName(pattern)) == "zigzag");
+  assert(!parseBotPattern("teleport", pattern));
+  assert(pattern == BotPattern::Zigzag);
+}
+
+int main() {
+  Logger::init();
+
+  test_BotSwarm_PercentilesNearestRank();
+  test_BotSwarm_InProcessBotsJoinAndReceiveState();
+  test_BotSwarm_SoakReportsPerTickCosts();
+  test_BotSwarm_PatternNames();
+
+  return 0;
+}
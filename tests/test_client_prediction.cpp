@@ -1,13 +1,86 @@
+#include <algorithm>
+#include <cmath>
+#include <deque>
 #include <memory>
 
 #include "ClientPrediction.h"
 #include "Logger.h"
 #include "NetworkClient.h"
 #include "WorldConfig.h"
+#include "config/PlayerConfig.h"
 #include "config/ScreenConfig.h"
 #include "test_utils.h"
 #include "transport/ENetTransport.h"
 
+namespace {
+
+// A server running the same movement code, with `oneWayTicks` of latency
+// in each direction. Inputs go through the EventBus like InputSystem's.
+struct LatencySim {
+  static constexpr float WORLD_SIZE = 4000.0f;
+
+  ClientPrediction& prediction;
+  int oneWayTicks;
+  Player server;
+  uint32_t nextSequence = 1;
+  uint32_t serverAck = 0;
+  int tick = 0;
+  std::deque<std::pair<int, LocalInputEvent>> toServer;
+  std::deque<std::pair<int, PlayerState>> toClient;
+  float maxCorrection = 0.0f;
+
+  LatencySim(ClientPrediction& prediction, int oneWayTicks)
+      : prediction(prediction), oneWayTicks(oneWayTicks) {
+    server.id = 1;
+    server.x = Config::Player::DEFAULT_SPAWN_X;
+    server.y = Config::Player::DEFAULT_SPAWN_Y;
+  }
+
+  // Right, down, left, up: 30 ticks each
+  void step() {
+    int phase = (tick / 30) % 4;
+    step(phase == 2, phase == 0, phase == 3, phase == 1);
+  }
+
+  void step(bool left, bool right, bool up, bool down) {
+    LocalInputEvent input{};
+    input.moveLeft = left;
+    input.moveRight = right;
+    input.moveUp = up;
+    input.moveDown = down;
+    input.inputSequence = nextSequence++;
+    EventBus::instance().publish(input);
+    toServer.emplace_back(tick + oneWayTicks, input);
+
+    while (!toServer.empty() && toServer.front().first <= tick) {
+      const LocalInputEvent& e = toServer.front().second;
+      applyInput(server,
+                 MovementInput(e.moveLeft, e.moveRight, e.moveUp, e.moveDown,
+                               16.67f, WORLD_SIZE, WORLD_SIZE, nullptr));
+      serverAck = e.inputSequence;
+      toServer.pop_front();
+    }
+
+    PlayerState state{1,     server.x, server.y, server.vx, server.vy,
+                      100.0f, 255,     0,        0,         serverAck};
+    toClient.emplace_back(tick + oneWayTicks, state);
+    while (!toClient.empty() && toClient.front().first <= tick) {
+      publishStateUpdate(static_cast<uint32_t>(toClient.front().first),
+                         {toClient.front().second});
+      toClient.pop_front();
+      maxCorrection =
+          std::max(maxCorrection, prediction.getCorrectionDistance());
+    }
+    tick++;
+  }
+};
+
+WorldConfig simWorld() {
+  return WorldConfig(LatencySim::WORLD_SIZE, LatencySim::WORLD_SIZE, nullptr);
+}
+
+}  // namespace
+
 TEST(ClientPrediction_ColorSyncDuringReconciliation) {
   resetEventBus();
   NetworkClient client(std::make_unique<ENetTransport>());
@@ -127,12 +200,97 @@ TEST(ClientPrediction_ObjectiveStorage) {
   assert(objectives.at(2).enemiesRequired == 5);
 }
 
+TEST(ClientPrediction_MatchingServerNeverReplays) {
+  resetEventBus();
+  NetworkClient client(std::make_unique<ENetTransport>());
+  ClientPrediction prediction(&client, 1, simWorld());
+
+  // 200ms round trip: ~12 inputs in flight at any time
+  LatencySim sim(prediction, 6);
+  for (int i = 0; i < 240; i++) {
+    sim.step();
+  }
+
+  assert(prediction.getReplayCount() == 0);
+  assert(sim.maxCorrection == 0.0f);
+  for (int i = 0; i < 12; i++) {
+    sim.step(false, false, false, false);
+  }
+  const Player& player = prediction.getLocalPlayer();
+  assert(floatEqual(player.x, sim.server.x));
+  assert(floatEqual(player.y, sim.server.y));
+}
+
+TEST(ClientPrediction_DivergenceIsReplayedAndSmoothed) {
+  resetEventBus();
+  NetworkClient client(std::make_unique<ENetTransport>());
+  ClientPrediction prediction(&client, 1, simWorld());
+  LatencySim sim(prediction, 6);
+  for (int i = 0; i < 100; i++) {
+    sim.step();
+  }
+
+  // Something the client could not predict (a knockback)
+  sim.server.x += 20.0f;
+  float shownX = 0.0f;
+  float shownY = 0.0f;
+  while (prediction.getReplayCount() == 0) {
+    shownX = prediction.getRenderX();
+    shownY = prediction.getRenderY();
+    sim.step();
+  }
+
+  // Rewound and replayed, but drawn no further than one tick's movement
+  // from the last frame: the whole error is left to smooth out
+  float tickMove = Config::Player::SPEED * 16.67f / 1000.0f;
+  assert(std::hypot(prediction.getRenderX() - shownX,
+                    prediction.getRenderY() - shownY) <= tickMove + 0.01f);
+  assert(floatEqual(sim.maxCorrection, 20.0f, 0.01f));
+
+  // Later acks agree with the replayed predictions; the offset fades
+  float previous = prediction.getCorrectionDistance();
+  for (int i = 0; i < 20; i++) {
+    sim.step();
+    assert(prediction.getCorrectionDistance() < previous ||
+           prediction.getCorrectionDistance() == 0.0f);
+    previous = prediction.getCorrectionDistance();
+  }
+  assert(prediction.getReplayCount() == 1);
+  assert(prediction.getCorrectionDistance() < 1.0f);
+
+  for (int i = 0; i < 12; i++) {
+    sim.step(false, false, false, false);
+  }
+  assert(floatEqual(prediction.getLocalPlayer().x, sim.server.x));
+  assert(floatEqual(prediction.getLocalPlayer().y, sim.server.y));
+}
+
+TEST(ClientPrediction_TeleportSnaps) {
+  resetEventBus();
+  NetworkClient client(std::make_unique<ENetTransport>());
+  ClientPrediction prediction(&client, 1, simWorld());
+  LatencySim sim(prediction, 3);
+  for (int i = 0; i < 30; i++) {
+    sim.step();
+  }
+
+  sim.server.x += 1000.0f;
+  while (prediction.getReplayCount() == 0) {
+    sim.step();
+  }
+  assert(sim.maxCorrection == 0.0f);
+  assert(prediction.getRenderX() == prediction.getLocalPlayer().x);
+}
+
 int main() {
   Logger::init();
 
   test_ClientPrediction_ColorSyncDuringReconciliation();
   test_ClientPrediction_ColorPersistsAcrossMultipleReconciles();
   test_ClientPrediction_ObjectiveStorage();
+  test_ClientPrediction_MatchingServerNeverReplays();
+  test_ClientPrediction_DivergenceIsReplayedAndSmoothed();
+  test_ClientPrediction_TeleportSnaps();
 
   return 0;
 }
@@ -0,0 +1,213 @@
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "CompiledMap.h"
+#include "Logger.h"
+#include "TiledMap.h"
+
+#define TEST(name)    \
+  void test_##name(); \
+  void test_##name()
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Run from the repository root (ctest sets the working directory)
+const char* const SOURCE_MAP = "assets/maps/test_map.tmx";
+
+fs::path scratchDir() {
+  fs::path dir = fs::temp_directory_path() / "gambit_test_compiled_map";
+  fs::create_directories(dir);
+  return dir;
+}
+
+std::vector<uint8_t> readBytes(const fs::path& path) {
+  std::ifstream file(path, std::ios::binary);
+  return std::vector<uint8_t>(std::istreambuf_iterator<char>(file),
+                              std::istreambuf_iterator<char>());
+}
+
+void writeBytes(const fs::path& path, const std::vector<uint8_t>& bytes) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(bytes.data()),
+             static_cast<std::streamsize>(bytes.size()));
+}
+
+std::string normalized(const std::string& path) {
+  return fs::absolute(path).lexically_normal().generic_string();
+}
+
+void assertSameMap(const TiledMap& a, const TiledMap& b) {
+  assert(a.getWidth() == b.getWidth() && a.getHeight() == b.getHeight());
+  assert(a.getTileWidth() == b.getTileWidth());
+  assert(a.getTileHeight() == b.getTileHeight());
+  assert(normalized(a.getTilesetImagePath()) ==
+         normalized(b.getTilesetImagePath()));
+  assert(a.getTilesetColumns() == b.getTilesetColumns());
+  assert(a.getTilesetSpacing() == b.getTilesetSpacing());
+  assert(a.hasShipPosition() == b.hasShipPosition());
+  assert(a.getShipX() == b.getShipX() && a.getShipY() == b.getShipY());
+
+  size_t layerTiles = static_cast<size_t>(a.getWidth()) * a.getHeight();
+  assert(a.getTileLayers().size() == b.getTileLayers().size());
+  for (size_t i = 0; i < a.getTileLayers().size(); ++i) {
+    const uint32_t* tilesA = a.getTileLayers()[i];
+    const uint32_t* tilesB = b.getTileLayers()[i];
+    assert((tilesA == nullptr) == (tilesB == nullptr));
+    if (tilesA) {
+      assert(std::memcmp(tilesA, tilesB, layerTiles * sizeof(uint32_t)) == 0);
+    }
+  }
+
+  assert(a.getCollisionShapes().size() == b.getCollisionShapes().size());
+  for (size_t i = 0; i < a.getCollisionShapes().size(); ++i) {
+    const CollisionShape& sa = a.getCollisionShapes()[i];
+    const CollisionShape& sb = b.getCollisionShapes()[i];
+    assert(sa.aabb.x == sb.aabb.x && sa.aabb.y == sb.aabb.y);
+    assert(sa.aabb.width == sb.aabb.width);
+    assert(sa.aabb.height == sb.aabb.height);
+    assert(sa.name == sb.name && sa.objectType == sb.objectType);
+  }
+
+  assert(a.getEnemySpawns().size() == b.getEnemySpawns().size());
+  for (size_t i = 0; i < a.getEnemySpawns().size(); ++i) {
+    const EnemySpawn& ea = a.getEnemySpawns()[i];
+    const EnemySpawn& eb = b.getEnemySpawns()[i];
+    assert(ea.type == eb.type && ea.x == eb.x && ea.y == eb.y);
+    assert(ea.name == eb.name);
+  }
+
+  assert(a.getPlayerSpawns().size() == b.getPlayerSpawns().size());
+  for (size_t i = 0; i < a.getPlayerSpawns().size(); ++i) {
+    const PlayerSpawn& pa = a.getPlayerSpawns()[i];
+    const PlayerSpawn& pb = b.getPlayerSpawns()[i];
+    assert(pa.x == pb.x && pa.y == pb.y && pa.name == pb.name);
+  }
+
+  assert(a.getMusicZones().size() == b.getMusicZones().size());
+  for (size_t i = 0; i < a.getMusicZones().size(); ++i) {
+    const MusicZone& za = a.getMusicZones()[i];
+    const MusicZone& zb = b.getMusicZones()[i];
+    assert(za.name == zb.name && za.trackName == zb.trackName);
+    assert(za.x == zb.x && za.y == zb.y);
+    assert(za.width == zb.width && za.height == zb.height);
+  }
+
+  assert(a.getObjectives().size() == b.getObjectives().size());
+  for (size_t i = 0; i < a.getObjectives().size(); ++i) {
+    const Objective& oa = a.getObjectives()[i];
+    const Objective& ob = b.getObjectives()[i];
+    assert(oa.id == ob.id && oa.type == ob.type);
+    assert(oa.name == ob.name && oa.description == ob.description);
+    assert(oa.x == ob.x && oa.y == ob.y && oa.radius == ob.radius);
+    assert(oa.interactionTime == ob.interactionTime);
+    assert(oa.enemiesRequired == ob.enemiesRequired);
+    assert(oa.frogsRequired == ob.frogsRequired);
+    assert(oa.hasDepositPoint == ob.hasDepositPoint);
+    assert(oa.depositX == ob.depositX && oa.depositY == ob.depositY);
+  }
+}
+
+}  // namespace
+
+TEST(CompiledMap_RoundTripMatchesTmx) {
+  TiledMap source;
+  assert(source.loadTmx(SOURCE_MAP));
+  assert(!source.isCompiled());
+  assert(!source.getTileLayers().empty());
+
+  std::string compiledPath = (scratchDir() / "roundtrip.gmap").string();
+  assert(CompiledMap::write(source, compiledPath));
+
+  TiledMap compiled;
+  assert(CompiledMap::read(compiledPath, compiled));
+  assert(compiled.isCompiled());
+  assertSameMap(source, compiled);
+}
+
+TEST(CompiledMap_LoadPrefersCurrentCompiledFile) {
+  fs::path dir = scratchDir();
+  fs::path tmxPath = dir / "arena.tmx";
+  fs::copy_file(SOURCE_MAP, tmxPath, fs::copy_options::overwrite_existing);
+  std::string compiledPath = CompiledMap::pathFor(tmxPath.string());
+  assert(fs::path(compiledPath) == dir / "arena.gmap");
+  fs::remove(compiledPath);
+
+  // No compiled file yet: TMX
+  TiledMap map;
+  assert(map.load(tmxPath.string()));
+  assert(!map.isCompiled());
+
+  assert(CompiledMap::write(map, compiledPath));
+  TiledMap fast;
+  assert(fast.load(tmxPath.string()));
+  assert(fast.isCompiled());
+  assertSameMap(map, fast);
+
+  // Editing the TMX makes the compiled file stale until recompiled
+  fs::last_write_time(tmxPath, fs::last_write_time(compiledPath) +
+                                   std::chrono::hours(1));
+  TiledMap edited;
+  assert(edited.load(tmxPath.string()));
+  assert(!edited.isCompiled());
+
+  // A .gmap path is taken as-is
+  TiledMap direct;
+  assert(direct.load(compiledPath));
+  assert(direct.isCompiled());
+}
+
+TEST(CompiledMap_RejectsDamagedFiles) {
+  TiledMap source;
+  assert(source.loadTmx(SOURCE_MAP));
+  fs::path goodPath = scratchDir() / "good.gmap";
+  assert(CompiledMap::write(source, goodPath.string()));
+  const std::vector<uint8_t> good = readBytes(goodPath);
+
+  fs::path badPath = scratchDir() / "bad.gmap";
+  auto rejects = [&](const std::vector<uint8_t>& bytes) {
+    writeBytes(badPath, bytes);
+    // A failed read leaves the previous contents in place
+    TiledMap map;
+    assert(CompiledMap::read(goodPath.string(), map));
+    bool loaded = CompiledMap::read(badPath.string(), map);
+    assert(map.getWidth() == source.getWidth());
+    assert(map.getCollisionShapes().size() ==
+           source.getCollisionShapes().size());
+    return !loaded;
+  };
+
+  std::vector<uint8_t> bytes = good;
+  bytes[0] = 'X';  // Magic
+  assert(rejects(bytes));
+
+  bytes = good;
+  bytes[4] = static_cast<uint8_t>(CompiledMap::VERSION + 1);
+  assert(rejects(bytes));
+
+  bytes.assign(good.begin(), good.begin() + good.size() / 2);
+  assert(rejects(bytes));
+
+  assert(rejects(std::vector<uint8_t>(good.begin(), good.begin() + 8)));
+
+  assert(!CompiledMap::read((scratchDir() / "missing.gmap").string(), source));
+}
+
+int main() {
+  Logger::init();
+
+  test_CompiledMap_RoundTripMatchesTmx();
+  test_CompiledMap_LoadPrefersCurrentCompiledFile();
+  test_CompiledMap_RejectsDamagedFiles();
+
+  fs::remove_all(scratchDir());
+  return 0;
+}
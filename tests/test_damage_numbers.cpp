@@ -0,0 +1,132 @@
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include "DamageNumberPool.h"
+#include "GlyphAtlas.h"
+#include "Logger.h"
+
+#define TEST(name)    \
+  void test_##name(); \
+  void test_##name()
+
+namespace {
+
+struct Number {
+  float worldX, worldY, alpha;
+  int32_t value;
+  DamageNumberType type;
+};
+
+std::vector<Number> collect(const DamageNumberPool& pool) {
+  std::vector<Number> numbers;
+  pool.forEach([&](float x, float y, float alpha, int32_t value,
+                   DamageNumberType type) {
+    numbers.push_back(Number{x, y, alpha, value, type});
+  });
+  return numbers;
+}
+
+bool near(float a, float b) { return std::fabs(a - b) < 1e-4f; }
+
+}  // namespace
+
+TEST(DamageNumberPool_RisesFadesAndExpires) {
+  DamageNumberPool pool;
+  pool.spawn(100.0f, 50.0f, 42.7f, DamageNumberType::Critical);
+  assert(pool.size() == 1);
+
+  auto numbers = collect(pool);
+  assert(numbers[0].value == 42);  // Truncated like the old text
+  assert(numbers[0].alpha == 1.0f);
+  assert(numbers[0].type == DamageNumberType::Critical);
+
+  // Before FADE_START: rising, fully opaque
+  pool.update(0.25f);
+  numbers = collect(pool);
+  const float risen = 50.0f - 0.25f * DamageNumberPool::RISE_SPEED;
+  assert(near(numbers[0].worldY, risen));
+  assert(numbers[0].worldX == 100.0f);
+  assert(numbers[0].alpha == 1.0f);
+
+  // Halfway through the fade
+  pool.update(0.5f);
+  numbers = collect(pool);
+  assert(near(numbers[0].alpha, 0.5f));
+
+  pool.update(0.25f);
+  assert(pool.empty());
+}
+
+TEST(DamageNumberPool_ExpiresOldestFirst) {
+  DamageNumberPool pool;
+  pool.spawn(0, 0, 1, DamageNumberType::Damage);
+  pool.update(0.6f);
+  pool.spawn(0, 0, 2, DamageNumberType::Healing);
+  pool.update(0.6f);
+
+  auto numbers = collect(pool);
+  assert(numbers.size() == 1);
+  assert(numbers[0].value == 2);
+  assert(numbers[0].type == DamageNumberType::Healing);
+}
+
+TEST(DamageNumberPool_OverwritesOldestWhenFull) {
+  DamageNumberPool pool;
+  const int total = static_cast<int>(DamageNumberPool::CAPACITY) + 10;
+  for (int i = 0; i < total; ++i) {
+    pool.spawn(0, 0, static_cast<float>(i), DamageNumberType::PlayerDamage);
+  }
+  assert(pool.size() == DamageNumberPool::CAPACITY);
+
+  auto numbers = collect(pool);
+  assert(numbers.front().value == 10);
+  assert(numbers.back().value == total - 1);
+
+  pool.update(DamageNumberPool::DISPLAY_DURATION);
+  assert(pool.empty());
+}
+
+TEST(GlyphAtlas_CoversDamageText) {
+  GlyphAtlas atlas;
+  assert(atlas.getHeight() == GlyphAtlas::GLYPH_HEIGHT);
+  assert(atlas.getPixels().size() ==
+         static_cast<size_t>(atlas.getWidth()) * atlas.getHeight() * 4);
+
+  int lastX = -1;
+  for (char c : {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '-',
+                 '!'}) {
+    int srcX, srcY;
+    assert(atlas.getGlyph(c, srcX, srcY));
+    assert(srcY == 0);
+    assert(srcX > lastX);
+    assert(srcX + GlyphAtlas::GLYPH_WIDTH <= atlas.getWidth());
+    lastX = srcX;
+
+    // Every glyph has some opaque pixels
+    bool inked = false;
+    for (int y = 0; y < GlyphAtlas::GLYPH_HEIGHT; ++y) {
+      for (int x = 0; x < GlyphAtlas::GLYPH_WIDTH; ++x) {
+        size_t offset =
+            (static_cast<size_t>(y) * atlas.getWidth() + srcX + x) * 4;
+        inked |= atlas.getPixels()[offset + 3] == 255;
+      }
+    }
+    assert(inked);
+  }
+
+  int srcX, srcY;
+  assert(!atlas.getGlyph('A', srcX, srcY));
+  assert(!atlas.getGlyph('\0', srcX, srcY));
+}
+
+int main() {
+  Logger::init();
+
+  test_DamageNumberPool_RisesFadesAndExpires();
+  test_DamageNumberPool_ExpiresOldestFirst();
+  test_DamageNumberPool_OverwritesOldestWhenFull();
+  test_GlyphAtlas_CoversDamageText();
+
+  return 0;
+}
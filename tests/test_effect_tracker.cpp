@@ -0,0 +1,143 @@
+#include <cassert>
+#include <vector>
+
+#include "EffectTracker.h"
+#include "Logger.h"
+#include "test_utils.h"
+
+namespace {
+
+void publishEffects(uint32_t targetId, bool isEnemy, uint8_t stacks) {
+  EffectUpdatePacket packet;
+  packet.targetId = targetId;
+  packet.isEnemy = isEnemy;
+  if (stacks > 0) {
+    packet.effects.push_back(
+        {static_cast<uint8_t>(EffectType::Slow), stacks, 2000.0f});
+  }
+  auto serialized = serialize(packet);
+  EventBus::instance().publish(
+      NetworkPacketReceivedEvent{0, serialized.data(), serialized.size()});
+}
+
+void publishEnemyDied(uint32_t enemyId) {
+  EnemyDiedPacket packet;
+  packet.enemyId = enemyId;
+  packet.killerId = 1;
+  auto serialized = serialize(packet);
+  EventBus::instance().publish(
+      NetworkPacketReceivedEvent{0, serialized.data(), serialized.size()});
+}
+
+}  // namespace
+
+TEST(EffectTracker_IndexesAffectedEntitiesInOrder) {
+  resetEventBus();
+  EffectTracker tracker(EventBus::instance());
+
+  publishEffects(250, true, 1);
+  publishEffects(7, true, 2);
+  publishEffects(120, true, 1);
+  publishEffects(7, true, 3);  // Refresh; not a second entry
+  publishEffects(3, false, 1);
+
+  const auto& enemies = tracker.getAffectedEntities(true);
+  assert((enemies == std::vector<uint32_t>{7, 120, 250}));
+  assert(tracker.getEffects(7, true).front().stacks == 3);
+  assert((tracker.getAffectedEntities(false) == std::vector<uint32_t>{3}));
+
+  // Effects running out drop the entity from the index
+  publishEffects(120, true, 0);
+  assert((enemies == std::vector<uint32_t>{7, 250}));
+  assert(!tracker.hasEffects(120, true));
+
+  // Clearing an entity that never had effects is harmless
+  publishEffects(999, true, 0);
+  assert(enemies.size() == 2);
+}
+
+TEST(EffectTracker_RelevantEnemiesAreOnScreenOrTargeted) {
+  resetEventBus();
+  EffectTracker tracker(EventBus::instance());
+
+  publishEffects(5, true, 1);
+  publishEffects(150, true, 1);
+  publishEffects(400, true, 1);
+
+  std::vector<uint32_t> relevant;
+  auto onlyFive = [](uint32_t id) { return id == 5; };
+  tracker.collectRelevantEnemies(onlyFive, relevant);
+  assert((relevant == std::vector<uint32_t>{5}));
+
+  // Attacking an off-screen enemy keeps its effects in view
+  EventBus::instance().publish(LocalAttackEvent{400});
+  assert(tracker.getTargetedEnemy() == 400);
+  tracker.collectRelevantEnemies(onlyFive, relevant);
+  assert((relevant == std::vector<uint32_t>{5, 400}));
+
+  // Only ids that have effects are ever asked about
+  size_t asked = 0;
+  tracker.collectRelevantEnemies(
+      [&](uint32_t) {
+        ++asked;
+        return false;
+      },
+      relevant);
+  assert(asked == 2);
+  assert((relevant == std::vector<uint32_t>{400}));
+}
+
+TEST(EffectTracker_ForgetsDeadEnemies) {
+  resetEventBus();
+  EffectTracker tracker(EventBus::instance());
+
+  publishEffects(5, true, 1);
+  publishEffects(9, true, 2);
+  publishEffects(5, false, 1);  // Player with the same id is unaffected
+  EventBus::instance().publish(LocalAttackEvent{9});
+
+  publishEnemyDied(9);
+  assert((tracker.getAffectedEntities(true) == std::vector<uint32_t>{5}));
+  assert(!tracker.hasEffects(9, true));
+  assert(tracker.getTargetedEnemy() == 0);
+  assert(tracker.hasEffects(5, false));
+
+  // Killing an untargeted enemy leaves the target alone
+  EventBus::instance().publish(LocalAttackEvent{5});
+  publishEnemyDied(42);
+  assert(tracker.getTargetedEnemy() == 5);
+  assert(tracker.getAffectedEntities(true).size() == 1);
+
+  publishEnemyDied(5);
+  assert(tracker.getAffectedEntities(true).empty());
+  assert(tracker.getTargetedEnemy() == 0);
+}
+
+TEST(EffectTracker_UnsubscribesOnDestruction) {
+  resetEventBus();
+  {
+    EffectTracker tracker(EventBus::instance());
+    assert(EventBus::instance().subscriberCount<LocalAttackEvent>() == 1);
+    assert(EventBus::instance()
+               .subscriberCount<NetworkPacketReceivedEvent>() == 1);
+  }
+  assert(EventBus::instance().subscriberCount<LocalAttackEvent>() == 0);
+  assert(EventBus::instance().subscriberCount<NetworkPacketReceivedEvent>() ==
+         0);
+
+  // Nothing left to call into the destroyed tracker
+  EventBus::instance().publish(LocalAttackEvent{7});
+  publishEffects(5, true, 1);
+}
+
+int main() {
+  Logger::init();
+
+  test_EffectTracker_IndexesAffectedEntitiesInOrder();
+  test_EffectTracker_RelevantEnemiesAreOnScreenOrTargeted();
+  test_EffectTracker_ForgetsDeadEnemies();
+  test_EffectTracker_UnsubscribesOnDestruction();
+
+  resetEventBus();
+  return 0;
+}
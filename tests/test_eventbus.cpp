@@ -1,3 +1,5 @@
+#include <memory>
+
 #include "EventBus.h"
 #include "Logger.h"
 #include "test_utils.h"
@@ -103,6 +105,248 @@ TEST(EventCapture_Assertions) {
   resetEventBus();
 }
 
+TEST(EventBus_EnqueueDeferredUntilFlush) {
+  resetEventBus();
+  EventCapture<UpdateEvent> capture;
+
+  EventBus::instance().enqueue(UpdateEvent{16.67f, 1},
+                               EventPhase::AfterSimulation);
+  EventBus::instance().enqueue(UpdateEvent{16.67f, 2},
+                               EventPhase::AfterSimulation);
+
+  // Nothing delivered until the phase is flushed
+  capture.assertCount(0);
+  assert(EventBus::instance().hasPending(EventPhase::AfterSimulation));
+
+  // Flushing a different phase does not deliver
+  EventBus::instance().flush(EventPhase::BeforeBroadcast);
+  capture.assertCount(0);
+
+  EventBus::instance().flush(EventPhase::AfterSimulation);
+  capture.assertCount(2);
+  assert(capture.first().frameNumber == 1);
+  assert(capture.last().frameNumber == 2);
+  assert(!EventBus::instance().hasPending(EventPhase::AfterSimulation));
+
+  resetEventBus();
+}
+
+TEST(EventBus_BatchHandlerReceivesSpan) {
+  resetEventBus();
+  int batchCalls = 0;
+  size_t lastBatchSize = 0;
+  uint64_t frameSum = 0;
+
+  EventBus::instance().subscribeBatch<UpdateEvent>(
+      [&](EventSpan<UpdateEvent> events) {
+        batchCalls++;
+        lastBatchSize = events.size();
+        for (const auto& e : events) {
+          frameSum += e.frameNumber;
+        }
+      });
+
+  for (uint64_t i = 1; i <= 10; ++i) {
+    EventBus::instance().enqueue(UpdateEvent{16.67f, i},
+                                 EventPhase::AfterNetworkReceive);
+  }
+  EventBus::instance().flush(EventPhase::AfterNetworkReceive);
+
+  assert(batchCalls == 1);
+  assert(lastBatchSize == 10);
+  assert(frameSum == 55);
+
+  // Empty flush does not call batch handlers
+  EventBus::instance().flush(EventPhase::AfterNetworkReceive);
+  assert(batchCalls == 1);
+
+  // Synchronous publish does not go through batch handlers
+  EventBus::instance().publish(UpdateEvent{16.67f, 99});
+  assert(batchCalls == 1);
+
+  resetEventBus();
+}
+
+TEST(EventBus_EnqueueDuringFlushDeliveredSamePhase) {
+  resetEventBus();
+  std::vector<uint32_t> delivered;
+
+  // Each death below id 3 "causes" another one, like CaptureOutpost
+  // completion killing enemies in its radius
+  EventBus::instance().subscribeBatch<EnemyDiedEvent>(
+      [&](EventSpan<EnemyDiedEvent> deaths) {
+        for (const auto& death : deaths) {
+          delivered.push_back(death.enemyId);
+          if (death.enemyId < 3) {
+            EventBus::instance().enqueue(
+                EnemyDiedEvent{death.enemyId + 1, 0, 0.0f, 0.0f},
+                EventPhase::AfterSimulation);
+          }
+        }
+      });
+
+  EventBus::instance().enqueue(EnemyDiedEvent{1, 7, 0.0f, 0.0f},
+                               EventPhase::AfterSimulation);
+  EventBus::instance().flush(EventPhase::AfterSimulation);
+
+  assert(delivered.size() == 3);
+  assert(delivered[0] == 1);
+  assert(delivered[1] == 2);
+  assert(delivered[2] == 3);
+  assert(!EventBus::instance().hasPending(EventPhase::AfterSimulation));
+
+  resetEventBus();
+}
+
+TEST(EventBus_ClearDropsQueuedEvents) {
+  resetEventBus();
+  EventBus::instance().enqueue(UpdateEvent{16.67f, 1},
+                               EventPhase::BeforeBroadcast);
+  resetEventBus();
+
+  EventCapture<UpdateEvent> capture;
+  EventBus::instance().flush(EventPhase::BeforeBroadcast);
+  capture.assertCount(0);
+
+  resetEventBus();
+}
+
+TEST(EventBus_UnsubscribeStopsDelivery) {
+  resetEventBus();
+  int calls = 0;
+  SubscriptionId id = EventBus::instance().subscribe<UpdateEvent>(
+      [&calls](const UpdateEvent&) { calls++; });
+
+  EventBus::instance().publish(UpdateEvent{16.67f, 1});
+  assert(calls == 1);
+
+  EventBus::instance().unsubscribe(id);
+  EventBus::instance().publish(UpdateEvent{16.67f, 2});
+  assert(calls == 1);
+  assert(EventBus::instance().subscriberCount<UpdateEvent>() == 0);
+
+  // Unknown and repeated ids are ignored
+  EventBus::instance().unsubscribe(id);
+  EventBus::instance().unsubscribe(0);
+
+  resetEventBus();
+}
+
+TEST(EventBus_ScopedSubscriptionReleasedOnDestruction) {
+  resetEventBus();
+  int calls = 0;
+  {
+    Subscription subscription =
+        EventBus::instance().subscribeScoped<UpdateEvent>(
+            [&calls](const UpdateEvent&) { calls++; });
+    EventBus::instance().publish(UpdateEvent{16.67f, 1});
+    assert(calls == 1);
+
+    // Moving transfers ownership; the moved-from handle is inert
+    Subscription moved = std::move(subscription);
+    assert(!subscription.isActive());
+    assert(moved.isActive());
+    EventBus::instance().publish(UpdateEvent{16.67f, 2});
+    assert(calls == 2);
+  }
+
+  EventBus::instance().publish(UpdateEvent{16.67f, 3});
+  assert(calls == 2);
+  assert(EventBus::instance().subscriberCount<UpdateEvent>() == 0);
+
+  resetEventBus();
+}
+
+TEST(EventBus_UnsubscribeSelfDuringPublish) {
+  resetEventBus();
+  int firstCalls = 0;
+  int secondCalls = 0;
+  SubscriptionId firstId = 0;
+
+  firstId = EventBus::instance().subscribe<UpdateEvent>(
+      [&](const UpdateEvent&) {
+        firstCalls++;
+        EventBus::instance().unsubscribe(firstId);
+      });
+  EventBus::instance().subscribe<UpdateEvent>(
+      [&secondCalls](const UpdateEvent&) { secondCalls++; });
+
+  EventBus::instance().publish(UpdateEvent{16.67f, 1});
+  EventBus::instance().publish(UpdateEvent{16.67f, 2});
+
+  // Handler after the removed one still runs on the in-flight event
+  assert(firstCalls == 1);
+  assert(secondCalls == 2);
+  assert(EventBus::instance().subscriberCount<UpdateEvent>() == 1);
+
+  resetEventBus();
+}
+
+TEST(EventBus_SelfUnsubscribeKeepsRunningHandlerAlive) {
+  resetEventBus();
+  auto token = std::make_shared<int>(0);
+  std::weak_ptr<int> watch = token;
+  SubscriptionId id = 0;
+
+  // The handler owns the only reference to `token`. Unsubscribing must not
+  // destroy the closure while it is still executing.
+  id = EventBus::instance().subscribe<UpdateEvent>(
+      [token, &id, watch](const UpdateEvent&) {
+        EventBus::instance().unsubscribe(id);
+        assert(!watch.expired());
+        (*token)++;
+      });
+  token.reset();
+
+  EventBus::instance().publish(UpdateEvent{16.67f, 1});
+  assert(watch.expired());
+  assert(EventBus::instance().subscriberCount<UpdateEvent>() == 0);
+
+  // Same for a scoped subscription destroyed inside its own callback
+  auto subscription = std::make_unique<Subscription>();
+  auto scopedToken = std::make_shared<int>(0);
+  std::weak_ptr<int> scopedWatch = scopedToken;
+  *subscription = EventBus::instance().subscribeScoped<UpdateEvent>(
+      [scopedToken, &subscription, scopedWatch](const UpdateEvent&) {
+        subscription.reset();
+        assert(!scopedWatch.expired());
+        (*scopedToken)++;
+      });
+  scopedToken.reset();
+
+  EventBus::instance().publish(UpdateEvent{16.67f, 2});
+  assert(!subscription);
+  assert(scopedWatch.expired());
+  assert(EventBus::instance().subscriberCount<UpdateEvent>() == 0);
+
+  resetEventBus();
+}
+
+TEST(EventBus_InstancesAreIndependent) {
+  resetEventBus();
+  EventBus matchA;
+  EventBus matchB;
+
+  EventCapture<UpdateEvent> globalCapture;
+  EventCapture<UpdateEvent> captureA(matchA);
+  EventCapture<UpdateEvent> captureB(matchB);
+
+  matchA.publish(UpdateEvent{16.67f, 1});
+  matchA.enqueue(UpdateEvent{16.67f, 2}, EventPhase::AfterSimulation);
+  matchB.flush(EventPhase::AfterSimulation);
+
+  captureA.assertCount(1);
+  captureB.assertCount(0);
+  globalCapture.assertCount(0);
+
+  matchA.flush(EventPhase::AfterSimulation);
+  captureA.assertCount(2);
+  assert(captureA.last().frameNumber == 2);
+  captureB.assertCount(0);
+
+  resetEventBus();
+}
+
 int main() {
   Logger::init();
 
@@ -112,6 +356,15 @@ int main() {
   test_EventBus_PublishWithNoSubscribers();
   test_EventBus_Clear();
   test_EventCapture_Assertions();
+  test_EventBus_EnqueueDeferredUntilFlush();
+  test_EventBus_BatchHandlerReceivesSpan();
+  test_EventBus_EnqueueDuringFlushDeliveredSamePhase();
+  test_EventBus_ClearDropsQueuedEvents();
+  test_EventBus_UnsubscribeStopsDelivery();
+  test_EventBus_ScopedSubscriptionReleasedOnDestruction();
+  test_EventBus_UnsubscribeSelfDuringPublish();
+  test_EventBus_SelfUnsubscribeKeepsRunningHandlerAlive();
+  test_EventBus_InstancesAreIndependent();
 
   return 0;
 }
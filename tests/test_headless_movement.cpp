@@ -57,6 +57,7 @@ void runHeadlessClientForFrames(NetworkClient& client,
 TEST(HeadlessMovement_RightMovement) {
   Logger::init();
   resetEventBus();
+  EventBus& bus = EventBus::instance();
 
   // Load items
   ItemRegistry::instance().loadFromCSV("assets/items.csv");
@@ -85,20 +86,21 @@ TEST(HeadlessMovement_RightMovement) {
   ClientPrediction clientPrediction(&client, localPlayerId, world);
 
   // Create input script: Move right for 30 frames
-  InputScript inputScript;
+  InputScript inputScript(bus);
   inputScript.addMove(10, 30, false, true, false, false);  // Move right
   window.setInputScript(&inputScript);
 
-  InputSystem inputSystem(&clientPrediction, nullptr, nullptr);
-  AnimationSystem animationSystem;
-  MusicSystem musicSystem(&clientPrediction, &map);
+  InputSystem inputSystem(&clientPrediction, nullptr, nullptr, nullptr, bus);
+  AnimationSystem animationSystem(bus);
+  MusicSystem musicSystem(&clientPrediction, &map, bus);
   RemotePlayerInterpolation remoteInterpolation(localPlayerId,
                                                 &animationSystem);
   EnemyInterpolation enemyInterpolation(&animationSystem);
-  CombatSystem combatSystem(&client, &clientPrediction, &enemyInterpolation);
-  HeadlessRenderSystem renderSystem;
-  EffectTracker effectTracker;
-  HeadlessUISystem uiSystem;
+  CombatSystem combatSystem(&client, &clientPrediction, &enemyInterpolation,
+                            bus);
+  HeadlessRenderSystem renderSystem(bus);
+  EffectTracker effectTracker(bus);
+  HeadlessUISystem uiSystem(bus);
 
   // Capture events
   EventCapture<LocalInputEvent> inputEvents;
@@ -160,6 +162,7 @@ TEST(HeadlessMovement_RightMovement) {
 TEST(HeadlessMovement_DiagonalMovement) {
   Logger::init();
   resetEventBus();
+  EventBus& bus = EventBus::instance();
 
   ItemRegistry::instance().loadFromCSV("assets/items.csv");
 
@@ -185,20 +188,21 @@ TEST(HeadlessMovement_DiagonalMovement) {
   ClientPrediction clientPrediction(&client, localPlayerId, world);
 
   // Create input script: Move diagonally (up-right) for 30 frames
-  InputScript inputScript;
+  InputScript inputScript(bus);
   inputScript.addMove(10, 30, false, true, true, false);  // Up-right
   window.setInputScript(&inputScript);
 
-  InputSystem inputSystem(&clientPrediction, nullptr, nullptr);
-  AnimationSystem animationSystem;
-  MusicSystem musicSystem(&clientPrediction, &map);
+  InputSystem inputSystem(&clientPrediction, nullptr, nullptr, nullptr, bus);
+  AnimationSystem animationSystem(bus);
+  MusicSystem musicSystem(&clientPrediction, &map, bus);
   RemotePlayerInterpolation remoteInterpolation(localPlayerId,
                                                 &animationSystem);
   EnemyInterpolation enemyInterpolation(&animationSystem);
-  CombatSystem combatSystem(&client, &clientPrediction, &enemyInterpolation);
-  HeadlessRenderSystem renderSystem;
-  EffectTracker effectTracker;
-  HeadlessUISystem uiSystem;
+  CombatSystem combatSystem(&client, &clientPrediction, &enemyInterpolation,
+                            bus);
+  HeadlessRenderSystem renderSystem(bus);
+  EffectTracker effectTracker(bus);
+  HeadlessUISystem uiSystem(bus);
 
   // Capture events
   EventCapture<LocalInputEvent> inputEvents;
@@ -24,14 +24,16 @@ TEST(InputSystem_KeyBindings) {
 
   for (const auto& keyTest : keys) {
     resetEventBus();
-    InputSystem inputSystem(nullptr, nullptr, nullptr);
+    InputSystem inputSystem(nullptr, nullptr, nullptr, nullptr,
+                            EventBus::instance());
 
     LocalInputEvent downEvent =
         publishKeyAndUpdate(inputSystem, keyTest.sdlKey, true);
     assert(*keyTest.flagPtr(downEvent) == true);
 
     resetEventBus();
-    InputSystem inputSystem2(nullptr, nullptr, nullptr);
+    InputSystem inputSystem2(nullptr, nullptr, nullptr, nullptr,
+                             EventBus::instance());
     LocalInputEvent upEvent =
         publishKeyAndUpdate(inputSystem2, keyTest.sdlKey, false);
     assert(*keyTest.flagPtr(upEvent) == false);
@@ -41,7 +43,8 @@ TEST(InputSystem_KeyBindings) {
 TEST(InputSystem_AllDirections) {
   resetEventBus();
   GameStateManager::instance().transitionTo(GameState::Playing);
-  InputSystem inputSystem(nullptr, nullptr, nullptr);
+  InputSystem inputSystem(nullptr, nullptr, nullptr, nullptr,
+                          EventBus::instance());
 
   EventBus::instance().publish(KeyDownEvent{SDLK_w});
   EventBus::instance().publish(KeyDownEvent{SDLK_a});
@@ -61,7 +64,8 @@ TEST(InputSystem_AllDirections) {
 TEST(InputSystem_SequenceIncrement) {
   resetEventBus();
   GameStateManager::instance().transitionTo(GameState::Playing);
-  InputSystem inputSystem(nullptr, nullptr, nullptr);
+  InputSystem inputSystem(nullptr, nullptr, nullptr, nullptr,
+                          EventBus::instance());
 
   uint32_t sequences[3] = {0};
   int count = 0;
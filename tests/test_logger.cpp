@@ -0,0 +1,92 @@
+#include <cassert>
+#include <string>
+
+#include "Logger.h"
+
+#define TEST(name)    \
+  void test_##name(); \
+  void test_##name()
+
+namespace {
+
+// Counts how often it gets formatted
+struct Probe {
+  static int formatted;
+};
+int Probe::formatted = 0;
+
+}  // namespace
+
+template <>
+struct fmt::formatter<Probe> : fmt::formatter<std::string> {
+  template <typename FormatContext>
+  auto format(const Probe&, FormatContext& ctx) const -> decltype(ctx.out()) {
+    ++Probe::formatted;
+    return fmt::formatter<std::string>::format("probe", ctx);
+  }
+};
+
+TEST(Logger_DisabledLinesAreNotFormatted) {
+  Logger::setLevel(LogSubsystem::Enemy, LogLevel::Info);
+  Probe::formatted = 0;
+
+  Logger::debug(LogSubsystem::Enemy, "Enemy {} detail {}", 7, Probe{});
+  assert(Probe::formatted == 0);
+
+  Logger::info(LogSubsystem::Enemy, "Enemy {} spawned ({})", 7, Probe{});
+  assert(Probe::formatted == 1);
+
+  // Other subsystems keep their own level
+  Logger::setLevel(LogSubsystem::Enemy, LogLevel::Off);
+  Logger::error(LogSubsystem::Enemy, "{}", Probe{});
+  Logger::info(LogSubsystem::Effect, "{}", Probe{});
+  assert(Probe::formatted == 2);
+
+  Logger::setLevel(LogSubsystem::Enemy, LogLevel::Info);
+}
+
+TEST(Logger_DebugFollowsBuildFilter) {
+  Logger::setLevel(LogSubsystem::Combat, LogLevel::Debug);
+  Probe::formatted = 0;
+
+  Logger::debug(LogSubsystem::Combat, "{}", Probe{});
+  assert(Probe::formatted == (GAMBIT_LOG_MIN_LEVEL == 0 ? 1 : 0));
+
+  Logger::setLevel(LogSubsystem::Combat, LogLevel::Info);
+}
+
+TEST(Logger_ConfigureParsesSpec) {
+  assert(Logger::configure("error,enemy=debug,network=off"));
+  assert(Logger::getLevel(LogSubsystem::General) == LogLevel::Error);
+  assert(Logger::getLevel(LogSubsystem::Effect) == LogLevel::Error);
+  assert(Logger::getLevel(LogSubsystem::Enemy) == LogLevel::Debug);
+  assert(Logger::getLevel(LogSubsystem::Network) == LogLevel::Off);
+  assert(Logger::isEnabled(LogSubsystem::Enemy, LogLevel::Debug));
+  assert(!Logger::isEnabled(LogSubsystem::Network, LogLevel::Error));
+
+  // Bad parts are skipped, good ones still apply
+  assert(!Logger::configure("info,bogus=debug,enemy=loud,audio=error"));
+  assert(Logger::getLevel(LogSubsystem::Enemy) == LogLevel::Info);
+  assert(Logger::getLevel(LogSubsystem::Audio) == LogLevel::Error);
+
+  assert(Logger::configure("info"));
+}
+
+TEST(Logger_BurstDoesNotBlock) {
+  // Far more lines than the queue holds; the oldest are dropped
+  for (int i = 0; i < 50000; ++i) {
+    Logger::info(LogSubsystem::Network, "burst line {}", i);
+  }
+  Logger::info("Burst done");
+}
+
+int main() {
+  Logger::init();
+
+  test_Logger_DisabledLinesAreNotFormatted();
+  test_Logger_DebugFollowsBuildFilter();
+  test_Logger_ConfigureParsesSpec();
+  test_Logger_BurstDoesNotBlock();
+
+  return 0;
+}
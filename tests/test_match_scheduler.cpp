@@ -0,0 +1,153 @@
+#include <memory>
+#include <vector>
+
+#include "EventBus.h"
+#include "InMemoryChannel.h"
+#include "Logger.h"
+#include "Match.h"
+#include "MatchScheduler.h"
+#include "NetworkProtocol.h"
+#include "WorldConfig.h"
+#include "test_utils.h"
+#include "transport/InMemoryServerTransport.h"
+
+// Matches without a TiledMap: no enemies/objectives, but the full
+// NetworkServer + ServerGameState stack runs on each match's bus
+struct TestMatches {
+  WorldConfig world{800.0f, 600.0f};
+  std::vector<std::shared_ptr<InMemoryChannel>> channels;
+  std::vector<std::unique_ptr<Match>> matches;
+
+  explicit TestMatches(size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      auto channel = createInMemoryChannel();
+      auto match = std::make_unique<Match>(
+          static_cast<uint32_t>(i),
+          std::make_unique<InMemoryServerTransport>(channel), world);
+      bool initialized = match->initialize("embedded", 0);
+      assert(initialized && "Match failed to initialize");
+      (void)initialized;
+      channels.push_back(channel);
+      matches.push_back(std::move(match));
+    }
+  }
+};
+
+TEST(MatchScheduler_TicksEveryMatchOncePerRound) {
+  resetEventBus();
+  TestMatches test(8);
+  MatchScheduler scheduler(3);
+  for (auto& match : test.matches) {
+    scheduler.addMatch(match.get());
+  }
+
+  for (int round = 0; round < 50; ++round) {
+    scheduler.tickAll();
+  }
+
+  assert(scheduler.getRoundCount() == 50);
+  for (auto& match : test.matches) {
+    assert(match->getFrameNumber() == 50);
+  }
+
+  resetEventBus();
+}
+
+TEST(MatchScheduler_MoreThreadsThanMatches) {
+  resetEventBus();
+  TestMatches test(2);
+  MatchScheduler scheduler(6);
+  for (auto& match : test.matches) {
+    scheduler.addMatch(match.get());
+  }
+
+  for (int round = 0; round < 20; ++round) {
+    scheduler.tickAll();
+  }
+
+  assert(test.matches[0]->getFrameNumber() == 20);
+  assert(test.matches[1]->getFrameNumber() == 20);
+
+  resetEventBus();
+}
+
+TEST(MatchScheduler_MatchesHaveIndependentBuses) {
+  resetEventBus();
+  TestMatches test(3);
+  EventCapture<UpdateEvent> globalUpdates;
+  EventCapture<UpdateEvent> match0Updates(test.matches[0]->getEventBus());
+  EventCapture<ClientConnectedEvent> match0Connects(
+      test.matches[0]->getEventBus());
+  EventCapture<ClientConnectedEvent> match1Connects(
+      test.matches[1]->getEventBus());
+
+  MatchScheduler scheduler(2);
+  for (auto& match : test.matches) {
+    scheduler.addMatch(match.get());
+  }
+
+  // Only match 0 gets a client
+  test.channels[0]->clientWantsConnect = true;
+  for (int round = 0; round < 5; ++round) {
+    scheduler.tickAll();
+  }
+
+  match0Updates.assertCount(5);
+  globalUpdates.assertCount(0);
+  match0Connects.assertCount(1);
+  match1Connects.assertCount(0);
+
+  resetEventBus();
+}
+
+TEST(Match_InputsAppliedInAfterNetworkReceiveFlush) {
+  resetEventBus();
+  TestMatches test(1);
+  Match& match = *test.matches[0];
+  InMemoryChannel& channel = *test.channels[0];
+  EventCapture<ClientInputReceivedEvent> inputs(match.getEventBus());
+
+  channel.clientWantsConnect = true;
+  match.tick();
+
+  ClientInputPacket input;
+  input.inputSequence = 1;
+  input.moveLeft = false;
+  input.moveRight = true;
+  input.moveUp = false;
+  input.moveDown = false;
+  auto bytes = serialize(input);
+  bool pushed = channel.clientToServer.push(bytes.data(), bytes.size());
+  assert(pushed);
+
+  // Decoded in the receive path, applied by the flush at the end of poll
+  match.tick();
+  inputs.assertCount(1);
+  assert(inputs.last().clientId == 1);
+  assert(inputs.last().moveRight);
+  assert(!match.getEventBus().hasPending(EventPhase::AfterNetworkReceive));
+
+  // Input still in the ring when the client disconnects is dropped by the
+  // flush instead of touching the removed player
+  input.inputSequence = 2;
+  bytes = serialize(input);
+  pushed = channel.clientToServer.push(bytes.data(), bytes.size());
+  assert(pushed);
+  (void)pushed;
+  channel.clientWantsDisconnect = true;
+  match.tick();
+  inputs.assertCount(2);
+
+  resetEventBus();
+}
+
+int main() {
+  Logger::init();
+
+  test_MatchScheduler_TicksEveryMatchOncePerRound();
+  test_MatchScheduler_MoreThreadsThanMatches();
+  test_MatchScheduler_MatchesHaveIndependentBuses();
+  test_Match_InputsAppliedInAfterNetworkReceiveFlush();
+
+  return 0;
+}
@@ -0,0 +1,141 @@
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Logger.h"
+#include "Metrics.h"
+#include "MetricsExporter.h"
+
+#define TEST(name)    \
+  void test_##name(); \
+  void test_##name()
+
+namespace {
+
+bool contains(const std::string& text, const std::string& line) {
+  return text.find(line) != std::string::npos;
+}
+
+}  // namespace
+
+TEST(Metrics_CounterSumsAcrossThreads) {
+  Counter counter;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&counter]() {
+      for (int i = 0; i < 10000; ++i) counter.add();
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  counter.add(5);
+  assert(counter.value() == 80005);
+}
+
+TEST(Metrics_GaugeSetAndAdd) {
+  Gauge gauge;
+  gauge.set(10.0);
+  gauge.add(2.5);
+  gauge.add(-4.0);
+  assert(gauge.value() == 8.5);
+}
+
+TEST(Metrics_HistogramBuckets) {
+  Histogram histogram({1.0, 5.0, 10.0});
+  histogram.observe(0.5);
+  histogram.observe(1.0);  // Bounds are inclusive
+  histogram.observe(7.0);
+  histogram.observe(50.0);
+
+  assert(histogram.bucketCount(0) == 2);
+  assert(histogram.bucketCount(1) == 0);
+  assert(histogram.bucketCount(2) == 1);
+  assert(histogram.bucketCount(3) == 1);
+  assert(histogram.count() == 4);
+  assert(histogram.sum() == 58.5);
+}
+
+TEST(Metrics_RegistryReturnsSameSeries) {
+  MetricsRegistry registry;
+  Counter& a = registry.counter("test_hits_total", "Hits", "kind=\"a\"");
+  Counter& again = registry.counter("test_hits_total", "Hits", "kind=\"a\"");
+  Counter& b = registry.counter("test_hits_total", "Hits", "kind=\"b\"");
+  assert(&a == &again);
+  assert(&a != &b);
+}
+
+TEST(Metrics_RenderPrometheus) {
+  MetricsRegistry registry;
+  registry.counter("test_packets_total", "Packets", "type=\"Input\"").add(3);
+  registry.gauge("test_players", "Players").set(2);
+  Histogram& tick = registry.histogram("test_tick_ms", "Tick time",
+                                       {1.0, 2.5}, "match=\"0\"");
+  tick.observe(0.5);
+  tick.observe(2.0);
+  tick.observe(4.0);
+
+  std::string text = registry.renderPrometheus();
+  assert(contains(text, "# HELP test_packets_total Packets\n"));
+  assert(contains(text, "# TYPE test_packets_total counter\n"));
+  assert(contains(text, "test_packets_total{type=\"Input\"} 3\n"));
+  assert(contains(text, "# TYPE test_players gauge\n"));
+  assert(contains(text, "test_players 2\n"));
+  assert(contains(text, "# TYPE test_tick_ms histogram\n"));
+  assert(contains(text, "test_tick_ms_bucket{match=\"0\",le=\"1\"} 1\n"));
+  assert(contains(text, "test_tick_ms_bucket{match=\"0\",le=\"2.5\"} 2\n"));
+  assert(contains(text, "test_tick_ms_bucket{match=\"0\",le=\"+Inf\"} 3\n"));
+  assert(contains(text, "test_tick_ms_sum{match=\"0\"} 6.5\n"));
+  assert(contains(text, "test_tick_ms_count{match=\"0\"} 3\n"));
+
+  // Families keep registration order
+  assert(text.find("test_packets_total") < text.find("test_players"));
+}
+
+TEST(Metrics_RemoveDropsSeries) {
+  MetricsRegistry registry;
+  registry.gauge("test_rtt_ms", "RTT", "client=\"1\"").set(30);
+  registry.gauge("test_rtt_ms", "RTT", "client=\"2\"").set(40);
+  registry.remove("test_rtt_ms", "client=\"1\"");
+
+  std::string text = registry.renderPrometheus();
+  assert(!contains(text, "client=\"1\""));
+  assert(contains(text, "test_rtt_ms{client=\"2\"} 40\n"));
+}
+
+TEST(Metrics_ExporterWritesFile) {
+  MetricsRegistry registry;
+  Counter& ticks = registry.counter("test_ticks_total", "Ticks");
+  ticks.add(7);
+
+  const std::string path = "test_metrics_export.prom";
+  MetricsExporter exporter(registry, path, 10);
+  assert(exporter.start());
+  ticks.add(1);
+  exporter.stop();  // Writes the final values
+
+  std::ifstream file(path);
+  assert(file && "Exporter did not create the file");
+  std::stringstream contents;
+  contents << file.rdbuf();
+  assert(contains(contents.str(), "test_ticks_total 8\n"));
+
+  std::remove(path.c_str());
+}
+
+int main() {
+  Logger::init();
+
+  test_Metrics_CounterSumsAcrossThreads();
+  test_Metrics_GaugeSetAndAdd();
+  test_Metrics_HistogramBuckets();
+  test_Metrics_RegistryReturnsSameSeries();
+  test_Metrics_RenderPrometheus();
+  test_Metrics_RemoveDropsSeries();
+  test_Metrics_ExporterWritesFile();
+
+  return 0;
+}
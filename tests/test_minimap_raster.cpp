@@ -0,0 +1,116 @@
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "Logger.h"
+#include "MinimapRaster.h"
+#include "TileChunkGrid.h"
+
+#define TEST(name)    \
+  void test_##name(); \
+  void test_##name()
+
+namespace {
+
+constexpr int MAP_TILES = 10;
+constexpr int TILE_W = 64;
+constexpr int TILE_H = 32;
+// As TiledMap::getWorldWidth/getWorldHeight work them out
+constexpr float WORLD_W = (MAP_TILES - 1) * TILE_W;
+constexpr float WORLD_H = (2 * MAP_TILES - 2) * TILE_H / 4;
+
+uint8_t alphaAt(const MinimapRaster& raster, float wx, float wy) {
+  float px, py;
+  raster.worldToPixel(wx, wy, px, py);
+  size_t i =
+      (static_cast<size_t>(py) * raster.getWidth() + static_cast<size_t>(px));
+  return raster.getPixels()[i * 4 + 3];
+}
+
+const uint8_t* pixelAt(const MinimapRaster& raster, float wx, float wy) {
+  float px, py;
+  raster.worldToPixel(wx, wy, px, py);
+  size_t i =
+      (static_cast<size_t>(py) * raster.getWidth() + static_cast<size_t>(px));
+  return &raster.getPixels()[i * 4];
+}
+
+void bake(MinimapRaster& raster, const std::vector<uint32_t>& gids,
+          const std::vector<CollisionShape>& shapes = {}) {
+  std::vector<const uint32_t*> layers = {gids.data(), nullptr};
+  raster.bakeTerrain(MAP_TILES, MAP_TILES, TILE_W, TILE_H, layers, shapes,
+                     WORLD_W, WORLD_H);
+}
+
+}  // namespace
+
+TEST(MinimapRaster_TerrainFillsMapDiamond) {
+  MinimapRaster raster(200, 100);
+  bake(raster, std::vector<uint32_t>(MAP_TILES * MAP_TILES, 1));
+
+  // Inside the diamond is ground; its bounding box corners are not
+  assert(alphaAt(raster, 0.0f, 0.0f) != 0);
+  assert(alphaAt(raster, -WORLD_W / 2 + 1, -WORLD_H / 2 + 1) == 0);
+  assert(alphaAt(raster, WORLD_W / 2 - 1, WORLD_H / 2 - 1) == 0);
+}
+
+TEST(MinimapRaster_EmptyTilesStayClear) {
+  std::vector<uint32_t> gids(MAP_TILES * MAP_TILES, 1);
+  gids[5 * MAP_TILES + 5] = 0;
+  MinimapRaster raster(200, 100);
+  bake(raster, gids);
+
+  TileChunkGrid grid(MAP_TILES, MAP_TILES, TILE_W, TILE_H, 4);
+  float wx, wy;
+  grid.gridToWorld(5, 5, wx, wy);
+  assert(alphaAt(raster, wx, wy) == 0);
+  grid.gridToWorld(5, 3, wx, wy);
+  assert(alphaAt(raster, wx, wy) != 0);
+}
+
+TEST(MinimapRaster_CollisionDrawnOverTerrain) {
+  std::vector<uint32_t> gids(MAP_TILES * MAP_TILES, 1);
+  CollisionShape wall;
+  wall.type = CollisionShape::Type::Rectangle;
+  wall.aabb = {40.0f, -10.0f, 30.0f, 20.0f};
+  MinimapRaster raster(200, 100);
+
+  bake(raster, gids);
+  const uint8_t* before = pixelAt(raster, 55.0f, 0.0f);
+  uint8_t groundRed = before[0];
+
+  bake(raster, gids, {wall});
+  assert(pixelAt(raster, 55.0f, 0.0f)[0] != groundRed);
+  assert(pixelAt(raster, -55.0f, 0.0f)[0] == groundRed);
+}
+
+TEST(MinimapRaster_ClearOverlayRestoresTerrain) {
+  MinimapRaster raster(200, 100);
+  bake(raster, std::vector<uint32_t>(MAP_TILES * MAP_TILES, 1));
+  const std::vector<uint8_t> terrain = raster.getPixels();
+
+  raster.drawObjective(0.0f, 0.0f, 50.0f, ObjectiveState::Inactive, 150.0f,
+                       0.0f);
+  assert(raster.getPixels() != terrain);
+  // The deposit point is marked while the objective is open
+  assert(pixelAt(raster, 150.0f, 0.0f)[0] == 255);
+
+  raster.clearOverlay();
+  assert(raster.getPixels() == terrain);
+
+  // Completed objectives drop their deposit marker
+  raster.drawObjective(0.0f, 0.0f, 50.0f, ObjectiveState::Completed, 150.0f,
+                       0.0f);
+  assert(pixelAt(raster, 150.0f, 0.0f)[0] != 255);
+}
+
+int main() {
+  Logger::init();
+
+  test_MinimapRaster_TerrainFillsMapDiamond();
+  test_MinimapRaster_EmptyTilesStayClear();
+  test_MinimapRaster_CollisionDrawnOverTerrain();
+  test_MinimapRaster_ClearOverlayRestoresTerrain();
+
+  return 0;
+}
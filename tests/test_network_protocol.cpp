@@ -344,6 +344,7 @@ TEST(NetworkProtocol_AllPacketTypes_RoundTrip) {
 
   auto testEnemyStateUpdate = []() {
     EnemyStateUpdatePacket original;
+    original.serverTick = 4242;
 
     // Add some enemies
     for (int i = 0; i < 3; i++) {
@@ -364,6 +365,7 @@ TEST(NetworkProtocol_AllPacketTypes_RoundTrip) {
     auto deserialized =
         deserializeEnemyStateUpdate(serialized.data(), serialized.size());
 
+    assert(deserialized.serverTick == 4242);
     assert(deserialized.enemies.size() == 3);
     assert(deserialized.enemies[0].id == 0);
     assert(floatEqual(deserialized.enemies[1].x, 10.0f));
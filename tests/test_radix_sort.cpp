@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "Logger.h"
+#include "RadixSort.h"
+
+#define TEST(name)    \
+  void test_##name(); \
+  void test_##name()
+
+namespace {
+
+struct Item {
+  float depth;
+  int order;  // Insertion order, to check stability
+};
+
+void sortByDepth(std::vector<Item>& items, std::vector<Item>& scratch) {
+  radixSort(items, scratch,
+            [](const Item& item) { return radixKeyFromFloat(item.depth); });
+}
+
+}  // namespace
+
+TEST(RadixSort_FloatKeysKeepOrder) {
+  const float values[] = {-1e6f, -3.5f, -0.0f, 0.0f, 1e-6f, 2.0f, 1e9f};
+  for (size_t i = 1; i < sizeof(values) / sizeof(values[0]); ++i) {
+    assert(radixKeyFromFloat(values[i - 1]) <= radixKeyFromFloat(values[i]));
+  }
+  assert(radixKeyFromFloat(-3.5f) < radixKeyFromFloat(-1.0f));
+}
+
+TEST(RadixSort_MatchesStableSort) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> dist(-5000.0f, 5000.0f);
+
+  std::vector<Item> items;
+  for (int i = 0; i < 2000; ++i) {
+    // Coarse values so plenty of ties exercise stability
+    items.push_back({std::round(dist(rng) / 50.0f) * 50.0f, i});
+  }
+
+  std::vector<Item> expected = items;
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const Item& a, const Item& b) {
+                     return a.depth < b.depth;
+                   });
+
+  std::vector<Item> scratch;
+  sortByDepth(items, scratch);
+
+  for (size_t i = 0; i < items.size(); ++i) {
+    assert(items[i].depth == expected[i].depth);
+    assert(items[i].order == expected[i].order);
+  }
+}
+
+TEST(RadixSort_ReusesBuffers) {
+  std::vector<Item> items = {{3.0f, 0}, {1.0f, 1}, {2.0f, 2}};
+  std::vector<Item> scratch;
+  items.reserve(64);
+  scratch.reserve(64);
+
+  for (int frame = 0; frame < 10; ++frame) {
+    std::reverse(items.begin(), items.end());
+    sortByDepth(items, scratch);
+    assert(items[0].depth == 1.0f && items[2].depth == 3.0f);
+  }
+  assert(items.capacity() >= 64 && scratch.capacity() >= 64);
+
+  // Trivial inputs
+  std::vector<Item> empty;
+  sortByDepth(empty, scratch);
+  assert(empty.empty());
+}
+
+int main() {
+  Logger::init();
+
+  test_RadixSort_FloatKeysKeepOrder();
+  test_RadixSort_MatchesStableSort();
+  test_RadixSort_ReusesBuffers();
+
+  return 0;
+}
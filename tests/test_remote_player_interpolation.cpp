@@ -1,5 +1,10 @@
+#include <cmath>
+
+#include "AnimationSystem.h"
 #include "Logger.h"
 #include "RemotePlayerInterpolation.h"
+#include "ServerClock.h"
+#include "SnapshotBuffer.h"
 #include "test_utils.h"
 
 TEST(RemotePlayerInterpolation_PlayerLifecycle) {
@@ -21,6 +26,27 @@ TEST(RemotePlayerInterpolation_PlayerLifecycle) {
   assert(interpolation.getRemotePlayerIds().size() == 0);
 }
 
+TEST(RemotePlayerInterpolation_UnregistersAnimationsOnDestruction) {
+  resetEventBus();
+  AnimationSystem animSystem(EventBus::instance());
+  {
+    RemotePlayerInterpolation interpolation(999, &animSystem);
+    publishPlayerJoined(1, 0, 0, 255);  // Local player
+    publishPlayerJoined(2, 255, 0, 0);
+    publishPlayerJoined(3, 0, 255, 0);
+    assert(animSystem.getEntityCount() == 2);
+  }
+  assert(animSystem.getEntityCount() == 0);
+
+  // Slots left behind would be touched by this swap-remove
+  Player first, second;
+  animSystem.registerEntity(&first);
+  animSystem.registerEntity(&second);
+  animSystem.unregisterEntity(&first);
+  assert(animSystem.getEntityCount() == 1);
+  animSystem.advance(16.67f);
+}
+
 TEST(RemotePlayerInterpolation_SkipLocalPlayer) {
   resetEventBus();
   RemotePlayerInterpolation interpolation(999);
@@ -41,12 +67,12 @@ TEST(RemotePlayerInterpolation_Interpolation) {
   publishPlayerJoined(2, 255, 0, 0);
 
   Player player;
-  assert(interpolation.getInterpolatedState(2, 0.5f, player));
+  assert(interpolation.getInterpolatedState(2, 1.5, player));
   assert(player.id == 2);
 
   PlayerState ps1{2, 100.0f, 200.0f, 10.0f, 20.0f, 90.0f, 255, 0, 0, 0};
   publishStateUpdate(1, {ps1});
-  interpolation.getInterpolatedState(2, 0.5f, player);
+  interpolation.getInterpolatedState(2, 1.0, player);
   assert(floatEqual(player.x, 100.0f));
   assert(floatEqual(player.y, 200.0f));
 
@@ -54,16 +80,16 @@ TEST(RemotePlayerInterpolation_Interpolation) {
   publishStateUpdate(2, {ps2});
 
   struct InterpolationTest {
-    float t;
+    double renderTick;
     float expectedX;
     float expectedY;
   };
 
   InterpolationTest tests[] = {
-      {0.0f, 100.0f, 200.0f}, {0.5f, 150.0f, 300.0f}, {1.0f, 200.0f, 400.0f}};
+      {1.0, 100.0f, 200.0f}, {1.5, 150.0f, 300.0f}, {2.0, 200.0f, 400.0f}};
 
   for (const auto& test : tests) {
-    interpolation.getInterpolatedState(2, test.t, player);
+    interpolation.getInterpolatedState(2, test.renderTick, player);
     assert(floatEqual(player.x, test.expectedX));
     assert(floatEqual(player.y, test.expectedY));
   }
@@ -99,18 +125,157 @@ TEST(RemotePlayerInterpolation_MultipleRemotePlayers) {
 
   for (uint32_t id = 2; id <= 4; id++) {
     Player player;
-    assert(interpolation.getInterpolatedState(id, 0.0f, player));
+    assert(interpolation.getInterpolatedState(id, 1.0, player));
     assert(floatEqual(player.x, float(id * 100)));
   }
 }
 
+TEST(RemotePlayerInterpolation_RenderStatesMatchInterpolatedState) {
+  resetEventBus();
+  RemotePlayerInterpolation interpolation(999);
+
+  publishPlayerJoined(1, 0, 0, 255);
+  publishPlayerJoined(2, 255, 0, 0);
+  publishPlayerJoined(3, 0, 255, 0);
+
+  PlayerState a1{2, 100.0f, 200.0f, 0.0f, 0.0f, 90.0f, 255, 0, 0, 0};
+  publishStateUpdate(1, {a1});
+  PlayerState a2{2, 200.0f, 400.0f, 0.0f, 0.0f, 70.0f, 255, 0, 0, 0};
+  publishStateUpdate(2, {a2});
+
+  std::vector<RemotePlayerRenderState> states;
+  states.reserve(4);
+  interpolation.appendRenderStates(1.25, states);
+  assert(states.size() == 2);
+
+  for (const RemotePlayerRenderState& state : states) {
+    Player player;
+    assert(interpolation.getInterpolatedState(state.id, 1.25, player));
+    assert(floatEqual(state.x, player.x));
+    assert(floatEqual(state.y, player.y));
+    assert(floatEqual(state.health, player.health));
+    assert(state.r == player.r && state.g == player.g && state.b == player.b);
+    // Copies carry their own playback state over the same shared clips
+    const AnimationController* animation = player.getAnimationController();
+    assert(state.animation->getLibrary() == animation->getLibrary());
+    assert(state.animation->getCurrentClipId() ==
+           animation->getCurrentClipId());
+  }
+
+  // Appends rather than replaces
+  interpolation.appendRenderStates(1.25, states);
+  assert(states.size() == 4);
+}
+
+TEST(RemotePlayerInterpolation_ExtrapolationIsCapped) {
+  resetEventBus();
+  RemotePlayerInterpolation interpolation(999);
+  publishPlayerJoined(1, 0, 0, 255);
+  publishPlayerJoined(2, 255, 0, 0);
+
+  // 600 px/sec along x
+  PlayerState ps{2, 100.0f, 0.0f, 600.0f, 0.0f, 100.0f, 255, 0, 0, 0};
+  publishStateUpdate(10, {ps});
+
+  float tickMs = interpolation.getServerClock().getTickMs();
+  Player player;
+  assert(interpolation.getInterpolatedState(2, 12.0, player));
+  assert(floatEqual(player.x, 100.0f + 600.0f * 2 * tickMs / 1000.0f, 0.01f));
+
+  // A long stall moves no further than MAX_EXTRAPOLATION_MS
+  float maxX =
+      100.0f + 600.0f * Config::Network::MAX_EXTRAPOLATION_MS / 1000.0f;
+  assert(interpolation.getInterpolatedState(2, 1000.0, player));
+  assert(floatEqual(player.x, maxX, 0.01f));
+}
+
+TEST(RemotePlayerInterpolation_LateSnapshotsAreDropped) {
+  resetEventBus();
+  RemotePlayerInterpolation interpolation(999);
+  publishPlayerJoined(1, 0, 0, 255);
+  publishPlayerJoined(2, 255, 0, 0);
+
+  PlayerState at1{2, 100.0f, 0.0f, 0.0f, 0.0f, 100.0f, 255, 0, 0, 0};
+  PlayerState at3{2, 300.0f, 0.0f, 0.0f, 0.0f, 100.0f, 255, 0, 0, 0};
+  PlayerState at2{2, 200.0f, 0.0f, 0.0f, 0.0f, 100.0f, 255, 0, 0, 0};
+  publishStateUpdate(1, {at1});
+  publishStateUpdate(3, {at3});
+  publishStateUpdate(2, {at2});  // Late: already behind tick 3, dropped
+
+  Player player;
+  assert(interpolation.getInterpolatedState(2, 2.0, player));
+  assert(floatEqual(player.x, 200.0f));
+
+  // Before the oldest snapshot, hold it
+  assert(interpolation.getInterpolatedState(2, 0.0, player));
+  assert(floatEqual(player.x, 100.0f));
+}
+
+TEST(SnapshotBuffer_KeepsNewestInTickOrder) {
+  struct Snap {
+    uint32_t serverTick;
+  };
+  SnapshotBuffer<Snap, 4> buffer;
+  assert(buffer.empty());
+  for (uint32_t tick = 1; tick <= 6; tick++) {
+    assert(buffer.push(Snap{tick}));
+  }
+  assert(!buffer.push(Snap{6}));
+  assert(!buffer.push(Snap{2}));
+  assert(buffer.size() == 4);
+  assert(buffer.at(0).serverTick == 3 && buffer.newest().serverTick == 6);
+
+  auto s = buffer.sample(4.25, 0.0);
+  assert(s.from->serverTick == 4 && s.to->serverTick == 5);
+  assert(floatEqual(s.t, 0.25f));
+  s = buffer.sample(9.0, 2.0);
+  assert(s.from == s.to && s.to->serverTick == 6);
+  assert(floatEqual(s.extrapolateTicks, 2.0f));
+}
+
+TEST(ServerClock_TracksServerTickThroughJitter) {
+  ServerClock clock(10.0f, 50.0f);
+  assert(!clock.isSynced());
+
+  // Tick n arrives at local time 1000 + 10n, give or take 4ms
+  for (uint32_t tick = 0; tick < 200; tick++) {
+    double jitter = (tick % 2 == 0) ? 4.0 : -4.0;
+    clock.observe(tick, 1000.0 + tick * 10.0 + jitter);
+  }
+  assert(clock.isSynced());
+  assert(std::abs(clock.getServerTick(3000.0) - 200.0) < 0.5);
+  // 50ms of delay is 5 ticks behind
+  assert(std::abs(clock.getRenderTick(3000.0) - 195.0) < 0.5);
+
+  // One very late packet barely moves the estimate
+  clock.observe(200, 3100.0);
+  assert(std::abs(clock.getServerTick(3000.0) - 200.0) < 1.0);
+}
+
+TEST(ServerClock_ResyncsAfterLargeJump) {
+  ServerClock clock(10.0f, 0.0f);
+  clock.observe(100, 0.0);
+  assert(std::abs(clock.getServerTick(0.0) - 100.0) < 1e-6);
+
+  // Server restarted: tick numbers start over
+  clock.observe(5, 10.0);
+  assert(std::abs(clock.getServerTick(10.0) - 5.0) < 1e-6);
+}
+
 int main() {
   Logger::init();
 
   test_RemotePlayerInterpolation_PlayerLifecycle();
+  test_RemotePlayerInterpolation_UnregistersAnimationsOnDestruction();
   test_RemotePlayerInterpolation_SkipLocalPlayer();
   test_RemotePlayerInterpolation_Interpolation();
   test_RemotePlayerInterpolation_MultipleRemotePlayers();
+  test_RemotePlayerInterpolation_RenderStatesMatchInterpolatedState();
+  test_RemotePlayerInterpolation_ExtrapolationIsCapped();
+  test_RemotePlayerInterpolation_LateSnapshotsAreDropped();
+  test_SnapshotBuffer_KeepsNewestInTickOrder();
+  test_ServerClock_TracksServerTickThroughJitter();
+  test_ServerClock_ResyncsAfterLargeJump();
 
   return 0;
 }
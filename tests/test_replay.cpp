@@ -0,0 +1,243 @@
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BotClient.h"
+#include "InMemoryChannel.h"
+#include "Logger.h"
+#include "Match.h"
+#include "ReplayLog.h"
+#include "ServerGameState.h"
+#include "WorldConfig.h"
+#include "test_utils.h"
+#include "transport/InMemoryServerTransport.h"
+#include "transport/InMemoryTransport.h"
+#include "transport/ReplayServerTransport.h"
+
+namespace {
+
+const std::string REPLAY_PATH = "test_replay.grpl";
+
+struct ReplayResult {
+  uint64_t ticks = 0;
+  uint64_t outputHash = 0;
+  uint64_t bytesSent = 0;
+  uint32_t serverTick = 0;
+};
+
+ReplayResult replay(ReplayReader& reader) {
+  WorldConfig world(800.0f, 600.0f);
+  auto transport = std::make_unique<ReplayServerTransport>(reader);
+  ReplayServerTransport* replayTransport = transport.get();
+  Match match(0, std::move(transport), world, reader.getRngSeed());
+  assert(match.initialize("replay", 0));
+
+  while (true) {
+    replayTransport->setTick(match.getFrameNumber());
+    if (replayTransport->isFinished()) break;
+    match.tick();
+  }
+
+  ReplayResult result;
+  result.ticks = match.getFrameNumber();
+  result.outputHash = replayTransport->getOutputHash();
+  result.bytesSent = replayTransport->getBytesSent();
+  result.serverTick = match.getGameState()->getServerTick();
+  return result;
+}
+
+}  // namespace
+
+TEST(ReplayLog_RoundTrip) {
+  const uint8_t first[] = {1, 2, 3};
+  std::vector<uint8_t> big(300, 0xAB);  // Multi-byte varint length
+
+  {
+    ReplayWriter writer;
+    assert(writer.open(REPLAY_PATH, 1234, "maps/arena.tmx"));
+    writer.write(ReplayRecordKind::Connect, 0, 1);
+    writer.write(ReplayRecordKind::Packet, 0, 1, first, sizeof(first));
+    writer.write(ReplayRecordKind::Packet, 200, 1, big.data(), big.size());
+    writer.write(ReplayRecordKind::Disconnect, 5000, 1);
+    writer.close(6000);
+  }
+
+  ReplayReader reader;
+  assert(reader.open(REPLAY_PATH));
+  assert(reader.getRngSeed() == 1234);
+  assert(reader.getMapPath() == "maps/arena.tmx");
+  assert(reader.getTickCount() == 6000);
+  assert(reader.getRecordCount() == 4);
+
+  ReplayRecord record;
+  assert(reader.next(record));
+  assert(record.kind == ReplayRecordKind::Connect);
+  assert(record.tick == 0 && record.clientId == 1);
+
+  assert(reader.next(record));
+  assert(record.kind == ReplayRecordKind::Packet);
+  assert(record.size == 3 && record.data[2] == 3);
+
+  assert(reader.next(record));
+  assert(record.tick == 200 && record.size == 300);
+  assert(record.data[299] == 0xAB);
+
+  assert(reader.next(record));
+  assert(record.kind == ReplayRecordKind::Disconnect);
+  assert(record.tick == 5000);
+
+  assert(!reader.next(record));  // End is not a record
+
+  reader.rewind();
+  assert(reader.next(record));
+  assert(record.kind == ReplayRecordKind::Connect);
+
+  std::remove(REPLAY_PATH.c_str());
+}
+
+TEST(ReplayLog_TruncatedLogStillPlays) {
+  ReplayWriter writer;
+  assert(writer.open(REPLAY_PATH, 7, ""));
+  const uint8_t payload[] = {9, 9, 9, 9};
+  writer.write(ReplayRecordKind::Connect, 3, 2);
+  writer.write(ReplayRecordKind::Packet, 10, 2, payload, sizeof(payload));
+  writer.close(20);
+
+  std::vector<uint8_t> bytes;
+  {
+    FILE* file = std::fopen(REPLAY_PATH.c_str(), "rb");
+    assert(file);
+    int c;
+    while ((c = std::fgetc(file)) != EOF) {
+      bytes.push_back(static_cast<uint8_t>(c));
+    }
+    std::fclose(file);
+  }
+  std::remove(REPLAY_PATH.c_str());
+
+  // Drop the End record and half the packet payload
+  bytes.resize(bytes.size() - 5);
+
+  ReplayReader reader;
+  assert(reader.openFromMemory(bytes));
+  assert(reader.getRecordCount() == 1);
+  assert(reader.getTickCount() == 4);  // One past the last whole record
+
+  std::vector<uint8_t> garbage = {'N', 'O', 'P', 'E', 0, 0, 0, 0, 0, 0};
+  ReplayReader bad;
+  assert(!bad.openFromMemory(garbage));
+}
+
+TEST(ReplayLog_TruncatedHeaderCutAtRecordStart) {
+  std::vector<uint8_t> payload(300, 0x5A);
+  {
+    // Dropped without close(): no End record
+    ReplayWriter writer;
+    assert(writer.open(REPLAY_PATH, 7, ""));
+    writer.write(ReplayRecordKind::Connect, 3, 2);
+    writer.write(ReplayRecordKind::Packet, 200, 2, payload.data(),
+                 payload.size());
+  }
+
+  std::vector<uint8_t> bytes;
+  {
+    FILE* file = std::fopen(REPLAY_PATH.c_str(), "rb");
+    assert(file);
+    int c;
+    while ((c = std::fgetc(file)) != EOF) {
+      bytes.push_back(static_cast<uint8_t>(c));
+    }
+    std::fclose(file);
+  }
+  std::remove(REPLAY_PATH.c_str());
+
+  // Packet record: kind, 2-byte tick delta (197), client, 2-byte size, data
+  size_t packetStart = bytes.size() - (1 + 2 + 1 + 2 + payload.size());
+
+  // Keep the kind byte and half the tick delta varint
+  bytes.resize(packetStart + 2);
+
+  ReplayReader reader;
+  assert(reader.openFromMemory(bytes));
+  assert(reader.getRecordCount() == 1);
+  assert(reader.getLogSize() == packetStart);
+
+  ReplayRecord record;
+  assert(reader.next(record));
+  assert(record.kind == ReplayRecordKind::Connect);
+  assert(!reader.next(record));
+}
+
+TEST(Replay_RecordedMatchReplaysIdentically) {
+  resetEventBus();
+
+  const uint64_t frames = 180;
+  uint32_t liveServerTick = 0;
+
+  // Live match: in-process bots, recording every input
+  {
+    WorldConfig world(800.0f, 600.0f);
+    auto transport = std::make_unique<InMemoryServerTransport>();
+    InMemoryServerTransport* serverTransport = transport.get();
+    Match match(0, std::move(transport), world, 42);
+
+    std::vector<std::unique_ptr<BotClient>> bots;
+    for (uint32_t i = 0; i < 4; ++i) {
+      auto channel = createInMemoryChannel();
+      serverTransport->addClient(channel);
+      bots.push_back(std::make_unique<BotClient>(
+          std::make_unique<InMemoryTransport>(channel),
+          BotPattern::RandomWalk, 100 + i));
+    }
+    assert(match.initialize("embedded", 0));
+    assert(match.startRecording(REPLAY_PATH, ""));
+    for (auto& bot : bots) {
+      assert(bot->connect("embedded", 0));
+    }
+
+    for (uint64_t frame = 0; frame < frames; ++frame) {
+      // One bot leaves halfway through
+      if (frame == frames / 2) {
+        bots.back()->disconnect();
+      }
+      for (auto& bot : bots) {
+        bot->sendInput(frame);
+      }
+      match.tick();
+      for (auto& bot : bots) {
+        bot->receive();
+      }
+    }
+    liveServerTick = match.getGameState()->getServerTick();
+  }
+
+  ReplayReader reader;
+  assert(reader.open(REPLAY_PATH));
+  assert(reader.getRngSeed() == 42);
+  assert(reader.getTickCount() == frames);
+  assert(reader.getRecordCount() > frames);  // Inputs from several bots
+
+  ReplayResult a = replay(reader);
+  ReplayResult b = replay(reader);
+
+  assert(a.ticks == frames);
+  assert(a.serverTick == liveServerTick);
+  assert(a.bytesSent > 0);
+  assert(a.outputHash == b.outputHash);
+  assert(a.bytesSent == b.bytesSent);
+
+  std::remove(REPLAY_PATH.c_str());
+  resetEventBus();
+}
+
+int main() {
+  Logger::init();
+
+  test_ReplayLog_RoundTrip();
+  test_ReplayLog_TruncatedLogStillPlays();
+  test_ReplayLog_TruncatedHeaderCutAtRecordStart();
+  test_Replay_RecordedMatchReplaysIdentically();
+
+  return 0;
+}
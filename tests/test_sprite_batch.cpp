@@ -0,0 +1,116 @@
+#include <cassert>
+#include <vector>
+
+#include "Logger.h"
+#include "SpriteBatch.h"
+
+#define TEST(name)    \
+  void test_##name(); \
+  void test_##name()
+
+namespace {
+
+struct FlushResult {
+  std::vector<SpriteInstance> instances;
+  std::vector<SpriteDrawRun> runs;
+};
+
+FlushResult flushBatch(SpriteBatch& batch) {
+  FlushResult result;
+  batch.flush([&](const std::vector<SpriteInstance>& instances,
+                  const std::vector<SpriteDrawRun>& runs) {
+    result.instances = instances;
+    result.runs = runs;
+  });
+  return result;
+}
+
+// Tag each sprite through its x so draw order can be checked
+SpriteInstance sprite(float tag) {
+  return SpriteInstance{tag, 0, 32, 32, 0, 0, 1, 1, 1, 1, 1, 1};
+}
+
+}  // namespace
+
+TEST(SpriteBatch_OneDrawPerTextureInBand) {
+  SpriteBatch batch;
+  constexpr uint32_t SHEET = 7;
+  constexpr uint32_t WHITE = 3;
+
+  // 300 enemies with a health bar each, interleaved as RenderSystem used to
+  for (int i = 0; i < 300; ++i) {
+    batch.add(SHEET, sprite(static_cast<float>(i)));
+    batch.add(WHITE, sprite(1000.0f + i));
+  }
+
+  FlushResult result = flushBatch(batch);
+  assert(result.runs.size() == 2);
+  assert(result.instances.size() == 600);
+  assert(batch.getDrawCallCount() == 2);
+  assert(batch.getSpriteCount() == 600);
+  assert(batch.empty());
+
+  // Textures sorted by id, submission order kept within each
+  assert(result.runs[0].textureId == WHITE);
+  assert(result.runs[0].firstInstance == 0);
+  assert(result.runs[0].instanceCount == 300);
+  assert(result.runs[1].textureId == SHEET);
+  assert(result.runs[1].firstInstance == 300);
+  for (int i = 0; i < 300; ++i) {
+    assert(result.instances[i].x == 1000.0f + i);
+    assert(result.instances[300 + i].x == static_cast<float>(i));
+  }
+}
+
+TEST(SpriteBatch_BandsKeepPainterOrder) {
+  SpriteBatch batch;
+
+  batch.add(1, sprite(0));  // Ground marker
+  batch.nextBand();
+  batch.add(2, sprite(1));  // Character behind the ship
+  batch.nextBand();
+  batch.add(1, sprite(2));  // Ship (same texture as the ground marker)
+  batch.nextBand();
+  batch.add(2, sprite(3));  // Character in front of the ship
+  batch.add(2, sprite(4));
+
+  FlushResult result = flushBatch(batch);
+  assert(result.runs.size() == 4);
+  for (int i = 0; i < 5; ++i) {
+    assert(result.instances[i].x == static_cast<float>(i));
+  }
+  assert(result.runs[3].instanceCount == 2);
+
+  // Flush resets the band
+  assert(batch.getBand() == 0);
+}
+
+TEST(SpriteBatch_StatsAccumulateUntilReset) {
+  SpriteBatch batch;
+
+  FlushResult empty = flushBatch(batch);
+  assert(empty.runs.empty());
+  assert(batch.getDrawCallCount() == 0);
+
+  for (int frame = 0; frame < 3; ++frame) {
+    batch.add(5, sprite(0));
+    batch.add(5, sprite(1));
+    flushBatch(batch);
+  }
+  assert(batch.getDrawCallCount() == 3);
+  assert(batch.getSpriteCount() == 6);
+
+  batch.resetStats();
+  assert(batch.getDrawCallCount() == 0);
+  assert(batch.getSpriteCount() == 0);
+}
+
+int main() {
+  Logger::init();
+
+  test_SpriteBatch_OneDrawPerTextureInBand();
+  test_SpriteBatch_BandsKeepPainterOrder();
+  test_SpriteBatch_StatsAccumulateUntilReset();
+
+  return 0;
+}
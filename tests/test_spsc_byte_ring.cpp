@@ -0,0 +1,278 @@
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "InMemoryChannel.h"
+#include "Logger.h"
+#include "SpscByteRing.h"
+#include "transport/InMemoryServerTransport.h"
+#include "transport/InMemoryTransport.h"
+
+#define TEST(name)    \
+  void test_##name(); \
+  void test_##name()
+
+namespace {
+
+// Message i is i bytes long (mod 50) and filled with i
+std::vector<uint8_t> makeMessage(uint32_t i) {
+  return std::vector<uint8_t>(i % 50, static_cast<uint8_t>(i));
+}
+
+bool popMessage(SpscByteRing& ring, std::vector<uint8_t>& out) {
+  const uint8_t* data;
+  size_t length;
+  if (!ring.peek(data, length)) return false;
+  out.assign(data, data + length);
+  ring.consume();
+  return true;
+}
+
+std::vector<uint8_t> payload(const TransportEvent& event) {
+  return std::vector<uint8_t>(event.data.data(),
+                              event.data.data() + event.data.size());
+}
+
+}  // namespace
+
+TEST(SpscByteRing_PushPeekConsume) {
+  SpscByteRing ring(256);
+  assert(ring.empty());
+
+  const uint8_t hello[] = {'h', 'e', 'l', 'l', 'o'};
+  assert(ring.push(hello, sizeof(hello)));
+  assert(!ring.empty());
+
+  // Peeking twice sees the same message until it is consumed
+  const uint8_t* data;
+  size_t length;
+  assert(ring.peek(data, length));
+  assert(length == 5 && std::memcmp(data, hello, 5) == 0);
+  assert(ring.peek(data, length));
+  assert(length == 5);
+  ring.consume();
+
+  assert(ring.empty());
+  assert(!ring.peek(data, length));
+}
+
+TEST(SpscByteRing_EmptyMessage) {
+  SpscByteRing ring(64);
+  assert(ring.push(nullptr, 0));
+
+  const uint8_t* data;
+  size_t length = 99;
+  assert(ring.peek(data, length));
+  assert(length == 0);
+  ring.consume();
+  assert(ring.empty());
+}
+
+TEST(SpscByteRing_CapacityRoundsToPowerOfTwo) {
+  SpscByteRing ring(1000);
+  assert(ring.getCapacity() == 1024);
+  assert(ring.getMaxMessageSize() == 508);
+}
+
+TEST(SpscByteRing_RejectsWhenFullOrTooLarge) {
+  SpscByteRing ring(64);
+  std::vector<uint8_t> big(ring.getMaxMessageSize() + 1, 1);
+  assert(!ring.push(big.data(), big.size()));
+  assert(ring.getDroppedCount() == 1);
+
+  // 12-byte records: five fit in 64 bytes, the sixth doesn't
+  std::vector<uint8_t> message(8, 7);
+  for (int i = 0; i < 5; ++i) {
+    assert(ring.push(message.data(), message.size()));
+  }
+  assert(!ring.push(message.data(), message.size()));
+  assert(ring.getDroppedCount() == 2);
+
+  // Consuming one makes room again
+  std::vector<uint8_t> out;
+  assert(popMessage(ring, out));
+  assert(out == message);
+  assert(ring.push(message.data(), message.size()));
+}
+
+TEST(SpscByteRing_WrapsWithoutSplittingMessages) {
+  SpscByteRing ring(64);
+  std::vector<uint8_t> out;
+
+  // Odd sizes walk the write position across the buffer end many times
+  for (uint32_t i = 0; i < 1000; ++i) {
+    std::vector<uint8_t> message = makeMessage(i % 27);
+    assert(ring.push(message.data(), message.size()));
+    assert(popMessage(ring, out));
+    assert(out == message);
+  }
+  assert(ring.empty());
+  assert(ring.getDroppedCount() == 0);
+}
+
+TEST(SpscByteRing_CrossThreadOrder) {
+  SpscByteRing ring(1024);
+  constexpr uint32_t COUNT = 100000;
+
+  std::thread producer([&ring]() {
+    for (uint32_t i = 0; i < COUNT; ++i) {
+      std::vector<uint8_t> message = makeMessage(i);
+      while (!ring.push(message.data(), message.size())) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  std::vector<uint8_t> out;
+  for (uint32_t i = 0; i < COUNT; ++i) {
+    while (!popMessage(ring, out)) {
+      std::this_thread::yield();
+    }
+    assert(out == makeMessage(i));
+  }
+  producer.join();
+  assert(ring.empty());
+}
+
+TEST(InMemoryChannel_TransportsRoundTrip) {
+  auto channel = createInMemoryChannel(256, 256);
+  InMemoryServerTransport server(channel);
+  InMemoryTransport client(channel);
+  assert(server.initialize("embedded", 0));
+  assert(client.connect("embedded", 0));
+
+  TransportEvent event;
+  assert(server.poll(event));
+  assert(event.type == TransportEventType::CONNECT);
+
+  const uint8_t up[] = {1, 2, 3};
+  client.send(up, sizeof(up));
+  assert(server.poll(event));
+  assert(event.type == TransportEventType::RECEIVE);
+  assert(event.clientId == 1);
+  assert(payload(event) == std::vector<uint8_t>(up, up + 3));
+  assert(!server.poll(event));
+
+  const uint8_t down[] = {9, 8};
+  server.broadcast(down, sizeof(down));
+  server.send(1, down, 1);
+  assert(client.poll(event));
+  assert(payload(event) == std::vector<uint8_t>(down, down + 2));
+  assert(client.poll(event));
+  assert(payload(event) == std::vector<uint8_t>(down, down + 1));
+  assert(!client.poll(event));
+
+  // A client that stops draining loses messages instead of growing memory
+  std::vector<uint8_t> large(100, 5);
+  server.broadcast(large.data(), large.size());
+  server.broadcast(large.data(), large.size());
+  server.broadcast(large.data(), large.size());
+  assert(channel->serverToClient.getDroppedCount() == 1);
+}
+
+TEST(InMemoryChannel_PayloadPointsIntoRing) {
+  auto channel = createInMemoryChannel(256, 256);
+  InMemoryServerTransport server(channel);
+  InMemoryTransport client(channel);
+  assert(server.initialize("embedded", 0));
+  assert(client.connect("embedded", 0));
+
+  TransportEvent event;
+  assert(server.poll(event));
+
+  // The server reads the client's record in place; it stays in the ring
+  // until the payload lets go of it
+  const uint8_t up[] = {1, 2, 3};
+  client.send(up, sizeof(up));
+  client.send(up, 2);
+  assert(server.poll(event));
+  const uint8_t* record;
+  size_t length;
+  assert(channel->clientToServer.peek(record, length));
+  assert(event.data.data() == record && event.data.size() == 3);
+
+  // The next poll consumes it before lending the following record
+  assert(server.poll(event));
+  assert(channel->clientToServer.peek(record, length));
+  assert(event.data.data() == record && event.data.size() == 2);
+  event.clear();
+  assert(channel->clientToServer.empty());
+
+  const uint8_t down[] = {9, 8};
+  server.send(1, down, sizeof(down));
+  assert(client.poll(event));
+  assert(channel->serverToClient.peek(record, length));
+  assert(event.data.data() == record && event.data.size() == 2);
+  assert(!client.poll(event));
+  assert(channel->serverToClient.empty());
+}
+
+TEST(InMemoryChannel_CountsOversizeMessages) {
+  auto channel = createInMemoryChannel(256, 256);
+  InMemoryServerTransport server(channel);
+  InMemoryTransport client(channel);
+  assert(server.initialize("embedded", 0));
+  assert(client.connect("embedded", 0));
+
+  TransportEvent event;
+  assert(server.poll(event));
+
+  size_t limit = channel->serverToClient.getMaxMessageSize();
+  std::vector<uint8_t> oversize(limit + 1, 3);
+  server.send(1, oversize.data(), oversize.size());
+  client.send(oversize.data(), oversize.size());
+  assert(channel->serverToClient.getDroppedCount() == 1);
+  assert(channel->clientToServer.getDroppedCount() == 1);
+  assert(server.getDroppedCount() == 2);
+  assert(!client.poll(event));
+  assert(!server.poll(event));
+}
+
+TEST(InMemoryChannel_RateLimitsDropLogsButCountsEveryDrop) {
+  size_t logged = 0;
+  for (uint64_t dropped = 1; dropped <= 1000; ++dropped) {
+    if (shouldLogRingDrop(dropped)) logged++;
+  }
+  assert(logged == 10);  // 1, 2, 4, ... 512
+  assert(shouldLogRingDrop(1) && shouldLogRingDrop(64));
+  assert(!shouldLogRingDrop(3) && !shouldLogRingDrop(100));
+
+  // Nobody polls the client, so its ring fills and the rest are dropped
+  auto channel = createInMemoryChannel(256, 256);
+  InMemoryServerTransport server(channel);
+  InMemoryTransport client(channel);
+  assert(server.initialize("embedded", 0));
+  assert(client.connect("embedded", 0));
+
+  TransportEvent event;
+  assert(server.poll(event));
+
+  const uint8_t message[32] = {};
+  size_t delivered = 0;
+  for (int i = 0; i < 100; ++i) {
+    uint64_t before = server.getDroppedCount();
+    server.send(1, message, sizeof(message));
+    if (server.getDroppedCount() == before) delivered++;
+  }
+  assert(delivered > 0 && delivered < 100);
+  assert(server.getDroppedCount() == 100 - delivered);
+}
+
+int main() {
+  Logger::init();
+
+  test_SpscByteRing_PushPeekConsume();
+  test_SpscByteRing_EmptyMessage();
+  test_SpscByteRing_CapacityRoundsToPowerOfTwo();
+  test_SpscByteRing_RejectsWhenFullOrTooLarge();
+  test_SpscByteRing_WrapsWithoutSplittingMessages();
+  test_SpscByteRing_CrossThreadOrder();
+  test_InMemoryChannel_TransportsRoundTrip();
+  test_InMemoryChannel_PayloadPointsIntoRing();
+  test_InMemoryChannel_CountsOversizeMessages();
+  test_InMemoryChannel_RateLimitsDropLogsButCountsEveryDrop();
+
+  return 0;
+}
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "Logger.h"
+#include "TileChunkGrid.h"
+
+#define TEST(name)    \
+  void test_##name(); \
+  void test_##name()
+
+namespace {
+
+constexpr int TILE_W = 64;
+constexpr int TILE_H = 32;
+
+// Index of the chunk holding a tile
+size_t chunkOf(const TileChunkGrid& grid, int tileX, int tileY) {
+  const auto& chunks = grid.getChunks();
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    const TileChunk& c = chunks[i];
+    if (tileX >= c.firstTileX && tileX < c.firstTileX + c.tilesWide &&
+        tileY >= c.firstTileY && tileY < c.firstTileY + c.tilesHigh) {
+      return i;
+    }
+  }
+  assert(false && "Tile not covered by any chunk");
+  return 0;
+}
+
+}  // namespace
+
+TEST(TileChunkGrid_CoversMapOnceBackToFront) {
+  TileChunkGrid grid(200, 150, TILE_W, TILE_H, 32);
+  const auto& chunks = grid.getChunks();
+
+  assert(chunks.size() == 7 * 5);
+
+  size_t tiles = 0;
+  int lastDiagonal = 0;
+  for (const TileChunk& chunk : chunks) {
+    tiles += static_cast<size_t>(chunk.tilesWide) * chunk.tilesHigh;
+    int diagonal = chunk.firstTileX / 32 + chunk.firstTileY / 32;
+    assert(diagonal >= lastDiagonal);
+    lastDiagonal = diagonal;
+  }
+  assert(tiles == 200 * 150);
+
+  // Edge chunks are clipped to the map
+  assert(chunks.back().tilesWide == 200 - 6 * 32);
+  assert(chunks.back().tilesHigh == 150 - 4 * 32);
+}
+
+TEST(TileChunkGrid_MapCenteredOnOrigin) {
+  TileChunkGrid grid(100, 100, TILE_W, TILE_H, 32);
+
+  float x0, y0, x1, y1;
+  grid.gridToWorld(0, 0, x0, y0);
+  grid.gridToWorld(99, 99, x1, y1);
+  assert(x0 == 0.0f && x1 == 0.0f);
+  assert(y0 == -y1);
+}
+
+TEST(TileChunkGrid_VisibleChunksDoNotGrowWithMap) {
+  std::vector<size_t> visible;
+
+  TileChunkGrid small(200, 200, TILE_W, TILE_H, 32);
+  small.findVisible(-400, -300, 400, 300, visible);
+  size_t smallCount = visible.size();
+
+  TileChunkGrid large(500, 500, TILE_W, TILE_H, 32);
+  large.findVisible(-400, -300, 400, 300, visible);
+  size_t largeCount = visible.size();
+
+  assert(smallCount > 0 && smallCount <= 9);
+  assert(largeCount > 0 && largeCount <= 9);
+  assert(large.getChunks().size() == 16 * 16);
+
+  // Nothing visible far off the map
+  large.findVisible(1e6f, 1e6f, 1e6f + 800, 1e6f + 600, visible);
+  assert(visible.empty());
+}
+
+TEST(TileChunkGrid_CullingIsConservative) {
+  TileChunkGrid grid(64, 64, TILE_W, TILE_H, 8);
+  std::vector<size_t> visible;
+
+  const float views[][4] = {
+      {-400, -300, 400, 300},
+      {500, 200, 1300, 800},
+      {-2100, -100, -1300, 500},
+  };
+
+  for (const auto& view : views) {
+    grid.findVisible(view[0], view[1], view[2], view[3], visible);
+
+    // Visible chunks come out in stored (back to front) order
+    assert(std::is_sorted(visible.begin(), visible.end()));
+
+    // Every tile whose quad touches the view must be in a visible chunk
+    for (int ty = 0; ty < 64; ++ty) {
+      for (int tx = 0; tx < 64; ++tx) {
+        float wx, wy;
+        grid.gridToWorld(tx, ty, wx, wy);
+        bool onScreen = wx + TILE_W / 2.0f >= view[0] &&
+                        wx - TILE_W / 2.0f <= view[2] &&
+                        wy + TILE_H / 2.0f >= view[1] &&
+                        wy - TILE_H / 2.0f <= view[3];
+        if (onScreen) {
+          size_t chunk = chunkOf(grid, tx, ty);
+          assert(std::find(visible.begin(), visible.end(), chunk) !=
+                 visible.end());
+        }
+      }
+    }
+  }
+}
+
+int main() {
+  Logger::init();
+
+  test_TileChunkGrid_CoversMapOnceBackToFront();
+  test_TileChunkGrid_MapCenteredOnOrigin();
+  test_TileChunkGrid_VisibleChunksDoNotGrowWithMap();
+  test_TileChunkGrid_CullingIsConservative();
+
+  return 0;
+}
@@ -0,0 +1,142 @@
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "EventBus.h"
+#include "Logger.h"
+#include "NetworkServer.h"
+#include "transport/IServerTransport.h"
+#include "transport/TransportEvent.h"
+
+#define TEST(name)    \
+  void test_##name(); \
+  void test_##name()
+
+namespace {
+
+// Lends queued packets without copying, the way ENetServerTransport lends
+// ENetPackets, and counts how often each one is handed back
+class LendingServerTransport : public IServerTransport {
+ public:
+  struct Packet {
+    std::vector<uint8_t> bytes;
+    int releases = 0;
+  };
+
+  std::vector<std::unique_ptr<Packet>> packets;
+  size_t nextPacket = 0;
+
+  void queue(std::vector<uint8_t> bytes) {
+    packets.push_back(std::make_unique<Packet>());
+    packets.back()->bytes = std::move(bytes);
+  }
+
+  bool initialize(const std::string&, uint16_t) override { return true; }
+
+  bool poll(TransportEvent& event) override {
+    if (nextPacket == packets.size()) return false;
+    Packet& packet = *packets[nextPacket++];
+    event.type = TransportEventType::RECEIVE;
+    event.clientId = 1;
+    event.data.borrow(packet.bytes.data(), packet.bytes.size(), &packet,
+                      [](void* owner) {
+                        static_cast<Packet*>(owner)->releases++;
+                      });
+    return true;
+  }
+
+  void send(uint32_t, const uint8_t*, size_t) override {}
+  void broadcast(const uint8_t*, size_t) override {}
+  void stop() override {}
+};
+
+}  // namespace
+
+TEST(TransportPayload_ReleasesBorrowedBuffer) {
+  int released = 0;
+  auto release = [](void* counter) { ++*static_cast<int*>(counter); };
+  const uint8_t bytes[] = {4, 5, 6};
+
+  {
+    TransportEvent event;
+    event.data.borrow(bytes, sizeof(bytes), &released, release);
+    assert(event.data.data() == bytes && event.data.size() == 3);
+    assert(released == 0);
+
+    // Replacing the payload hands the previous buffer back
+    event.data.borrow(bytes, 2, &released, release);
+    assert(released == 1);
+    event.data.assign(bytes, bytes + 1);
+    assert(released == 2);
+    assert(event.data.data() != bytes && event.data.size() == 1);
+
+    event.data.borrow(bytes, sizeof(bytes), &released, release);
+    event.clear();
+    assert(released == 3);
+    assert(event.data.empty());
+
+    event.data.borrow(bytes, sizeof(bytes), &released, release);
+  }
+  assert(released == 4);
+}
+
+TEST(TransportPayload_AssignReusesStorage) {
+  std::vector<uint8_t> large(64, 1);
+  std::vector<uint8_t> small(8, 2);
+
+  TransportPayload payload;
+  payload.assign(large.data(), large.data() + large.size());
+  const uint8_t* storage = payload.data();
+  payload.clear();
+  payload.assign(small.data(), small.data() + small.size());
+  assert(payload.data() == storage);
+  assert(payload.size() == 8 && payload.data()[0] == 2);
+}
+
+TEST(TransportEvent_NetworkServerReleasesEachPacketAfterDispatch) {
+  EventBus bus;
+  auto transport = std::make_unique<LendingServerTransport>();
+  LendingServerTransport* lender = transport.get();
+  NetworkServer server(std::move(transport), bus);
+
+  size_t handled = 0;
+  Subscription subscription = bus.subscribeScoped<NetworkPacketReceivedEvent>(
+      [&](const NetworkPacketReceivedEvent& e) {
+        // Handlers read the lent buffer itself, still unreleased
+        auto& packet = *lender->packets[handled];
+        assert(e.data == packet.bytes.data());
+        assert(e.size == packet.bytes.size());
+        assert(packet.releases == 0);
+        for (size_t i = 0; i < handled; ++i) {
+          assert(lender->packets[i]->releases == 1);
+        }
+        handled++;
+      });
+
+  lender->queue({1, 2, 3});
+  lender->queue({4, 5});
+  server.poll();
+  assert(handled == 2);
+  assert(lender->packets[0]->releases == 1);
+  assert(lender->packets[1]->releases == 1);
+
+  // The same event serves the next poll; nothing is released twice
+  lender->queue({6});
+  server.poll();
+  server.poll();
+  assert(handled == 3);
+  for (const auto& packet : lender->packets) {
+    assert(packet->releases == 1);
+  }
+}
+
+int main() {
+  Logger::init();
+
+  test_TransportPayload_ReleasesBorrowedBuffer();
+  test_TransportPayload_AssignReusesStorage();
+  test_TransportEvent_NetworkServerReleasesEachPacketAfterDispatch();
+
+  return 0;
+}
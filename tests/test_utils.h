@@ -68,10 +68,9 @@ void publishPlayerJoined(uint32_t playerId, uint8_t r, uint8_t g, uint8_t b) {
 template <typename EventType>
 class EventCapture {
  public:
-  EventCapture() {
-    EventBus::instance().subscribe<EventType>(
-        [this](const EventType& e) { events.push_back(e); });
-  }
+  explicit EventCapture(EventBus& bus = EventBus::instance())
+      : subscription(bus.subscribeScoped<EventType>(
+            [this](const EventType& e) { events.push_back(e); })) {}
 
   const std::vector<EventType>& getEvents() const { return events; }
 
@@ -146,6 +145,7 @@ class EventCapture {
 
  private:
   std::vector<EventType> events;
+  Subscription subscription;
 };
 
 // Event Logger - Logs events to stdout for debugging